@@ -0,0 +1,41 @@
+/*
+** Explores the crackme_xor sample with the concolic exploration engine and
+** prints the inputs which have been run and the statistics.
+**
+**  $ ./concolic_exploration.bin ../../samples/crackmes/crackme_xor
+*/
+
+#include <iostream>
+
+#include <triton/elf.hpp>
+#include <triton/explorationEngine.hpp>
+
+using namespace triton;
+using namespace triton::engines::exploration;
+
+
+int main(int ac, const char **av) {
+  if (ac != 2) {
+    std::cerr << "Syntax: " << av[0] << " <binary>" << std::endl;
+    return -1;
+  }
+
+  triton::format::elf::Elf binary(av[1]);
+  ExplorationEngine engine(binary);
+
+  engine.setStrategy(STRATEGY_GENERATIONAL);
+  engine.addArgumentSeed(5);
+  engine.explore();
+
+  for (auto& input : engine.getInputs()) {
+    std::cout << "input: ";
+    for (auto& byte : input)
+      std::cout << static_cast<char>(byte.second);
+    std::cout << std::endl;
+  }
+
+  for (auto& stat : engine.getStats())
+    std::cout << stat.first << ": " << stat.second << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+/*
+** Reports the size of an Instruction and the throughput of the operations
+** performed on it for every processed opcode (construction, copy, reset).
+*/
+
+#include <chrono>
+#include <iostream>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x48\x8b\x05\xb8\x13\x00\x00", 7}, /* mov        rax, QWORD PTR [rip+0x13b8] */
+  {0x400007, (unsigned char *)"\x48\x8d\x34\xc3",             4}, /* lea        rsi, [rbx+rax*8]            */
+  {0x40000b, (unsigned char *)"\x48\x01\xf0",                 3}, /* add        rax, rsi                    */
+  {0x40000e, (unsigned char *)"\x48\x89\x06",                 3}, /* mov        QWORD PTR [rsi], rax        */
+  {0x0,      nullptr,                                         0}
+};
+
+
+template <typename F>
+void bench(const char* name, unsigned int rounds, F function) {
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int round = 0; round < rounds; round++)
+    function();
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << name << ": " << static_cast<unsigned long long>(rounds / seconds) << " ops/s" << std::endl;
+}
+
+
+int main(int ac, const char **av) {
+  unsigned int rounds = 1000000;
+  Instruction  processed;
+
+  api.setArchitecture(ARCH_X86_64);
+
+  std::cout << "sizeof(Instruction): " << sizeof(Instruction) << " bytes" << std::endl;
+
+  bench("construction", rounds, [] {
+    Instruction inst;
+    inst.setOpcodes(trace[0].inst, trace[0].size);
+  });
+
+  /* A processed instruction carries operands, accesses and expressions */
+  processed.setOpcodes(trace[0].inst, trace[0].size);
+  processed.setAddress(trace[0].addr);
+  api.processing(processed);
+
+  bench("copy", rounds, [&processed] {
+    Instruction inst(processed);
+  });
+
+  bench("reset", rounds, [&processed] {
+    Instruction inst(processed);
+    inst.reset();
+  });
+
+  bench("disassembly", rounds / 10, [] {
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst;
+      inst.setOpcodes(trace[i].inst, trace[i].size);
+      inst.setAddress(trace[i].addr);
+      api.disassembly(inst);
+    }
+  });
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+/*
+** Processes one trace per thread with independent Triton APIs and reports the
+** throughput according to the number of threads.
+**
+** Needs a libtriton built with `cmake -DTHREAD_LOCAL_API=on ..`
+*/
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x48\x8d\x34\xc3",             4}, /* lea        rsi, [rbx+rax*8]            */
+  {0x400004, (unsigned char *)"\x48\x01\xf0",                 3}, /* add        rax, rsi                    */
+  {0x400007, (unsigned char *)"\x48\x31\xd8",                 3}, /* xor        rax, rbx                    */
+  {0x40000a, (unsigned char *)"\x48\x0f\xaf\xc3",             4}, /* imul       rax, rbx                    */
+  {0x40000e, (unsigned char *)"\x48\xc1\xe0\x03",             4}, /* shl        rax, 3                      */
+  {0x400012, (unsigned char *)"\x48\x39\xd8",                 3}, /* cmp        rax, rbx                    */
+  {0x0,      nullptr,                                         0}
+};
+
+
+/* Each thread owns its own api, so nothing is shared between workers */
+void worker(unsigned int rounds) {
+  api.setArchitecture(ARCH_X86_64);
+  api.convertRegisterToSymbolicVariable(TRITON_X86_REG_RAX);
+  api.convertRegisterToSymbolicVariable(TRITON_X86_REG_RBX);
+
+  for (unsigned int round = 0; round < rounds; round++) {
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst;
+      inst.setOpcodes(trace[i].inst, trace[i].size);
+      inst.setAddress(trace[i].addr);
+      api.processing(inst);
+    }
+  }
+}
+
+
+int main(int ac, const char **av) {
+  unsigned int rounds     = 2000;
+  unsigned int maxThreads = std::thread::hardware_concurrency();
+
+  if (maxThreads == 0)
+    maxThreads = 1;
+
+  for (unsigned int count = 1; count <= maxThreads; count *= 2) {
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int index = 0; index < count; index++)
+      threads.push_back(std::thread(worker, rounds));
+    for (auto& thread : threads)
+      thread.join();
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds      = std::chrono::duration<double>(end - start).count();
+    double instructions = static_cast<double>(count) * rounds * (sizeof(trace) / sizeof(trace[0]) - 1);
+
+    std::cout << count << " thread(s): " << static_cast<unsigned long long>(instructions / seconds) << " instructions/s" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,79 @@
+/*
+** Measures the cost of the x86 specification lookups performed when
+** operands are decoded: register information, Register construction and
+** capstone disassembly into Triton operands.
+**
+** The last line includes the time spent by capstone itself, so it depends
+** on the capstone version and only partly reflects the Triton lookups.
+*/
+
+#include <chrono>
+#include <iostream>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x48\x8b\x05\xb8\x13\x00\x00", 7}, /* mov        rax, QWORD PTR [rip+0x13b8] */
+  {0x400007, (unsigned char *)"\x48\x8d\x34\xc3",             4}, /* lea        rsi, [rbx+rax*8]            */
+  {0x40000b, (unsigned char *)"\x66\x0f\xd7\xd1",             4}, /* pmovmskb   edx, xmm1                   */
+  {0x40000f, (unsigned char *)"\x80\xf4\x99",                 3}, /* xor        ah, 0x99                    */
+  {0x400012, (unsigned char *)"\xf3\xa4",                     2}, /* rep movsb                               */
+  {0x0,      nullptr,                                         0}
+};
+
+
+int main(int ac, const char **av) {
+  unsigned int rounds = 100000;
+  unsigned int count  = 0;
+
+  api.setArchitecture(ARCH_X86_64);
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int round = 0; round < rounds; round++) {
+    for (unsigned int id = x86::ID_REG_INVALID + 1; id < x86::ID_REG_LAST_ITEM; id++)
+      count += std::get<1>(api.getCpuRegInformation(id));
+  }
+  auto end = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << "register information: " << static_cast<unsigned long long>(rounds * (x86::ID_REG_LAST_ITEM - 1) / seconds) << " lookups/s" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int round = 0; round < rounds; round++) {
+    for (unsigned int id = x86::ID_REG_INVALID + 1; id < x86::ID_REG_LAST_ITEM; id++)
+      count += Register(id).getSize();
+  }
+  end = std::chrono::steady_clock::now();
+  seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << "register construction: " << static_cast<unsigned long long>(rounds * (x86::ID_REG_LAST_ITEM - 1) / seconds) << " registers/s" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  unsigned int decoded      = 0;
+  unsigned int instructions = 0;
+  for (unsigned int round = 0; round < rounds / 10; round++) {
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst;
+      inst.setOpcodes(trace[i].inst, trace[i].size);
+      inst.setAddress(trace[i].addr);
+      api.disassembly(inst);
+      decoded += inst.operands.size();
+      instructions++;
+    }
+  }
+  end = std::chrono::steady_clock::now();
+  seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << "operand decode: " << static_cast<unsigned long long>(decoded / seconds) << " operands/s, "
+            << static_cast<unsigned long long>(instructions / seconds) << " instructions/s" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+/*
+** Measures the size and the printing time of the SMT2 samples in the SMT and SMT_DAG representations.
+**
+**  $ ./smt_dag.bin ../../samples/smt/af.smt2 ../../samples/smt/pf.smt2
+**
+** For each sample, the columns are the number of bytes printed and the mean time of a print
+** in both modes. The last line is a chain of shared additions, x(n+1) = x(n) + x(n), whose tree
+** size doubles at each step while its DAG stays linear.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <z3++.h>
+
+#include <triton/api.hpp>
+#include <triton/z3ToTritonAst.hpp>
+
+using namespace triton;
+using namespace triton::ast::representations;
+
+
+/* The number of prints per sample */
+const unsigned int ROUNDS = 1000;
+
+/* The depth of the chain of shared additions */
+const unsigned int DEPTH = 16;
+
+
+static std::string fileName(const std::string& path) {
+  return path.substr(path.find_last_of('/') + 1);
+}
+
+
+/*
+ * Converts a SMT2 file into a Triton constraint, Z3 keeps the shared subterms shared. Each declared
+ * bit-vector becomes a symbolic variable, the converter only knows the names of the Triton variables.
+ */
+static ast::AbstractNode* parse(const char* path) {
+  std::ifstream file(path);
+  std::string line;
+  char name[256];
+  unsigned int size;
+
+  z3::context ctx;
+  z3::expr_vector from(ctx);
+  z3::expr_vector to(ctx);
+
+  while (std::getline(file, line)) {
+    if (std::sscanf(line.c_str(), "(declare-fun %255s () (_ BitVec %u))", name, &size) == 2) {
+      engines::symbolic::SymbolicVariable* symVar = api.newSymbolicVariable(size);
+      from.push_back(ctx.bv_const(name, size));
+      to.push_back(ctx.bv_const(symVar->getName().c_str(), size));
+    }
+  }
+
+  z3::expr parsed(ctx, Z3_parse_smtlib2_file(ctx, path, 0, 0, 0, 0, 0, 0));
+  z3::expr expr = parsed.substitute(from, to);
+  ast::Z3ToTritonAst converter(expr);
+
+  return ast::assert_(converter.convert());
+}
+
+
+static void measure(const std::string& name, ast::AbstractNode* node) {
+  const triton::uint32 modes[] = {SMT_REPRESENTATION, SMT_DAG_REPRESENTATION};
+  const char* const labels[]   = {"smt", "smt-dag"};
+
+  std::printf("%-24s", name.c_str());
+
+  for (unsigned int m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+    std::size_t size = 0;
+
+    api.setAstRepresentationMode(modes[m]);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int round = 0; round < ROUNDS; round++) {
+      std::stringstream stream;
+      stream << node;
+      size = stream.str().size();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf(" %s: %9lu bytes %9.3f us  ", labels[m], static_cast<unsigned long>(size), elapsed.count() / ROUNDS);
+  }
+
+  std::printf("\n");
+  api.setAstRepresentationMode(SMT_REPRESENTATION);
+}
+
+
+int main(int ac, const char **av) {
+  if (ac < 2) {
+    std::cerr << "Syntax: " << av[0] << " <file.smt2> ..." << std::endl;
+    return -1;
+  }
+
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+
+  for (int index = 1; index < ac; index++)
+    measure(fileName(av[index]), parse(av[index]));
+
+  /* The worst case of the plain representation */
+  ast::AbstractNode* chain = ast::variable(*api.newSymbolicVariable(32));
+  for (unsigned int depth = 0; depth < DEPTH; depth++)
+    chain = ast::bvadd(chain, chain);
+  measure("shared chain", ast::assert_(ast::equal(chain, ast::bv(0, 32))));
+
+  return 0;
+}
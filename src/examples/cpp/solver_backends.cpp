@@ -0,0 +1,126 @@
+/*
+** Compares the solver backends on the SMT2 samples and on the path constraints of a crackme
+** explored with the concolic exploration engine.
+**
+**  $ ./solver_backends.bin ../../samples/smt/*.smt2 ../../samples/crackmes/crackme_xor
+**
+** For a SMT2 file, each column is the mean time of a query and its result. For a binary, it is
+** the time spent in the solver during the whole exploration and the number of queries.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <z3++.h>
+
+#include <triton/api.hpp>
+#include <triton/elf.hpp>
+#include <triton/explorationEngine.hpp>
+#include <triton/z3ToTritonAst.hpp>
+
+using namespace triton;
+using namespace triton::engines::solver;
+
+
+/* The number of queries per sample */
+const unsigned int ROUNDS = 100;
+
+/* The backends to compare */
+const backend_e backends[] = {BACKEND_Z3, BACKEND_BITBLAST};
+const char* const names[]  = {"z3", "bitblast"};
+
+/* The backend of the exploration, set into the API of each run */
+static backend_e current = BACKEND_Z3;
+
+
+static void setup(const triton::engines::exploration::input_t& input) {
+  api.setSolverBackend(current);
+}
+
+
+static std::string fileName(const std::string& path) {
+  return path.substr(path.find_last_of('/') + 1);
+}
+
+
+/* Converts a SMT2 file into a Triton constraint, each declared bit-vector becomes a symbolic variable */
+static ast::AbstractNode* parse(const char* path) {
+  std::ifstream file(path);
+  std::string line;
+  char name[256];
+  unsigned int size;
+
+  z3::context ctx;
+  z3::expr_vector from(ctx);
+  z3::expr_vector to(ctx);
+
+  /* The declared names (e.g: zf, Sym1) are renamed into the names of the Triton variables */
+  while (std::getline(file, line)) {
+    if (std::sscanf(line.c_str(), "(declare-fun %255s () (_ BitVec %u))", name, &size) == 2) {
+      engines::symbolic::SymbolicVariable* symVar = api.newSymbolicVariable(size);
+      from.push_back(ctx.bv_const(name, size));
+      to.push_back(ctx.bv_const(symVar->getName().c_str(), size));
+    }
+  }
+
+  z3::expr parsed(ctx, Z3_parse_smtlib2_file(ctx, path, 0, 0, 0, 0, 0, 0));
+  z3::expr expr = parsed.substitute(from, to);
+  ast::Z3ToTritonAst converter(expr);
+
+  return ast::assert_(converter.convert());
+}
+
+
+static bool isElf(const char* path) {
+  char magic[4] = {0};
+  std::ifstream file(path, std::ios::binary);
+  file.read(magic, sizeof(magic));
+  return (magic[0] == 0x7f && magic[1] == 'E' && magic[2] == 'L' && magic[3] == 'F');
+}
+
+
+int main(int ac, const char **av) {
+  if (ac < 2) {
+    std::cerr << "Syntax: " << av[0] << " <file.smt2 | binary> ..." << std::endl;
+    return -1;
+  }
+
+  for (int index = 1; index < ac; index++) {
+    std::printf("%-24s", fileName(av[index]).c_str());
+
+    for (unsigned int b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+      if (isElf(av[index])) {
+        triton::format::elf::Elf binary(av[index]);
+        triton::engines::exploration::ExplorationEngine engine(binary);
+
+        current = backends[b];
+        engine.setSetup(setup);
+        engine.addArgumentSeed(5);
+        engine.explore();
+
+        auto stats = engine.getStats();
+        std::printf(" %s: %9.3f ms  (%lu queries)  ", names[b], static_cast<double>(stats["solver_time_ms"]), static_cast<unsigned long>(stats["solver_queries"]));
+        continue;
+      }
+
+      /* A fresh state for each sample */
+      api.setArchitecture(triton::arch::ARCH_X86_64);
+      ast::AbstractNode* constraint = parse(av[index]);
+      status_e status = UNKNOWN;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (unsigned int round = 0; round < ROUNDS; round++)
+        api.getModel(constraint, &status, 0, backends[b]);
+      std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+      std::printf(" %s: %9.3f ms  %-5s ", names[b], elapsed.count() / ROUNDS, status == SAT ? "sat" : status == UNSAT ? "unsat" : "?");
+    }
+
+    std::printf("\n");
+  }
+
+  return 0;
+}
@@ -150,6 +150,16 @@ namespace triton {
     }
 
 
+    const triton::arch::RegisterSpecification& Architecture::getRegisterSpecification(triton::uint32 reg) const {
+      static const triton::arch::RegisterSpecification invalid;
+
+      if (!this->cpu)
+        return invalid;
+
+      return this->cpu->getRegisterSpecification(reg);
+    }
+
+
     std::set<triton::arch::Register*> Architecture::getAllRegisters(void) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getAllRegisters(): You must define an architecture.");
@@ -175,6 +185,10 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::buildSemantics(): You must define an architecture.");
 
+      /* A new instruction starts a new epoch for memoized concrete values */
+      if (triton::api.isConcreteCallbacksCachePerInstructionEnabled())
+        triton::api.clearConcreteCallbacksCache();
+
       /* Pre IR processing */
       inst.preIRInit();
 
@@ -186,8 +200,13 @@ namespace triton {
       if (!triton::api.isSymbolicEngineEnabled())
         triton::api.backupSymbolicEngine();
 
-      /* Processing */
-      this->cpu->buildSemantics(inst);
+      /* Slide the liveness window used to remove dead expressions. */
+      if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::DEAD_EXPRESSIONS))
+        triton::api.getSymbolicEngine()->slideDeadExpressionsWindow();
+
+      /* Processing, the summary of a routine replaces the semantics of its first instruction */
+      if (!triton::api.getSummaryEngine()->processSummary(inst))
+        this->cpu->buildSemantics(inst);
 
       /* Post IR processing */
       inst.postIRInit();
@@ -210,7 +229,7 @@ namespace triton {
           triton::api.freeAstNodes(uniqueNodes);
         }
 
-        inst.symbolicExpressions.clear();
+        inst.clearSymbolicExpressions();
         triton::api.restoreSymbolicEngine();
       }
 
@@ -232,7 +251,7 @@ namespace triton {
           triton::api.freeAstNodes(uniqueNodes);
         }
 
-        inst.symbolicExpressions.clear();
+        inst.clearSymbolicExpressions();
       }
 
       /*
@@ -258,9 +277,14 @@ namespace triton {
           triton::api.freeAstNodes(uniqueNodes);
         }
 
-        inst.symbolicExpressions = newVector;
+        inst.clearSymbolicExpressions();
+        for (it = newVector.begin(); it != newVector.end(); it++)
+          inst.addSymbolicExpression(*it);
       }
 
+      /* Flush the batched simplifications at the end of the instruction or of the basic block */
+      if (!triton::api.isSymbolicSimplificationBatchPerBlockEnabled() || inst.isControlFlow())
+        triton::api.flushSymbolicSimplifications();
     }
 
 
@@ -31,6 +31,7 @@ namespace triton {
 
 
     Instruction::~Instruction() {
+      this->clearSymbolicExpressions();
     }
 
 
@@ -45,25 +46,31 @@ namespace triton {
 
 
     void Instruction::copy(const Instruction& other) {
+      /* The expressions are shared, acquired before the previous ones are released (self-copy) */
+      for (triton::usize index = 0; index < other.symbolicExpressions.size(); index++)
+        other.symbolicExpressions[index]->acquire();
+      this->clearSymbolicExpressions();
+
       this->address             = other.address;
       this->branch              = other.branch;
       this->conditionTaken      = other.conditionTaken;
       this->controlFlow         = other.controlFlow;
+      this->disassembly         = other.disassembly;
       this->loadAccess          = other.loadAccess;
       this->memoryAccess        = other.memoryAccess;
       this->operands            = other.operands;
       this->prefix              = other.prefix;
+      this->readImmediates      = other.readImmediates;
+      this->readRegisters       = other.readRegisters;
       this->registerState       = other.registerState;
       this->size                = other.size;
       this->storeAccess         = other.storeAccess;
       this->symbolicExpressions = other.symbolicExpressions;
       this->tid                 = other.tid;
       this->type                = other.type;
+      this->writtenRegisters    = other.writtenRegisters;
 
       std::memcpy(this->opcodes, other.opcodes, sizeof(this->opcodes));
-
-      this->disassembly.clear();
-      this->disassembly.str(other.disassembly.str());
     }
 
 
@@ -93,7 +100,7 @@ namespace triton {
 
 
     std::string Instruction::getDisassembly(void) const {
-      return this->disassembly.str();
+      return this->disassembly;
     }
 
 
@@ -176,10 +183,11 @@ namespace triton {
 
     /* If there is a concrete value recorded, build the appropriate Register. Otherwise, perfrom the analysis on zero. */
     triton::arch::Register Instruction::getRegisterState(triton::uint32 regId) {
-      triton::arch::Register reg(regId);
-      if (this->registerState.find(regId) != this->registerState.end())
-        reg = this->registerState[regId];
-      return reg;
+      for (triton::usize index = 0; index < this->registerState.size(); index++) {
+        if (this->registerState[index].getId() == regId)
+          return this->registerState[index];
+      }
+      return triton::arch::Register(regId);
     }
 
 
@@ -224,23 +232,42 @@ namespace triton {
 
 
     void Instruction::setDisassembly(const std::string& str) {
-      this->disassembly.clear();
-      this->disassembly.str(str);
+      this->disassembly = str;
     }
 
 
     void Instruction::updateContext(const triton::arch::Register& reg) {
-      this->registerState[reg.getId()] = reg;
+      for (triton::usize index = 0; index < this->registerState.size(); index++) {
+        if (this->registerState[index].getId() == reg.getId()) {
+          this->registerState[index] = reg;
+          return;
+        }
+      }
+      this->registerState.push_back(reg);
     }
 
 
     void Instruction::addSymbolicExpression(triton::engines::symbolic::SymbolicExpression* expr) {
       if (expr == nullptr)
         throw triton::exceptions::Instruction("Instruction::addSymbolicExpression(): Cannot add a null expression.");
+      expr->acquire();
       this->symbolicExpressions.push_back(expr);
     }
 
 
+    /*
+     * An expression removed from the symbolic engine (e.g. by the DEAD_EXPRESSIONS
+     * optimization) stays alive while an instruction holds it.
+     */
+    void Instruction::clearSymbolicExpressions(void) {
+      for (triton::usize index = 0; index < this->symbolicExpressions.size(); index++) {
+        if (this->symbolicExpressions[index]->release())
+          delete this->symbolicExpressions[index];
+      }
+      this->symbolicExpressions.clear();
+    }
+
+
     bool Instruction::isBranch(void) const {
       return this->branch;
     }
@@ -314,7 +341,7 @@ namespace triton {
 
     void Instruction::preIRInit(void) {
       /* Clear previous expressions if exist */
-      this->symbolicExpressions.clear();
+      this->clearSymbolicExpressions();
     }
 
 
@@ -347,7 +374,7 @@ namespace triton {
       this->readImmediates.clear();
       this->readRegisters.clear();
       this->storeAccess.clear();
-      this->symbolicExpressions.clear();
+      this->clearSymbolicExpressions();
       this->writtenRegisters.clear();
 
       std::memset(this->opcodes, 0x00, sizeof(this->opcodes));
@@ -31,6 +31,14 @@ namespace triton {
     };
 
 
+    OperandWrapper::OperandWrapper(const OperandWrapper& other)
+      : imm(other.imm),
+        mem(other.mem),
+        reg(other.reg),
+        type(other.type) {
+    }
+
+
     OperandWrapper::~OperandWrapper() {
     }
 
@@ -14,6 +14,11 @@
 namespace triton {
   namespace arch {
 
+    RegisterSpecification::RegisterSpecification(const std::string& name, triton::uint32 high, triton::uint32 low, triton::uint32 parent)
+      : name(name), high(high), low(low), parent(parent) {
+    }
+
+
     Register::Register() {
       this->clear();
     }
@@ -31,15 +36,13 @@ namespace triton {
     void Register::clear(void) {
       this->concreteValue = 0;
       this->id            = triton::api.cpuInvalidRegister();
-      this->name          = "unknown";
       this->parent        = triton::api.cpuInvalidRegister();
+      this->spec          = &triton::api.getCpuRegSpecification(this->id);
       this->trusted       = false;
     }
 
 
     void Register::setup(triton::uint32 reg, triton::uint512 concreteValue) {
-      std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> regInfo;
-
       this->id        = reg;
       this->trusted   = true;
 
@@ -48,13 +51,11 @@ namespace triton {
         this->trusted = false;
       }
 
-      regInfo      = triton::api.getCpuRegInformation(this->id);
-
-      this->name   = std::get<0>(regInfo);
-      this->parent = std::get<3>(regInfo);
+      this->spec   = &triton::api.getCpuRegSpecification(this->id);
+      this->parent = this->spec->parent;
 
-      this->setHigh(std::get<1>(regInfo));
-      this->setLow(std::get<2>(regInfo));
+      this->setHigh(this->spec->high);
+      this->setLow(this->spec->low);
 
       if (concreteValue > this->getMaxValue())
         throw triton::exceptions::Register("Register::setup(): You cannot set this concrete value (too big) to this register.");
@@ -102,8 +103,8 @@ namespace triton {
     }
 
 
-    std::string Register::getName(void) const {
-      return this->name;
+    const std::string& Register::getName(void) const {
+      return this->spec->name;
     }
 
 
@@ -128,7 +129,8 @@ namespace triton {
 
 
     void Register::setId(triton::uint32 reg) {
-      this->id = reg;
+      this->id   = reg;
+      this->spec = &triton::api.getCpuRegSpecification(reg);
     }
 
 
@@ -169,8 +171,8 @@ namespace triton {
     void Register::copy(const Register& other) {
       this->concreteValue = other.concreteValue;
       this->id            = other.id;
-      this->name          = other.name;
       this->parent        = other.parent;
+      this->spec          = other.spec;
       this->trusted       = other.trusted;
     }
 
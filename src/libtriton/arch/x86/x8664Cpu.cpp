@@ -598,6 +598,11 @@ namespace triton {
       }
 
 
+      const triton::arch::RegisterSpecification& x8664Cpu::getRegisterSpecification(triton::uint32 reg) const {
+        return triton::arch::x86::registerIdToRegisterSpecification(reg, true);
+      }
+
+
       std::set<triton::arch::Register*> x8664Cpu::getAllRegisters(void) const {
         std::set<triton::arch::Register*> ret;
 
@@ -671,9 +676,10 @@ namespace triton {
           for (triton::uint32 j = 0; j < 1; j++) {
 
             /* Init the disassembly */
-            std::stringstream str;
-            str << insn[j].mnemonic << " " <<  insn[j].op_str;
-            inst.setDisassembly(str.str());
+            std::string str(insn[j].mnemonic);
+            str += " ";
+            str += insn[j].op_str;
+            inst.setDisassembly(str);
 
             /* Refine the size */
             inst.setSize(insn[j].size);
@@ -684,7 +690,9 @@ namespace triton {
             /* Init the instruction's prefix */
             inst.setPrefix(triton::arch::x86::capstonePrefixToTritonPrefix(detail->x86.prefix[0]));
 
-            /* Init operands */
+            /* Init operands, an instruction disassembled again gets its new operands only */
+            inst.operands.clear();
+            inst.operands.reserve(detail->x86.op_count);
             for (triton::uint32 n = 0; n < detail->x86.op_count; n++) {
               triton::extlibs::capstone::cs_x86_op* op = &(detail->x86.operands[n]);
               switch(op->type) {
@@ -788,11 +796,12 @@ namespace triton {
       std::vector<triton::uint8> x8664Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
         std::vector<triton::uint8> area;
 
-        for (triton::usize index = 0; index < size; index++) {
-          if (execCallbacks)
-            triton::api.processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
+        if (execCallbacks)
+          triton::api.processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, baseAddr, size);
+
+        area.reserve(size);
+        for (triton::usize index = 0; index < size; index++)
           area.push_back(this->getConcreteMemoryValue(baseAddr+index));
-        }
 
         return area;
       }
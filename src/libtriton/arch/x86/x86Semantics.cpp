@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+#include <vector>
+
 #include <api.hpp>
 #include <cpuSize.hpp>
 #include <exceptions.hpp>
@@ -27,6 +30,11 @@ engines. When engines will be reliable, we will write the last semantics :-). Ho
 own semantics into the [appropriate file](x86Semantics_8cpp_source.html). Thanks to `wisk` and his
 [Medusa project](https://github.com/wisk/medusa/blob/dev/arch/x86.yaml) which has been really useful.
 
+The semantics are dispatched through a table indexed by instruction id. From C++, a handler can be added for an
+unsupported instruction, or a builtin one overridden, with `triton::arch::x86::semantics::setHandler()` and restored
+with `triton::arch::x86::semantics::resetHandler()`. The table is shared by all threads and must be updated before
+any processing starts.
+
 \subsection SMT_Semantics_Supported_x86 x86 and x86-64 SMT semantics supported
 
 
@@ -299,264 +307,315 @@ namespace triton {
       namespace semantics {
 
 
+        /* The builtin semantics, <instruction id, handler> */
+        static const std::pair<triton::uint32, handler_t> builtinHandlers[] = {
+          {ID_INS_ADC,          triton::arch::x86::semantics::adc_s},
+          {ID_INS_ADD,          triton::arch::x86::semantics::add_s},
+          {ID_INS_AND,          triton::arch::x86::semantics::and_s},
+          {ID_INS_ANDNPD,       triton::arch::x86::semantics::andnpd_s},
+          {ID_INS_ANDNPS,       triton::arch::x86::semantics::andnps_s},
+          {ID_INS_ANDPD,        triton::arch::x86::semantics::andpd_s},
+          {ID_INS_ANDPS,        triton::arch::x86::semantics::andps_s},
+          {ID_INS_BSF,          triton::arch::x86::semantics::bsf_s},
+          {ID_INS_BSR,          triton::arch::x86::semantics::bsr_s},
+          {ID_INS_BSWAP,        triton::arch::x86::semantics::bswap_s},
+          {ID_INS_BT,           triton::arch::x86::semantics::bt_s},
+          {ID_INS_BTC,          triton::arch::x86::semantics::btc_s},
+          {ID_INS_BTR,          triton::arch::x86::semantics::btr_s},
+          {ID_INS_BTS,          triton::arch::x86::semantics::bts_s},
+          {ID_INS_CALL,         triton::arch::x86::semantics::call_s},
+          {ID_INS_CBW,          triton::arch::x86::semantics::cbw_s},
+          {ID_INS_CDQ,          triton::arch::x86::semantics::cdq_s},
+          {ID_INS_CDQE,         triton::arch::x86::semantics::cdqe_s},
+          {ID_INS_CLC,          triton::arch::x86::semantics::clc_s},
+          {ID_INS_CLD,          triton::arch::x86::semantics::cld_s},
+          {ID_INS_CLTS,         triton::arch::x86::semantics::clts_s},
+          {ID_INS_CMC,          triton::arch::x86::semantics::cmc_s},
+          {ID_INS_CMOVA,        triton::arch::x86::semantics::cmova_s},
+          {ID_INS_CMOVAE,       triton::arch::x86::semantics::cmovae_s},
+          {ID_INS_CMOVB,        triton::arch::x86::semantics::cmovb_s},
+          {ID_INS_CMOVBE,       triton::arch::x86::semantics::cmovbe_s},
+          {ID_INS_CMOVE,        triton::arch::x86::semantics::cmove_s},
+          {ID_INS_CMOVG,        triton::arch::x86::semantics::cmovg_s},
+          {ID_INS_CMOVGE,       triton::arch::x86::semantics::cmovge_s},
+          {ID_INS_CMOVL,        triton::arch::x86::semantics::cmovl_s},
+          {ID_INS_CMOVLE,       triton::arch::x86::semantics::cmovle_s},
+          {ID_INS_CMOVNE,       triton::arch::x86::semantics::cmovne_s},
+          {ID_INS_CMOVNO,       triton::arch::x86::semantics::cmovno_s},
+          {ID_INS_CMOVNP,       triton::arch::x86::semantics::cmovnp_s},
+          {ID_INS_CMOVNS,       triton::arch::x86::semantics::cmovns_s},
+          {ID_INS_CMOVO,        triton::arch::x86::semantics::cmovo_s},
+          {ID_INS_CMOVP,        triton::arch::x86::semantics::cmovp_s},
+          {ID_INS_CMOVS,        triton::arch::x86::semantics::cmovs_s},
+          {ID_INS_CMP,          triton::arch::x86::semantics::cmp_s},
+          {ID_INS_CMPSB,        triton::arch::x86::semantics::cmpsb_s},
+          {ID_INS_CMPSD,        triton::arch::x86::semantics::cmpsd_s},
+          {ID_INS_CMPSQ,        triton::arch::x86::semantics::cmpsq_s},
+          {ID_INS_CMPSW,        triton::arch::x86::semantics::cmpsw_s},
+          {ID_INS_CMPXCHG,      triton::arch::x86::semantics::cmpxchg_s},
+          {ID_INS_CMPXCHG16B,   triton::arch::x86::semantics::cmpxchg16b_s},
+          {ID_INS_CMPXCHG8B,    triton::arch::x86::semantics::cmpxchg8b_s},
+          {ID_INS_CPUID,        triton::arch::x86::semantics::cpuid_s},
+          {ID_INS_CQO,          triton::arch::x86::semantics::cqo_s},
+          {ID_INS_CWD,          triton::arch::x86::semantics::cwd_s},
+          {ID_INS_CWDE,         triton::arch::x86::semantics::cwde_s},
+          {ID_INS_DEC,          triton::arch::x86::semantics::dec_s},
+          {ID_INS_DIV,          triton::arch::x86::semantics::div_s},
+          {ID_INS_EXTRACTPS,    triton::arch::x86::semantics::extractps_s},
+          {ID_INS_IDIV,         triton::arch::x86::semantics::idiv_s},
+          {ID_INS_IMUL,         triton::arch::x86::semantics::imul_s},
+          {ID_INS_INC,          triton::arch::x86::semantics::inc_s},
+          {ID_INS_JA,           triton::arch::x86::semantics::ja_s},
+          {ID_INS_JAE,          triton::arch::x86::semantics::jae_s},
+          {ID_INS_JB,           triton::arch::x86::semantics::jb_s},
+          {ID_INS_JBE,          triton::arch::x86::semantics::jbe_s},
+          {ID_INS_JE,           triton::arch::x86::semantics::je_s},
+          {ID_INS_JG,           triton::arch::x86::semantics::jg_s},
+          {ID_INS_JGE,          triton::arch::x86::semantics::jge_s},
+          {ID_INS_JL,           triton::arch::x86::semantics::jl_s},
+          {ID_INS_JLE,          triton::arch::x86::semantics::jle_s},
+          {ID_INS_JMP,          triton::arch::x86::semantics::jmp_s},
+          {ID_INS_JNE,          triton::arch::x86::semantics::jne_s},
+          {ID_INS_JNO,          triton::arch::x86::semantics::jno_s},
+          {ID_INS_JNP,          triton::arch::x86::semantics::jnp_s},
+          {ID_INS_JNS,          triton::arch::x86::semantics::jns_s},
+          {ID_INS_JO,           triton::arch::x86::semantics::jo_s},
+          {ID_INS_JP,           triton::arch::x86::semantics::jp_s},
+          {ID_INS_JS,           triton::arch::x86::semantics::js_s},
+          {ID_INS_LAHF,         triton::arch::x86::semantics::lahf_s},
+          {ID_INS_LDDQU,        triton::arch::x86::semantics::lddqu_s},
+          {ID_INS_LDMXCSR,      triton::arch::x86::semantics::ldmxcsr_s},
+          {ID_INS_LEA,          triton::arch::x86::semantics::lea_s},
+          {ID_INS_LEAVE,        triton::arch::x86::semantics::leave_s},
+          {ID_INS_LODSB,        triton::arch::x86::semantics::lodsb_s},
+          {ID_INS_LODSD,        triton::arch::x86::semantics::lodsd_s},
+          {ID_INS_LODSQ,        triton::arch::x86::semantics::lodsq_s},
+          {ID_INS_LODSW,        triton::arch::x86::semantics::lodsw_s},
+          {ID_INS_MOV,          triton::arch::x86::semantics::mov_s},
+          {ID_INS_MOVABS,       triton::arch::x86::semantics::movabs_s},
+          {ID_INS_MOVAPD,       triton::arch::x86::semantics::movapd_s},
+          {ID_INS_MOVAPS,       triton::arch::x86::semantics::movaps_s},
+          {ID_INS_MOVD,         triton::arch::x86::semantics::movd_s},
+          {ID_INS_MOVDDUP,      triton::arch::x86::semantics::movddup_s},
+          {ID_INS_MOVDQ2Q,      triton::arch::x86::semantics::movdq2q_s},
+          {ID_INS_MOVDQA,       triton::arch::x86::semantics::movdqa_s},
+          {ID_INS_MOVDQU,       triton::arch::x86::semantics::movdqu_s},
+          {ID_INS_MOVHLPS,      triton::arch::x86::semantics::movhlps_s},
+          {ID_INS_MOVHPD,       triton::arch::x86::semantics::movhpd_s},
+          {ID_INS_MOVHPS,       triton::arch::x86::semantics::movhps_s},
+          {ID_INS_MOVLHPS,      triton::arch::x86::semantics::movlhps_s},
+          {ID_INS_MOVLPD,       triton::arch::x86::semantics::movlpd_s},
+          {ID_INS_MOVLPS,       triton::arch::x86::semantics::movlps_s},
+          {ID_INS_MOVMSKPD,     triton::arch::x86::semantics::movmskpd_s},
+          {ID_INS_MOVMSKPS,     triton::arch::x86::semantics::movmskps_s},
+          {ID_INS_MOVNTDQ,      triton::arch::x86::semantics::movntdq_s},
+          {ID_INS_MOVNTI,       triton::arch::x86::semantics::movnti_s},
+          {ID_INS_MOVNTPD,      triton::arch::x86::semantics::movntpd_s},
+          {ID_INS_MOVNTPS,      triton::arch::x86::semantics::movntps_s},
+          {ID_INS_MOVNTQ,       triton::arch::x86::semantics::movntq_s},
+          {ID_INS_MOVQ2DQ,      triton::arch::x86::semantics::movq2dq_s},
+          {ID_INS_MOVQ,         triton::arch::x86::semantics::movq_s},
+          {ID_INS_MOVSB,        triton::arch::x86::semantics::movsb_s},
+          {ID_INS_MOVSD,        triton::arch::x86::semantics::movsd_s},
+          {ID_INS_MOVSHDUP,     triton::arch::x86::semantics::movshdup_s},
+          {ID_INS_MOVSLDUP,     triton::arch::x86::semantics::movsldup_s},
+          {ID_INS_MOVSQ,        triton::arch::x86::semantics::movsq_s},
+          {ID_INS_MOVSW,        triton::arch::x86::semantics::movsw_s},
+          {ID_INS_MOVSX,        triton::arch::x86::semantics::movsx_s},
+          {ID_INS_MOVSXD,       triton::arch::x86::semantics::movsxd_s},
+          {ID_INS_MOVUPD,       triton::arch::x86::semantics::movupd_s},
+          {ID_INS_MOVUPS,       triton::arch::x86::semantics::movups_s},
+          {ID_INS_MOVZX,        triton::arch::x86::semantics::movzx_s},
+          {ID_INS_MUL,          triton::arch::x86::semantics::mul_s},
+          {ID_INS_NEG,          triton::arch::x86::semantics::neg_s},
+          {ID_INS_NOP,          triton::arch::x86::semantics::nop_s},
+          {ID_INS_NOT,          triton::arch::x86::semantics::not_s},
+          {ID_INS_OR,           triton::arch::x86::semantics::or_s},
+          {ID_INS_ORPD,         triton::arch::x86::semantics::orpd_s},
+          {ID_INS_ORPS,         triton::arch::x86::semantics::orps_s},
+          {ID_INS_PADDB,        triton::arch::x86::semantics::paddb_s},
+          {ID_INS_PADDD,        triton::arch::x86::semantics::paddd_s},
+          {ID_INS_PADDQ,        triton::arch::x86::semantics::paddq_s},
+          {ID_INS_PADDW,        triton::arch::x86::semantics::paddw_s},
+          {ID_INS_PAND,         triton::arch::x86::semantics::pand_s},
+          {ID_INS_PANDN,        triton::arch::x86::semantics::pandn_s},
+          {ID_INS_PAVGB,        triton::arch::x86::semantics::pavgb_s},
+          {ID_INS_PAVGW,        triton::arch::x86::semantics::pavgw_s},
+          {ID_INS_PCMPEQB,      triton::arch::x86::semantics::pcmpeqb_s},
+          {ID_INS_PCMPEQD,      triton::arch::x86::semantics::pcmpeqd_s},
+          {ID_INS_PCMPEQW,      triton::arch::x86::semantics::pcmpeqw_s},
+          {ID_INS_PCMPGTB,      triton::arch::x86::semantics::pcmpgtb_s},
+          {ID_INS_PCMPGTD,      triton::arch::x86::semantics::pcmpgtd_s},
+          {ID_INS_PCMPGTW,      triton::arch::x86::semantics::pcmpgtw_s},
+          {ID_INS_PMAXSB,       triton::arch::x86::semantics::pmaxsb_s},
+          {ID_INS_PMAXSD,       triton::arch::x86::semantics::pmaxsd_s},
+          {ID_INS_PMAXSW,       triton::arch::x86::semantics::pmaxsw_s},
+          {ID_INS_PMAXUB,       triton::arch::x86::semantics::pmaxub_s},
+          {ID_INS_PMAXUD,       triton::arch::x86::semantics::pmaxud_s},
+          {ID_INS_PMAXUW,       triton::arch::x86::semantics::pmaxuw_s},
+          {ID_INS_PMINSB,       triton::arch::x86::semantics::pminsb_s},
+          {ID_INS_PMINSD,       triton::arch::x86::semantics::pminsd_s},
+          {ID_INS_PMINSW,       triton::arch::x86::semantics::pminsw_s},
+          {ID_INS_PMINUB,       triton::arch::x86::semantics::pminub_s},
+          {ID_INS_PMINUD,       triton::arch::x86::semantics::pminud_s},
+          {ID_INS_PMINUW,       triton::arch::x86::semantics::pminuw_s},
+          {ID_INS_PMOVMSKB,     triton::arch::x86::semantics::pmovmskb_s},
+          {ID_INS_PMOVSXBD,     triton::arch::x86::semantics::pmovsxbd_s},
+          {ID_INS_PMOVSXBQ,     triton::arch::x86::semantics::pmovsxbq_s},
+          {ID_INS_PMOVSXBW,     triton::arch::x86::semantics::pmovsxbw_s},
+          {ID_INS_PMOVSXDQ,     triton::arch::x86::semantics::pmovsxdq_s},
+          {ID_INS_PMOVSXWD,     triton::arch::x86::semantics::pmovsxwd_s},
+          {ID_INS_PMOVSXWQ,     triton::arch::x86::semantics::pmovsxwq_s},
+          {ID_INS_PMOVZXBD,     triton::arch::x86::semantics::pmovzxbd_s},
+          {ID_INS_PMOVZXBQ,     triton::arch::x86::semantics::pmovzxbq_s},
+          {ID_INS_PMOVZXBW,     triton::arch::x86::semantics::pmovzxbw_s},
+          {ID_INS_PMOVZXDQ,     triton::arch::x86::semantics::pmovzxdq_s},
+          {ID_INS_PMOVZXWD,     triton::arch::x86::semantics::pmovzxwd_s},
+          {ID_INS_PMOVZXWQ,     triton::arch::x86::semantics::pmovzxwq_s},
+          {ID_INS_POP,          triton::arch::x86::semantics::pop_s},
+          {ID_INS_POPAL,        triton::arch::x86::semantics::popal_s},
+          {ID_INS_POPFD,        triton::arch::x86::semantics::popfd_s},
+          {ID_INS_POPFQ,        triton::arch::x86::semantics::popfq_s},
+          {ID_INS_POR,          triton::arch::x86::semantics::por_s},
+          {ID_INS_PREFETCH,     triton::arch::x86::semantics::prefetchx_s},
+          {ID_INS_PREFETCHNTA,  triton::arch::x86::semantics::prefetchx_s},
+          {ID_INS_PREFETCHT0,   triton::arch::x86::semantics::prefetchx_s},
+          {ID_INS_PREFETCHT1,   triton::arch::x86::semantics::prefetchx_s},
+          {ID_INS_PREFETCHT2,   triton::arch::x86::semantics::prefetchx_s},
+          {ID_INS_PREFETCHW,    triton::arch::x86::semantics::prefetchx_s},
+          {ID_INS_PSHUFD,       triton::arch::x86::semantics::pshufd_s},
+          {ID_INS_PSHUFHW,      triton::arch::x86::semantics::pshufhw_s},
+          {ID_INS_PSHUFLW,      triton::arch::x86::semantics::pshuflw_s},
+          {ID_INS_PSHUFW,       triton::arch::x86::semantics::pshufw_s},
+          {ID_INS_PSLLDQ,       triton::arch::x86::semantics::pslldq_s},
+          {ID_INS_PSRLDQ,       triton::arch::x86::semantics::psrldq_s},
+          {ID_INS_PSUBB,        triton::arch::x86::semantics::psubb_s},
+          {ID_INS_PSUBD,        triton::arch::x86::semantics::psubd_s},
+          {ID_INS_PSUBQ,        triton::arch::x86::semantics::psubq_s},
+          {ID_INS_PSUBW,        triton::arch::x86::semantics::psubw_s},
+          {ID_INS_PTEST,        triton::arch::x86::semantics::ptest_s},
+          {ID_INS_PUNPCKHBW,    triton::arch::x86::semantics::punpckhbw_s},
+          {ID_INS_PUNPCKHDQ,    triton::arch::x86::semantics::punpckhdq_s},
+          {ID_INS_PUNPCKHQDQ,   triton::arch::x86::semantics::punpckhqdq_s},
+          {ID_INS_PUNPCKHWD,    triton::arch::x86::semantics::punpckhwd_s},
+          {ID_INS_PUNPCKLBW,    triton::arch::x86::semantics::punpcklbw_s},
+          {ID_INS_PUNPCKLDQ,    triton::arch::x86::semantics::punpckldq_s},
+          {ID_INS_PUNPCKLQDQ,   triton::arch::x86::semantics::punpcklqdq_s},
+          {ID_INS_PUNPCKLWD,    triton::arch::x86::semantics::punpcklwd_s},
+          {ID_INS_PUSH,         triton::arch::x86::semantics::push_s},
+          {ID_INS_PUSHAL,       triton::arch::x86::semantics::pushal_s},
+          {ID_INS_PUSHFD,       triton::arch::x86::semantics::pushfd_s},
+          {ID_INS_PUSHFQ,       triton::arch::x86::semantics::pushfq_s},
+          {ID_INS_PXOR,         triton::arch::x86::semantics::pxor_s},
+          {ID_INS_RCL,          triton::arch::x86::semantics::rcl_s},
+          {ID_INS_RCR,          triton::arch::x86::semantics::rcr_s},
+          {ID_INS_RDTSC,        triton::arch::x86::semantics::rdtsc_s},
+          {ID_INS_RET,          triton::arch::x86::semantics::ret_s},
+          {ID_INS_ROL,          triton::arch::x86::semantics::rol_s},
+          {ID_INS_ROR,          triton::arch::x86::semantics::ror_s},
+          {ID_INS_SAHF,         triton::arch::x86::semantics::sahf_s},
+          {ID_INS_SAL,          triton::arch::x86::semantics::shl_s},
+          {ID_INS_SAR,          triton::arch::x86::semantics::sar_s},
+          {ID_INS_SBB,          triton::arch::x86::semantics::sbb_s},
+          {ID_INS_SCASB,        triton::arch::x86::semantics::scasb_s},
+          {ID_INS_SCASD,        triton::arch::x86::semantics::scasd_s},
+          {ID_INS_SCASQ,        triton::arch::x86::semantics::scasq_s},
+          {ID_INS_SCASW,        triton::arch::x86::semantics::scasw_s},
+          {ID_INS_SETA,         triton::arch::x86::semantics::seta_s},
+          {ID_INS_SETAE,        triton::arch::x86::semantics::setae_s},
+          {ID_INS_SETB,         triton::arch::x86::semantics::setb_s},
+          {ID_INS_SETBE,        triton::arch::x86::semantics::setbe_s},
+          {ID_INS_SETE,         triton::arch::x86::semantics::sete_s},
+          {ID_INS_SETG,         triton::arch::x86::semantics::setg_s},
+          {ID_INS_SETGE,        triton::arch::x86::semantics::setge_s},
+          {ID_INS_SETL,         triton::arch::x86::semantics::setl_s},
+          {ID_INS_SETLE,        triton::arch::x86::semantics::setle_s},
+          {ID_INS_SETNE,        triton::arch::x86::semantics::setne_s},
+          {ID_INS_SETNO,        triton::arch::x86::semantics::setno_s},
+          {ID_INS_SETNP,        triton::arch::x86::semantics::setnp_s},
+          {ID_INS_SETNS,        triton::arch::x86::semantics::setns_s},
+          {ID_INS_SETO,         triton::arch::x86::semantics::seto_s},
+          {ID_INS_SETP,         triton::arch::x86::semantics::setp_s},
+          {ID_INS_SETS,         triton::arch::x86::semantics::sets_s},
+          {ID_INS_SHL,          triton::arch::x86::semantics::shl_s},
+          {ID_INS_SHR,          triton::arch::x86::semantics::shr_s},
+          {ID_INS_STC,          triton::arch::x86::semantics::stc_s},
+          {ID_INS_STD,          triton::arch::x86::semantics::std_s},
+          {ID_INS_STMXCSR,      triton::arch::x86::semantics::stmxcsr_s},
+          {ID_INS_STOSB,        triton::arch::x86::semantics::stosb_s},
+          {ID_INS_STOSD,        triton::arch::x86::semantics::stosd_s},
+          {ID_INS_STOSQ,        triton::arch::x86::semantics::stosq_s},
+          {ID_INS_STOSW,        triton::arch::x86::semantics::stosw_s},
+          {ID_INS_SUB,          triton::arch::x86::semantics::sub_s},
+          {ID_INS_SYSCALL,      triton::arch::x86::semantics::syscall_s},
+          {ID_INS_TEST,         triton::arch::x86::semantics::test_s},
+          {ID_INS_UNPCKHPD,     triton::arch::x86::semantics::unpckhpd_s},
+          {ID_INS_UNPCKHPS,     triton::arch::x86::semantics::unpckhps_s},
+          {ID_INS_UNPCKLPD,     triton::arch::x86::semantics::unpcklpd_s},
+          {ID_INS_UNPCKLPS,     triton::arch::x86::semantics::unpcklps_s},
+          {ID_INS_VMOVDQA,      triton::arch::x86::semantics::vmovdqa_s},
+          {ID_INS_VPAND,        triton::arch::x86::semantics::vpand_s},
+          {ID_INS_VPANDN,       triton::arch::x86::semantics::vpandn_s},
+          {ID_INS_VPOR,         triton::arch::x86::semantics::vpor_s},
+          {ID_INS_VPTEST,       triton::arch::x86::semantics::vptest_s},
+          {ID_INS_VPSHUFD,      triton::arch::x86::semantics::vpshufd_s},
+          {ID_INS_VPXOR,        triton::arch::x86::semantics::vpxor_s},
+          {ID_INS_XADD,         triton::arch::x86::semantics::xadd_s},
+          {ID_INS_XCHG,         triton::arch::x86::semantics::xchg_s},
+          {ID_INS_XOR,          triton::arch::x86::semantics::xor_s},
+          {ID_INS_XORPD,        triton::arch::x86::semantics::xorpd_s},
+          {ID_INS_XORPS,        triton::arch::x86::semantics::xorps_s}
+        };
+
+
+        /*
+         * Dense table indexed by instruction id, built from builtinHandlers. It has the storage of
+         * triton::api, so with TRITON_THREAD_LOCAL_API each thread dispatches through its own table
+         * and an override only applies to the thread which set it.
+         */
+        static std::vector<handler_t>& handlers(void) {
+          static TRITON_API_STORAGE std::vector<handler_t> table = [] {
+            std::vector<handler_t> ret(ID_INST_LAST_ITEM, nullptr);
+            for (triton::usize index = 0; index < sizeof(builtinHandlers) / sizeof(builtinHandlers[0]); index++)
+              ret[builtinHandlers[index].first] = builtinHandlers[index].second;
+            return ret;
+          }();
+          return table;
+        }
+
+
         void build(triton::arch::Instruction& inst) {
-          switch (inst.getType()) {
-            case ID_INS_ADC:            triton::arch::x86::semantics::adc_s(inst);          break;
-            case ID_INS_ADD:            triton::arch::x86::semantics::add_s(inst);          break;
-            case ID_INS_AND:            triton::arch::x86::semantics::and_s(inst);          break;
-            case ID_INS_ANDNPD:         triton::arch::x86::semantics::andnpd_s(inst);       break;
-            case ID_INS_ANDNPS:         triton::arch::x86::semantics::andnps_s(inst);       break;
-            case ID_INS_ANDPD:          triton::arch::x86::semantics::andpd_s(inst);        break;
-            case ID_INS_ANDPS:          triton::arch::x86::semantics::andps_s(inst);        break;
-            case ID_INS_BSF:            triton::arch::x86::semantics::bsf_s(inst);          break;
-            case ID_INS_BSR:            triton::arch::x86::semantics::bsr_s(inst);          break;
-            case ID_INS_BSWAP:          triton::arch::x86::semantics::bswap_s(inst);        break;
-            case ID_INS_BT:             triton::arch::x86::semantics::bt_s(inst);           break;
-            case ID_INS_BTC:            triton::arch::x86::semantics::btc_s(inst);          break;
-            case ID_INS_BTR:            triton::arch::x86::semantics::btr_s(inst);          break;
-            case ID_INS_BTS:            triton::arch::x86::semantics::bts_s(inst);          break;
-            case ID_INS_CALL:           triton::arch::x86::semantics::call_s(inst);         break;
-            case ID_INS_CBW:            triton::arch::x86::semantics::cbw_s(inst);          break;
-            case ID_INS_CDQ:            triton::arch::x86::semantics::cdq_s(inst);          break;
-            case ID_INS_CDQE:           triton::arch::x86::semantics::cdqe_s(inst);         break;
-            case ID_INS_CLC:            triton::arch::x86::semantics::clc_s(inst);          break;
-            case ID_INS_CLD:            triton::arch::x86::semantics::cld_s(inst);          break;
-            case ID_INS_CLTS:           triton::arch::x86::semantics::clts_s(inst);         break;
-            case ID_INS_CMC:            triton::arch::x86::semantics::cmc_s(inst);          break;
-            case ID_INS_CMOVA:          triton::arch::x86::semantics::cmova_s(inst);        break;
-            case ID_INS_CMOVAE:         triton::arch::x86::semantics::cmovae_s(inst);       break;
-            case ID_INS_CMOVB:          triton::arch::x86::semantics::cmovb_s(inst);        break;
-            case ID_INS_CMOVBE:         triton::arch::x86::semantics::cmovbe_s(inst);       break;
-            case ID_INS_CMOVE:          triton::arch::x86::semantics::cmove_s(inst);        break;
-            case ID_INS_CMOVG:          triton::arch::x86::semantics::cmovg_s(inst);        break;
-            case ID_INS_CMOVGE:         triton::arch::x86::semantics::cmovge_s(inst);       break;
-            case ID_INS_CMOVL:          triton::arch::x86::semantics::cmovl_s(inst);        break;
-            case ID_INS_CMOVLE:         triton::arch::x86::semantics::cmovle_s(inst);       break;
-            case ID_INS_CMOVNE:         triton::arch::x86::semantics::cmovne_s(inst);       break;
-            case ID_INS_CMOVNO:         triton::arch::x86::semantics::cmovno_s(inst);       break;
-            case ID_INS_CMOVNP:         triton::arch::x86::semantics::cmovnp_s(inst);       break;
-            case ID_INS_CMOVNS:         triton::arch::x86::semantics::cmovns_s(inst);       break;
-            case ID_INS_CMOVO:          triton::arch::x86::semantics::cmovo_s(inst);        break;
-            case ID_INS_CMOVP:          triton::arch::x86::semantics::cmovp_s(inst);        break;
-            case ID_INS_CMOVS:          triton::arch::x86::semantics::cmovs_s(inst);        break;
-            case ID_INS_CMP:            triton::arch::x86::semantics::cmp_s(inst);          break;
-            case ID_INS_CMPSB:          triton::arch::x86::semantics::cmpsb_s(inst);        break;
-            case ID_INS_CMPSD:          triton::arch::x86::semantics::cmpsd_s(inst);        break;
-            case ID_INS_CMPSQ:          triton::arch::x86::semantics::cmpsq_s(inst);        break;
-            case ID_INS_CMPSW:          triton::arch::x86::semantics::cmpsw_s(inst);        break;
-            case ID_INS_CMPXCHG:        triton::arch::x86::semantics::cmpxchg_s(inst);      break;
-            case ID_INS_CMPXCHG16B:     triton::arch::x86::semantics::cmpxchg16b_s(inst);   break;
-            case ID_INS_CMPXCHG8B:      triton::arch::x86::semantics::cmpxchg8b_s(inst);    break;
-            case ID_INS_CPUID:          triton::arch::x86::semantics::cpuid_s(inst);        break;
-            case ID_INS_CQO:            triton::arch::x86::semantics::cqo_s(inst);          break;
-            case ID_INS_CWD:            triton::arch::x86::semantics::cwd_s(inst);          break;
-            case ID_INS_CWDE:           triton::arch::x86::semantics::cwde_s(inst);         break;
-            case ID_INS_DEC:            triton::arch::x86::semantics::dec_s(inst);          break;
-            case ID_INS_DIV:            triton::arch::x86::semantics::div_s(inst);          break;
-            case ID_INS_EXTRACTPS:      triton::arch::x86::semantics::extractps_s(inst);    break;
-            case ID_INS_IDIV:           triton::arch::x86::semantics::idiv_s(inst);         break;
-            case ID_INS_IMUL:           triton::arch::x86::semantics::imul_s(inst);         break;
-            case ID_INS_INC:            triton::arch::x86::semantics::inc_s(inst);          break;
-            case ID_INS_JA:             triton::arch::x86::semantics::ja_s(inst);           break;
-            case ID_INS_JAE:            triton::arch::x86::semantics::jae_s(inst);          break;
-            case ID_INS_JB:             triton::arch::x86::semantics::jb_s(inst);           break;
-            case ID_INS_JBE:            triton::arch::x86::semantics::jbe_s(inst);          break;
-            case ID_INS_JE:             triton::arch::x86::semantics::je_s(inst);           break;
-            case ID_INS_JG:             triton::arch::x86::semantics::jg_s(inst);           break;
-            case ID_INS_JGE:            triton::arch::x86::semantics::jge_s(inst);          break;
-            case ID_INS_JL:             triton::arch::x86::semantics::jl_s(inst);           break;
-            case ID_INS_JLE:            triton::arch::x86::semantics::jle_s(inst);          break;
-            case ID_INS_JMP:            triton::arch::x86::semantics::jmp_s(inst);          break;
-            case ID_INS_JNE:            triton::arch::x86::semantics::jne_s(inst);          break;
-            case ID_INS_JNO:            triton::arch::x86::semantics::jno_s(inst);          break;
-            case ID_INS_JNP:            triton::arch::x86::semantics::jnp_s(inst);          break;
-            case ID_INS_JNS:            triton::arch::x86::semantics::jns_s(inst);          break;
-            case ID_INS_JO:             triton::arch::x86::semantics::jo_s(inst);           break;
-            case ID_INS_JP:             triton::arch::x86::semantics::jp_s(inst);           break;
-            case ID_INS_JS:             triton::arch::x86::semantics::js_s(inst);           break;
-            case ID_INS_LAHF:           triton::arch::x86::semantics::lahf_s(inst);         break;
-            case ID_INS_LDDQU:          triton::arch::x86::semantics::lddqu_s(inst);        break;
-            case ID_INS_LDMXCSR:        triton::arch::x86::semantics::ldmxcsr_s(inst);      break;
-            case ID_INS_LEA:            triton::arch::x86::semantics::lea_s(inst);          break;
-            case ID_INS_LEAVE:          triton::arch::x86::semantics::leave_s(inst);        break;
-            case ID_INS_LODSB:          triton::arch::x86::semantics::lodsb_s(inst);        break;
-            case ID_INS_LODSD:          triton::arch::x86::semantics::lodsd_s(inst);        break;
-            case ID_INS_LODSQ:          triton::arch::x86::semantics::lodsq_s(inst);        break;
-            case ID_INS_LODSW:          triton::arch::x86::semantics::lodsw_s(inst);        break;
-            case ID_INS_MOV:            triton::arch::x86::semantics::mov_s(inst);          break;
-            case ID_INS_MOVABS:         triton::arch::x86::semantics::movabs_s(inst);       break;
-            case ID_INS_MOVAPD:         triton::arch::x86::semantics::movapd_s(inst);       break;
-            case ID_INS_MOVAPS:         triton::arch::x86::semantics::movaps_s(inst);       break;
-            case ID_INS_MOVD:           triton::arch::x86::semantics::movd_s(inst);         break;
-            case ID_INS_MOVDDUP:        triton::arch::x86::semantics::movddup_s(inst);      break;
-            case ID_INS_MOVDQ2Q:        triton::arch::x86::semantics::movdq2q_s(inst);      break;
-            case ID_INS_MOVDQA:         triton::arch::x86::semantics::movdqa_s(inst);       break;
-            case ID_INS_MOVDQU:         triton::arch::x86::semantics::movdqu_s(inst);       break;
-            case ID_INS_MOVHLPS:        triton::arch::x86::semantics::movhlps_s(inst);      break;
-            case ID_INS_MOVHPD:         triton::arch::x86::semantics::movhpd_s(inst);       break;
-            case ID_INS_MOVHPS:         triton::arch::x86::semantics::movhps_s(inst);       break;
-            case ID_INS_MOVLHPS:        triton::arch::x86::semantics::movlhps_s(inst);      break;
-            case ID_INS_MOVLPD:         triton::arch::x86::semantics::movlpd_s(inst);       break;
-            case ID_INS_MOVLPS:         triton::arch::x86::semantics::movlps_s(inst);       break;
-            case ID_INS_MOVMSKPD:       triton::arch::x86::semantics::movmskpd_s(inst);     break;
-            case ID_INS_MOVMSKPS:       triton::arch::x86::semantics::movmskps_s(inst);     break;
-            case ID_INS_MOVNTDQ:        triton::arch::x86::semantics::movntdq_s(inst);      break;
-            case ID_INS_MOVNTI:         triton::arch::x86::semantics::movnti_s(inst);       break;
-            case ID_INS_MOVNTPD:        triton::arch::x86::semantics::movntpd_s(inst);      break;
-            case ID_INS_MOVNTPS:        triton::arch::x86::semantics::movntps_s(inst);      break;
-            case ID_INS_MOVNTQ:         triton::arch::x86::semantics::movntq_s(inst);       break;
-            case ID_INS_MOVQ2DQ:        triton::arch::x86::semantics::movq2dq_s(inst);      break;
-            case ID_INS_MOVQ:           triton::arch::x86::semantics::movq_s(inst);         break;
-            case ID_INS_MOVSB:          triton::arch::x86::semantics::movsb_s(inst);        break;
-            case ID_INS_MOVSD:          triton::arch::x86::semantics::movsd_s(inst);        break;
-            case ID_INS_MOVSHDUP:       triton::arch::x86::semantics::movshdup_s(inst);     break;
-            case ID_INS_MOVSLDUP:       triton::arch::x86::semantics::movsldup_s(inst);     break;
-            case ID_INS_MOVSQ:          triton::arch::x86::semantics::movsq_s(inst);        break;
-            case ID_INS_MOVSW:          triton::arch::x86::semantics::movsw_s(inst);        break;
-            case ID_INS_MOVSX:          triton::arch::x86::semantics::movsx_s(inst);        break;
-            case ID_INS_MOVSXD:         triton::arch::x86::semantics::movsxd_s(inst);       break;
-            case ID_INS_MOVUPD:         triton::arch::x86::semantics::movupd_s(inst);       break;
-            case ID_INS_MOVUPS:         triton::arch::x86::semantics::movups_s(inst);       break;
-            case ID_INS_MOVZX:          triton::arch::x86::semantics::movzx_s(inst);        break;
-            case ID_INS_MUL:            triton::arch::x86::semantics::mul_s(inst);          break;
-            case ID_INS_NEG:            triton::arch::x86::semantics::neg_s(inst);          break;
-            case ID_INS_NOP:            triton::arch::x86::semantics::nop_s(inst);          break;
-            case ID_INS_NOT:            triton::arch::x86::semantics::not_s(inst);          break;
-            case ID_INS_OR:             triton::arch::x86::semantics::or_s(inst);           break;
-            case ID_INS_ORPD:           triton::arch::x86::semantics::orpd_s(inst);         break;
-            case ID_INS_ORPS:           triton::arch::x86::semantics::orps_s(inst);         break;
-            case ID_INS_PADDB:          triton::arch::x86::semantics::paddb_s(inst);        break;
-            case ID_INS_PADDD:          triton::arch::x86::semantics::paddd_s(inst);        break;
-            case ID_INS_PADDQ:          triton::arch::x86::semantics::paddq_s(inst);        break;
-            case ID_INS_PADDW:          triton::arch::x86::semantics::paddw_s(inst);        break;
-            case ID_INS_PAND:           triton::arch::x86::semantics::pand_s(inst);         break;
-            case ID_INS_PANDN:          triton::arch::x86::semantics::pandn_s(inst);        break;
-            case ID_INS_PAVGB:          triton::arch::x86::semantics::pavgb_s(inst);        break;
-            case ID_INS_PAVGW:          triton::arch::x86::semantics::pavgw_s(inst);        break;
-            case ID_INS_PCMPEQB:        triton::arch::x86::semantics::pcmpeqb_s(inst);      break;
-            case ID_INS_PCMPEQD:        triton::arch::x86::semantics::pcmpeqd_s(inst);      break;
-            case ID_INS_PCMPEQW:        triton::arch::x86::semantics::pcmpeqw_s(inst);      break;
-            case ID_INS_PCMPGTB:        triton::arch::x86::semantics::pcmpgtb_s(inst);      break;
-            case ID_INS_PCMPGTD:        triton::arch::x86::semantics::pcmpgtd_s(inst);      break;
-            case ID_INS_PCMPGTW:        triton::arch::x86::semantics::pcmpgtw_s(inst);      break;
-            case ID_INS_PMAXSB:         triton::arch::x86::semantics::pmaxsb_s(inst);       break;
-            case ID_INS_PMAXSD:         triton::arch::x86::semantics::pmaxsd_s(inst);       break;
-            case ID_INS_PMAXSW:         triton::arch::x86::semantics::pmaxsw_s(inst);       break;
-            case ID_INS_PMAXUB:         triton::arch::x86::semantics::pmaxub_s(inst);       break;
-            case ID_INS_PMAXUD:         triton::arch::x86::semantics::pmaxud_s(inst);       break;
-            case ID_INS_PMAXUW:         triton::arch::x86::semantics::pmaxuw_s(inst);       break;
-            case ID_INS_PMINSB:         triton::arch::x86::semantics::pminsb_s(inst);       break;
-            case ID_INS_PMINSD:         triton::arch::x86::semantics::pminsd_s(inst);       break;
-            case ID_INS_PMINSW:         triton::arch::x86::semantics::pminsw_s(inst);       break;
-            case ID_INS_PMINUB:         triton::arch::x86::semantics::pminub_s(inst);       break;
-            case ID_INS_PMINUD:         triton::arch::x86::semantics::pminud_s(inst);       break;
-            case ID_INS_PMINUW:         triton::arch::x86::semantics::pminuw_s(inst);       break;
-            case ID_INS_PMOVMSKB:       triton::arch::x86::semantics::pmovmskb_s(inst);     break;
-            case ID_INS_PMOVSXBD:       triton::arch::x86::semantics::pmovsxbd_s(inst);     break;
-            case ID_INS_PMOVSXBQ:       triton::arch::x86::semantics::pmovsxbq_s(inst);     break;
-            case ID_INS_PMOVSXBW:       triton::arch::x86::semantics::pmovsxbw_s(inst);     break;
-            case ID_INS_PMOVSXDQ:       triton::arch::x86::semantics::pmovsxdq_s(inst);     break;
-            case ID_INS_PMOVSXWD:       triton::arch::x86::semantics::pmovsxwd_s(inst);     break;
-            case ID_INS_PMOVSXWQ:       triton::arch::x86::semantics::pmovsxwq_s(inst);     break;
-            case ID_INS_PMOVZXBD:       triton::arch::x86::semantics::pmovzxbd_s(inst);     break;
-            case ID_INS_PMOVZXBQ:       triton::arch::x86::semantics::pmovzxbq_s(inst);     break;
-            case ID_INS_PMOVZXBW:       triton::arch::x86::semantics::pmovzxbw_s(inst);     break;
-            case ID_INS_PMOVZXDQ:       triton::arch::x86::semantics::pmovzxdq_s(inst);     break;
-            case ID_INS_PMOVZXWD:       triton::arch::x86::semantics::pmovzxwd_s(inst);     break;
-            case ID_INS_PMOVZXWQ:       triton::arch::x86::semantics::pmovzxwq_s(inst);     break;
-            case ID_INS_POP:            triton::arch::x86::semantics::pop_s(inst);          break;
-            case ID_INS_POPAL:          triton::arch::x86::semantics::popal_s(inst);        break;
-            case ID_INS_POPFD:          triton::arch::x86::semantics::popfd_s(inst);        break;
-            case ID_INS_POPFQ:          triton::arch::x86::semantics::popfq_s(inst);        break;
-            case ID_INS_POR:            triton::arch::x86::semantics::por_s(inst);          break;
-            case ID_INS_PREFETCH:       triton::arch::x86::semantics::prefetchx_s(inst);    break;
-            case ID_INS_PREFETCHNTA:    triton::arch::x86::semantics::prefetchx_s(inst);    break;
-            case ID_INS_PREFETCHT0:     triton::arch::x86::semantics::prefetchx_s(inst);    break;
-            case ID_INS_PREFETCHT1:     triton::arch::x86::semantics::prefetchx_s(inst);    break;
-            case ID_INS_PREFETCHT2:     triton::arch::x86::semantics::prefetchx_s(inst);    break;
-            case ID_INS_PREFETCHW:      triton::arch::x86::semantics::prefetchx_s(inst);    break;
-            case ID_INS_PSHUFD:         triton::arch::x86::semantics::pshufd_s(inst);       break;
-            case ID_INS_PSHUFHW:        triton::arch::x86::semantics::pshufhw_s(inst);      break;
-            case ID_INS_PSHUFLW:        triton::arch::x86::semantics::pshuflw_s(inst);      break;
-            case ID_INS_PSHUFW:         triton::arch::x86::semantics::pshufw_s(inst);       break;
-            case ID_INS_PSLLDQ:         triton::arch::x86::semantics::pslldq_s(inst);       break;
-            case ID_INS_PSRLDQ:         triton::arch::x86::semantics::psrldq_s(inst);       break;
-            case ID_INS_PSUBB:          triton::arch::x86::semantics::psubb_s(inst);        break;
-            case ID_INS_PSUBD:          triton::arch::x86::semantics::psubd_s(inst);        break;
-            case ID_INS_PSUBQ:          triton::arch::x86::semantics::psubq_s(inst);        break;
-            case ID_INS_PSUBW:          triton::arch::x86::semantics::psubw_s(inst);        break;
-            case ID_INS_PTEST:          triton::arch::x86::semantics::ptest_s(inst);        break;
-            case ID_INS_PUNPCKHBW:      triton::arch::x86::semantics::punpckhbw_s(inst);    break;
-            case ID_INS_PUNPCKHDQ:      triton::arch::x86::semantics::punpckhdq_s(inst);    break;
-            case ID_INS_PUNPCKHQDQ:     triton::arch::x86::semantics::punpckhqdq_s(inst);   break;
-            case ID_INS_PUNPCKHWD:      triton::arch::x86::semantics::punpckhwd_s(inst);    break;
-            case ID_INS_PUNPCKLBW:      triton::arch::x86::semantics::punpcklbw_s(inst);    break;
-            case ID_INS_PUNPCKLDQ:      triton::arch::x86::semantics::punpckldq_s(inst);    break;
-            case ID_INS_PUNPCKLQDQ:     triton::arch::x86::semantics::punpcklqdq_s(inst);   break;
-            case ID_INS_PUNPCKLWD:      triton::arch::x86::semantics::punpcklwd_s(inst);    break;
-            case ID_INS_PUSH:           triton::arch::x86::semantics::push_s(inst);         break;
-            case ID_INS_PUSHAL:         triton::arch::x86::semantics::pushal_s(inst);       break;
-            case ID_INS_PUSHFD:         triton::arch::x86::semantics::pushfd_s(inst);       break;
-            case ID_INS_PUSHFQ:         triton::arch::x86::semantics::pushfq_s(inst);       break;
-            case ID_INS_PXOR:           triton::arch::x86::semantics::pxor_s(inst);         break;
-            case ID_INS_RCL:            triton::arch::x86::semantics::rcl_s(inst);          break;
-            case ID_INS_RCR:            triton::arch::x86::semantics::rcr_s(inst);          break;
-            case ID_INS_RDTSC:          triton::arch::x86::semantics::rdtsc_s(inst);        break;
-            case ID_INS_RET:            triton::arch::x86::semantics::ret_s(inst);          break;
-            case ID_INS_ROL:            triton::arch::x86::semantics::rol_s(inst);          break;
-            case ID_INS_ROR:            triton::arch::x86::semantics::ror_s(inst);          break;
-            case ID_INS_SAHF:           triton::arch::x86::semantics::sahf_s(inst);         break;
-            case ID_INS_SAL:            triton::arch::x86::semantics::shl_s(inst);          break;
-            case ID_INS_SAR:            triton::arch::x86::semantics::sar_s(inst);          break;
-            case ID_INS_SBB:            triton::arch::x86::semantics::sbb_s(inst);          break;
-            case ID_INS_SCASB:          triton::arch::x86::semantics::scasb_s(inst);        break;
-            case ID_INS_SCASD:          triton::arch::x86::semantics::scasd_s(inst);        break;
-            case ID_INS_SCASQ:          triton::arch::x86::semantics::scasq_s(inst);        break;
-            case ID_INS_SCASW:          triton::arch::x86::semantics::scasw_s(inst);        break;
-            case ID_INS_SETA:           triton::arch::x86::semantics::seta_s(inst);         break;
-            case ID_INS_SETAE:          triton::arch::x86::semantics::setae_s(inst);        break;
-            case ID_INS_SETB:           triton::arch::x86::semantics::setb_s(inst);         break;
-            case ID_INS_SETBE:          triton::arch::x86::semantics::setbe_s(inst);        break;
-            case ID_INS_SETE:           triton::arch::x86::semantics::sete_s(inst);         break;
-            case ID_INS_SETG:           triton::arch::x86::semantics::setg_s(inst);         break;
-            case ID_INS_SETGE:          triton::arch::x86::semantics::setge_s(inst);        break;
-            case ID_INS_SETL:           triton::arch::x86::semantics::setl_s(inst);         break;
-            case ID_INS_SETLE:          triton::arch::x86::semantics::setle_s(inst);        break;
-            case ID_INS_SETNE:          triton::arch::x86::semantics::setne_s(inst);        break;
-            case ID_INS_SETNO:          triton::arch::x86::semantics::setno_s(inst);        break;
-            case ID_INS_SETNP:          triton::arch::x86::semantics::setnp_s(inst);        break;
-            case ID_INS_SETNS:          triton::arch::x86::semantics::setns_s(inst);        break;
-            case ID_INS_SETO:           triton::arch::x86::semantics::seto_s(inst);         break;
-            case ID_INS_SETP:           triton::arch::x86::semantics::setp_s(inst);         break;
-            case ID_INS_SETS:           triton::arch::x86::semantics::sets_s(inst);         break;
-            case ID_INS_SHL:            triton::arch::x86::semantics::shl_s(inst);          break;
-            case ID_INS_SHR:            triton::arch::x86::semantics::shr_s(inst);          break;
-            case ID_INS_STC:            triton::arch::x86::semantics::stc_s(inst);          break;
-            case ID_INS_STD:            triton::arch::x86::semantics::std_s(inst);          break;
-            case ID_INS_STMXCSR:        triton::arch::x86::semantics::stmxcsr_s(inst);      break;
-            case ID_INS_STOSB:          triton::arch::x86::semantics::stosb_s(inst);        break;
-            case ID_INS_STOSD:          triton::arch::x86::semantics::stosd_s(inst);        break;
-            case ID_INS_STOSQ:          triton::arch::x86::semantics::stosq_s(inst);        break;
-            case ID_INS_STOSW:          triton::arch::x86::semantics::stosw_s(inst);        break;
-            case ID_INS_SUB:            triton::arch::x86::semantics::sub_s(inst);          break;
-            case ID_INS_SYSCALL:        triton::arch::x86::semantics::syscall_s(inst);      break;
-            case ID_INS_TEST:           triton::arch::x86::semantics::test_s(inst);         break;
-            case ID_INS_UNPCKHPD:       triton::arch::x86::semantics::unpckhpd_s(inst);     break;
-            case ID_INS_UNPCKHPS:       triton::arch::x86::semantics::unpckhps_s(inst);     break;
-            case ID_INS_UNPCKLPD:       triton::arch::x86::semantics::unpcklpd_s(inst);     break;
-            case ID_INS_UNPCKLPS:       triton::arch::x86::semantics::unpcklps_s(inst);     break;
-            case ID_INS_VMOVDQA:        triton::arch::x86::semantics::vmovdqa_s(inst);      break;
-            case ID_INS_VPAND:          triton::arch::x86::semantics::vpand_s(inst);        break;
-            case ID_INS_VPANDN:         triton::arch::x86::semantics::vpandn_s(inst);       break;
-            case ID_INS_VPOR:           triton::arch::x86::semantics::vpor_s(inst);         break;
-            case ID_INS_VPTEST:         triton::arch::x86::semantics::vptest_s(inst);       break;
-            case ID_INS_VPSHUFD:        triton::arch::x86::semantics::vpshufd_s(inst);      break;
-            case ID_INS_VPXOR:          triton::arch::x86::semantics::vpxor_s(inst);        break;
-            case ID_INS_XADD:           triton::arch::x86::semantics::xadd_s(inst);         break;
-            case ID_INS_XCHG:           triton::arch::x86::semantics::xchg_s(inst);         break;
-            case ID_INS_XOR:            triton::arch::x86::semantics::xor_s(inst);          break;
-            case ID_INS_XORPD:          triton::arch::x86::semantics::xorpd_s(inst);        break;
-            case ID_INS_XORPS:          triton::arch::x86::semantics::xorps_s(inst);        break;
+          handler_t handler = getHandler(inst.getType());
+          if (handler)
+            handler(inst);
+        }
+
+
+        handler_t getHandler(triton::uint32 id) {
+          std::vector<handler_t>& table = handlers();
+          if (id >= table.size())
+            return nullptr;
+          return table[id];
+        }
+
+
+        void setHandler(triton::uint32 id, handler_t handler) {
+          std::vector<handler_t>& table = handlers();
+          if (id == ID_INST_INVALID || id >= table.size())
+            throw triton::exceptions::Semantics("triton::arch::x86::semantics::setHandler(): Invalid instruction id.");
+          table[id] = handler;
+        }
+
+
+        void resetHandler(triton::uint32 id) {
+          std::vector<handler_t>& table = handlers();
+          if (id == ID_INST_INVALID || id >= table.size())
+            throw triton::exceptions::Semantics("triton::arch::x86::semantics::resetHandler(): Invalid instruction id.");
+
+          table[id] = nullptr;
+          for (triton::usize index = 0; index < sizeof(builtinHandlers) / sizeof(builtinHandlers[0]); index++) {
+            if (builtinHandlers[index].first == id)
+              table[id] = builtinHandlers[index].second;
           }
         }
 
@@ -730,6 +789,261 @@ namespace triton {
         }
 
 
+        /* Returns true if the register holds an expression which contains a symbolic variable */
+        static bool isRegisterSymbolized(const triton::arch::Register& reg) {
+          triton::usize id = triton::api.getSymbolicRegisterId(reg);
+          if (id == triton::engines::symbolic::UNSET)
+            return false;
+          return triton::api.getSymbolicExpressionFromId(id)->isSymbolized();
+        }
+
+
+        /* Returns the counter of a string instruction, ECX or CX with an address-size prefix (0x67) */
+        static triton::arch::Register repCounter(triton::arch::Instruction& inst) {
+          for (triton::usize index = 0; index < inst.operands.size(); index++) {
+            if (inst.operands[index].getType() != triton::arch::OP_MEM)
+              continue;
+
+            switch (inst.operands[index].getConstMemory().getConstBaseRegister().getSize()) {
+              case WORD_SIZE:  return TRITON_X86_REG_CX;
+              case DWORD_SIZE: return TRITON_X86_REG_ECX;
+              default:         break;
+            }
+          }
+          return TRITON_X86_REG_CX.getParent();
+        }
+
+
+        triton::uint64 repCount_s(triton::arch::Instruction& inst, triton::uint32 size) {
+          if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::BULK_STRING_OPERATIONS))
+            return 0;
+
+          if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_REP)
+            return 0;
+
+          /* The number of iterations and the direction must be known */
+          triton::arch::Register counter = repCounter(inst);
+          if (isRegisterSymbolized(counter) || isRegisterSymbolized(TRITON_X86_REG_DF))
+            return 0;
+
+          /* Above the limit (e.g. a garbage counter), the iterations are processed one by one */
+          triton::uint64 count = triton::api.getConcreteRegisterValue(counter).convert_to<triton::uint64>();
+          if (triton::uint512(count) * size > triton::arch::x86::semantics::REP_BULK_MAX_SIZE)
+            return 0;
+
+          /* The accessed ranges must not wrap around the address space */
+          bool backward        = (triton::api.getConcreteRegisterValue(TRITON_X86_REG_DF) != 0);
+          triton::uint512 span = triton::uint512(count) * size;
+          triton::uint512 top  = triton::uint512(1) << (counter.getBitSize());
+          for (triton::usize index = 0; index < inst.operands.size(); index++) {
+            if (inst.operands[index].getType() != triton::arch::OP_MEM)
+              continue;
+
+            /* The index registers are the base registers of the memory operands */
+            if (inst.operands[index].getConstMemory().getConstBaseRegister().getId() == triton::arch::x86::ID_REG_INVALID)
+              return 0;
+
+            triton::uint512 addr = inst.operands[index].getConstMemory().getAddress();
+            if (backward ? (addr + size < span) : (addr + span > top))
+              return 0;
+          }
+
+          return count;
+        }
+
+
+        void repIndex_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& index, triton::uint64 delta, bool backward, const std::string& comment) {
+          auto op1  = triton::api.buildSymbolicOperand(inst, index);
+          auto op2  = triton::ast::bv(delta, index.getBitSize());
+          auto node = backward ? triton::ast::bvsub(op1, op2) : triton::ast::bvadd(op1, op2);
+          auto expr = triton::api.createSymbolicExpression(inst, node, index, comment);
+          expr->isTainted = triton::api.taintUnion(index, index);
+        }
+
+
+        void repControlFlow_s(triton::arch::Instruction& inst) {
+          auto pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC.getParent());
+          auto counter = triton::arch::OperandWrapper(repCounter(inst));
+
+          /* All the iterations are done, the counter is zero and the execution goes on */
+          auto expr1 = triton::api.createSymbolicExpression(inst, triton::ast::bv(0, counter.getBitSize()), counter, "Counter operation");
+          auto expr2 = triton::api.createSymbolicExpression(inst, triton::ast::bv(inst.getNextAddress(), pc.getBitSize()), pc, "Program Counter");
+
+          expr1->isTainted = triton::api.taintUnion(counter, counter);
+          expr2->isTainted = triton::api.taintAssignment(pc, counter);
+        }
+
+
+        /* Records the concrete memory accesses of a range processed in a single step, by chunks of at most 64 bytes */
+        static void repAccess(triton::arch::Instruction& inst, triton::uint64 addr, triton::usize length, bool store) {
+          while (length) {
+            triton::uint32 size = DQQWORD_SIZE;
+            while (size > length)
+              size >>= 1;
+
+            triton::arch::MemoryAccess mem(addr, size);
+            mem.setConcreteValue(triton::api.getConcreteMemoryValue(mem, false));
+
+            auto node = triton::ast::bv(mem.getConcreteValue(), mem.getBitSize());
+            if (store)
+              inst.setStoreAccess(mem, node);
+            else
+              inst.setLoadAccess(mem, node);
+
+            addr   += size;
+            length -= size;
+          }
+        }
+
+
+        /*
+         * Copies a range in a single step, the whole source is read before the destination is written.
+         * Only the symbolized cells get an expression, a reference to their source cell.
+         */
+        static void repCopy(triton::arch::Instruction& inst, triton::uint64 dst, triton::uint64 src, triton::usize length, const std::string& comment) {
+          std::vector<std::pair<triton::usize, triton::usize>> symbolized;
+          std::vector<bool> tainted(length);
+
+          for (triton::usize index = 0; index < length; index++) {
+            triton::usize id = triton::api.getSymbolicMemoryId(src + index);
+            if (id != triton::engines::symbolic::UNSET && triton::api.getSymbolicExpressionFromId(id)->isSymbolized())
+              symbolized.push_back(std::make_pair(index, id));
+            tainted[index] = triton::api.isMemoryTainted(src + index);
+          }
+
+          repAccess(inst, src, length, false);
+          triton::api.setConcreteMemoryAreaValue(dst, triton::api.getConcreteMemoryAreaValue(src, length, false));
+
+          for (triton::usize index = 0; index < length; index++) {
+            triton::api.concretizeMemory(dst + index);
+            if (tainted[index])
+              triton::api.taintMemory(dst + index);
+            else
+              triton::api.untaintMemory(dst + index);
+          }
+
+          repAccess(inst, dst, length, true);
+
+          for (std::vector<std::pair<triton::usize, triton::usize>>::iterator it = symbolized.begin(); it != symbolized.end(); it++) {
+            triton::arch::MemoryAccess mem(dst + it->first, BYTE_SIZE);
+            auto expr = triton::api.createSymbolicMemoryExpression(inst, triton::ast::reference(it->second), mem, comment);
+            expr->isTainted = tainted[it->first];
+          }
+        }
+
+
+        bool repMovs_s(triton::arch::Instruction& inst, triton::uint32 size, const std::string& comment) {
+          triton::uint64 count = triton::arch::x86::semantics::repCount_s(inst, size);
+          if (count == 0)
+            return false;
+
+          auto index1   = triton::arch::OperandWrapper(inst.operands[0].getConstMemory().getConstBaseRegister());
+          auto index2   = triton::arch::OperandWrapper(inst.operands[1].getConstMemory().getConstBaseRegister());
+          bool backward = (triton::api.getConcreteRegisterValue(TRITON_X86_REG_DF) != 0);
+          auto length   = count * size;
+          auto dstLow   = inst.operands[0].getMemory().getAddress();
+          auto srcLow   = inst.operands[1].getMemory().getAddress();
+
+          if (backward) {
+            dstLow -= length - size;
+            srcLow -= length - size;
+          }
+
+          /*
+           * When the destination is ahead of the source in the direction of the copy, the iterations read
+           * the previous stores (e.g. a pattern fill), they are replayed one by one. Otherwise, the whole
+           * range is copied at once.
+           */
+          bool ahead = backward ? (dstLow < srcLow && srcLow < dstLow + length) : (srcLow < dstLow && dstLow < srcLow + length);
+          if (!ahead)
+            repCopy(inst, dstLow, srcLow, length, comment);
+
+          for (triton::uint64 iteration = 0; ahead && iteration < count; iteration++) {
+            triton::uint64 offset = backward ? length - size - iteration * size : iteration * size;
+            repCopy(inst, dstLow + offset, srcLow + offset, size, comment);
+          }
+
+          triton::arch::x86::semantics::repIndex_s(inst, index1, length, backward, "Index (DI) operation");
+          triton::arch::x86::semantics::repIndex_s(inst, index2, length, backward, "Index (SI) operation");
+          triton::arch::x86::semantics::repControlFlow_s(inst);
+          return true;
+        }
+
+
+        bool repStos_s(triton::arch::Instruction& inst, triton::uint32 size, const std::string& comment) {
+          triton::uint64 count = triton::arch::x86::semantics::repCount_s(inst, size);
+          if (count == 0)
+            return false;
+
+          auto& src     = inst.operands[1];
+          auto  index   = triton::arch::OperandWrapper(inst.operands[0].getConstMemory().getConstBaseRegister());
+          bool backward = (triton::api.getConcreteRegisterValue(TRITON_X86_REG_DF) != 0);
+          bool tainted  = triton::api.isRegisterTainted(src.getConstRegister());
+          auto length   = count * size;
+          auto dstAddr  = inst.operands[0].getMemory().getAddress();
+          auto lowAddr  = backward ? dstAddr - (length - size) : dstAddr;
+
+          /* The value fills the whole range at once */
+          std::vector<triton::uint8> area(length);
+          triton::uint512 value = triton::api.getConcreteRegisterValue(src.getConstRegister());
+          for (triton::usize index = 0; index < area.size(); index++)
+            area[index] = ((value >> ((index % size) * BYTE_SIZE_BIT)) & 0xff).convert_to<triton::uint8>();
+
+          triton::api.setConcreteMemoryAreaValue(lowAddr, area);
+          for (triton::usize index = 0; index < length; index++) {
+            triton::api.concretizeMemory(lowAddr + index);
+            if (tainted)
+              triton::api.taintMemory(lowAddr + index);
+            else
+              triton::api.untaintMemory(lowAddr + index);
+          }
+          repAccess(inst, lowAddr, length, true);
+
+          /* A symbolized value gives an expression to each cell, the bytes of the value are extracted once */
+          if (isRegisterSymbolized(src.getConstRegister())) {
+            std::vector<triton::ast::AbstractNode*> bytes(size);
+            auto node = triton::api.buildSymbolicOperand(inst, src);
+            for (triton::uint32 byte = 0; byte < size; byte++)
+              bytes[byte] = (size == BYTE_SIZE) ? node : triton::ast::extract(((byte + 1) * BYTE_SIZE_BIT) - 1, byte * BYTE_SIZE_BIT, node);
+
+            for (triton::usize index = 0; index < length; index++) {
+              triton::arch::MemoryAccess mem(lowAddr + index, BYTE_SIZE);
+              auto expr = triton::api.createSymbolicMemoryExpression(inst, bytes[index % size], mem, comment);
+              expr->isTainted = tainted;
+            }
+          }
+
+          triton::arch::x86::semantics::repIndex_s(inst, index, length, backward, "Index operation");
+          triton::arch::x86::semantics::repControlFlow_s(inst);
+          return true;
+        }
+
+
+        bool repLods_s(triton::arch::Instruction& inst, triton::uint32 size, const std::string& comment) {
+          triton::uint64 count = triton::arch::x86::semantics::repCount_s(inst, size);
+          if (count == 0)
+            return false;
+
+          auto& dst     = inst.operands[0];
+          auto  index   = triton::arch::OperandWrapper(inst.operands[1].getConstMemory().getConstBaseRegister());
+          bool backward = (triton::api.getConcreteRegisterValue(TRITON_X86_REG_DF) != 0);
+          auto srcAddr  = inst.operands[1].getMemory().getAddress();
+          auto offset   = (count - 1) * size;
+
+          /* The previous loads are only recorded, only the last one is visible in the destination register */
+          repAccess(inst, backward ? srcAddr - offset + size : srcAddr, offset, false);
+
+          auto src  = triton::arch::OperandWrapper(triton::arch::MemoryAccess(backward ? srcAddr - offset : srcAddr + offset, size));
+          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto expr = triton::api.createSymbolicExpression(inst, node, dst, comment);
+          expr->isTainted = triton::api.taintAssignment(dst, src);
+
+          triton::arch::x86::semantics::repIndex_s(inst, index, count * size, backward, "Index operation");
+          triton::arch::x86::semantics::repControlFlow_s(inst);
+          return true;
+        }
+
+
         void af_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol) {
           auto bvSize = dst.getBitSize();
           auto low    = vol ? 0 : dst.getAbstractLow();
@@ -4836,6 +5150,10 @@ namespace triton {
 
 
         void lodsb_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repLods_s(inst, BYTE_SIZE, "LODSB operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
@@ -4868,6 +5186,10 @@ namespace triton {
 
 
         void lodsd_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repLods_s(inst, DWORD_SIZE, "LODSD operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
@@ -4900,6 +5222,10 @@ namespace triton {
 
 
         void lodsq_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repLods_s(inst, QWORD_SIZE, "LODSQ operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
@@ -4932,6 +5258,10 @@ namespace triton {
 
 
         void lodsw_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repLods_s(inst, WORD_SIZE, "LODSW operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
@@ -5564,6 +5894,10 @@ namespace triton {
 
 
         void movsb_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repMovs_s(inst, BYTE_SIZE, "MOVSB operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -5605,6 +5939,10 @@ namespace triton {
 
 
         void movsd_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repMovs_s(inst, DWORD_SIZE, "MOVSD operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -5682,6 +6020,10 @@ namespace triton {
 
 
         void movsq_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repMovs_s(inst, QWORD_SIZE, "MOVSQ operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -5723,6 +6065,10 @@ namespace triton {
 
 
         void movsw_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repMovs_s(inst, WORD_SIZE, "MOVSW operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -9988,6 +10334,10 @@ namespace triton {
 
 
         void stosb_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repStos_s(inst, BYTE_SIZE, "STOSB operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -10020,6 +10370,10 @@ namespace triton {
 
 
         void stosd_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repStos_s(inst, DWORD_SIZE, "STOSD operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -10052,6 +10406,10 @@ namespace triton {
 
 
         void stosq_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repStos_s(inst, QWORD_SIZE, "STOSQ operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
@@ -10084,6 +10442,10 @@ namespace triton {
 
 
         void stosw_s(triton::arch::Instruction& inst) {
+          /* A REP prefix with a concrete counter is processed in a single step */
+          if (triton::arch::x86::semantics::repStos_s(inst, WORD_SIZE, "STOSW operation"))
+            return;
+
           auto& dst    = inst.operands[0];
           auto& src    = inst.operands[1];
           auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
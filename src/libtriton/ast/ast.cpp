@@ -5,7 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 
 #include <api.hpp>
 #include <ast.hpp>
@@ -25,6 +27,7 @@ namespace triton {
       this->kind        = kind;
       this->size        = 0;
       this->symbolized  = false;
+      this->variables   = nullptr;
     }
 
 
@@ -33,6 +36,7 @@ namespace triton {
       this->kind        = UNDEFINED_NODE;
       this->size        = 0;
       this->symbolized  = false;
+      this->variables   = nullptr;
     }
 
 
@@ -42,6 +46,9 @@ namespace triton {
       this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
+      this->variables   = nullptr;
+
+      this->setVariables(copy.variables);
 
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
@@ -82,6 +89,78 @@ namespace triton {
     }
 
 
+    const std::vector<triton::usize>& AbstractNode::getVariables(void) const {
+      static const std::vector<triton::usize> empty;
+
+      if (this->variables == nullptr)
+        return empty;
+
+      return *this->variables;
+    }
+
+
+    bool AbstractNode::hasVariable(triton::usize symVarId) const {
+      if (this->variables == nullptr)
+        return false;
+      return std::binary_search(this->variables->begin(), this->variables->end(), symVarId);
+    }
+
+
+    void AbstractNode::spreadVariables(void) {
+      const std::vector<triton::usize>* shared = nullptr;
+      std::vector<triton::usize> merged;
+      std::vector<triton::usize> tmp;
+
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        const std::vector<triton::usize>* vars = this->childs[index]->variables;
+
+        if (vars == nullptr || vars == shared)
+          continue;
+
+        if (shared == nullptr && merged.empty()) {
+          shared = vars;
+          continue;
+        }
+
+        /* Most of the time, a child holds the variables of all the others */
+        const std::vector<triton::usize>& current = (shared != nullptr) ? *shared : merged;
+        if (std::includes(vars->begin(), vars->end(), current.begin(), current.end())) {
+          shared = vars;
+          merged.clear();
+          continue;
+        }
+
+        if (std::includes(current.begin(), current.end(), vars->begin(), vars->end()))
+          continue;
+
+        /* Only the final union is recorded */
+        tmp.clear();
+        std::set_union(current.begin(), current.end(), vars->begin(), vars->end(), std::back_inserter(tmp));
+        merged.swap(tmp);
+        shared = nullptr;
+      }
+
+      if (shared == nullptr && !merged.empty())
+        shared = triton::api.recordVariableSet(merged);
+
+      this->setVariables(shared);
+    }
+
+
+    void AbstractNode::setVariables(const std::vector<triton::usize>* variables) {
+      if (variables == this->variables)
+        return;
+
+      if (variables != nullptr)
+        triton::api.acquireVariableSet(variables);
+
+      if (this->variables != nullptr)
+        triton::api.releaseVariableSet(this->variables);
+
+      this->variables = variables;
+    }
+
+
     triton::uint512 AbstractNode::evaluate(void) const {
       return this->eval;
     }
@@ -97,17 +176,27 @@ namespace triton {
     }
 
 
+    /*
+     * The nodes of a frozen state are shared by the querying threads. A node built while the
+     * state is frozen is thus not recorded as a parent of its childs.
+     */
     void AbstractNode::setParent(AbstractNode* p) {
+      if (triton::api.isFrozen())
+        return;
       this->parents.insert(p);
     }
 
 
     void AbstractNode::removeParent(AbstractNode* p) {
+      if (triton::api.isFrozen())
+        return;
       this->parents.erase(p);
     }
 
 
     void AbstractNode::setParent(std::set<AbstractNode*>& p) {
+      if (triton::api.isFrozen())
+        return;
       for (std::set<AbstractNode*>::iterator it = p.begin(); it != p.end(); it++)
         this->parents.insert(*it);
     }
@@ -125,6 +214,9 @@ namespace triton {
       if (child == nullptr)
         throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
 
+      if (triton::api.isFrozen())
+        throw triton::exceptions::Ast("AbstractNode::setChild(): The state is frozen, its nodes cannot be modified.");
+
       /* Setup the parent of the child */
       child->setParent(this);
 
@@ -141,6 +233,64 @@ namespace triton {
     }
 
 
+    /* ====== array */
+
+
+    ArrayNode::ArrayNode(triton::uint32 indexSize) {
+      this->kind = ARRAY_NODE;
+      this->addChild(triton::ast::decimal(indexSize));
+      this->init();
+    }
+
+
+    ArrayNode::ArrayNode(const ArrayNode& copy) : AbstractNode(copy) {
+    }
+
+
+    ArrayNode::~ArrayNode() {
+    }
+
+
+    void ArrayNode::init(void) {
+      if (this->childs.size() < 1)
+        throw triton::exceptions::Ast("ArrayNode::init(): Must take at least one child.");
+
+      if (this->childs[0]->getKind() != DECIMAL_NODE)
+        throw triton::exceptions::Ast("ArrayNode::init(): The indexSize must be a DECIMAL_NODE.");
+
+      /* Init attributes, the content of the array is unknown */
+      this->size       = 0;
+      this->eval       = 0;
+      this->symbolized = true;
+
+      /* Init childs */
+      this->childs[0]->setParent(this);
+
+      /* Init parents */
+      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
+        (*it)->init();
+    }
+
+
+    void ArrayNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 ArrayNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * this->childs[index]->hash(deep+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
+    triton::uint32 ArrayNode::getIndexSize(void) {
+      return reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
+    }
+
+
     /* ====== assert */
 
 
@@ -172,6 +322,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -228,6 +379,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -284,6 +436,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -373,6 +526,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -437,6 +591,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -493,6 +648,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -549,6 +705,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -605,6 +762,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -657,6 +815,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -713,6 +872,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -765,6 +925,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -821,6 +982,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -893,6 +1055,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -964,6 +1127,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1033,6 +1197,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1096,6 +1261,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1159,6 +1325,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1215,6 +1382,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1278,6 +1446,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1341,6 +1510,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1408,6 +1578,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1475,6 +1646,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1531,6 +1703,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1591,6 +1764,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1647,6 +1821,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1703,6 +1878,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1759,6 +1935,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1815,6 +1992,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1875,6 +2053,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1931,6 +2110,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -1987,6 +2167,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2055,6 +2236,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2108,6 +2290,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2186,6 +2369,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2292,6 +2476,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2345,6 +2530,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2398,6 +2584,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2467,6 +2654,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2524,6 +2712,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2556,6 +2745,14 @@ namespace triton {
     }
 
 
+    LandNode::LandNode(std::vector<AbstractNode*> exprs) {
+      this->kind = LAND_NODE;
+      for (triton::uint32 index = 0; index < exprs.size(); index++)
+        this->addChild(exprs[index]);
+      this->init();
+    }
+
+
     LandNode::LandNode(const LandNode& copy) : AbstractNode(copy) {
     }
 
@@ -2570,13 +2767,15 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
+      this->eval = 1;
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->eval = this->eval && this->childs[index]->evaluate();
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2634,6 +2833,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2686,6 +2886,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2739,6 +2940,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2785,11 +2987,13 @@ namespace triton {
         this->eval        = 0;
         this->size        = 0;
         this->symbolized  = false;
+        this->setVariables(nullptr);
       }
       else {
         this->eval        = triton::api.getAstFromId(this->value)->evaluate();
         this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
         this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
+        this->setVariables(triton::api.getAstFromId(this->value)->getVariables().empty() ? nullptr : &triton::api.getAstFromId(this->value)->getVariables());
 
         triton::api.getAstFromId(this->value)->setParent(this);
       }
@@ -2816,6 +3020,138 @@ namespace triton {
     }
 
 
+    /* ====== select */
+
+
+    SelectNode::SelectNode(AbstractNode* array, AbstractNode* index) {
+      this->kind = SELECT_NODE;
+      this->addChild(array);
+      this->addChild(index);
+      this->init();
+    }
+
+
+    SelectNode::SelectNode(const SelectNode& copy) : AbstractNode(copy) {
+    }
+
+
+    SelectNode::~SelectNode() {
+    }
+
+
+    void SelectNode::init(void) {
+      AbstractNode* array = nullptr;
+      triton::uint512 addr = 0;
+
+      if (this->childs.size() < 2)
+        throw triton::exceptions::Ast("SelectNode::init(): Must take at least two childs.");
+
+      if (this->childs[0]->getKind() != ARRAY_NODE && this->childs[0]->getKind() != STORE_NODE)
+        throw triton::exceptions::Ast("SelectNode::init(): The array must be an ARRAY_NODE or a STORE_NODE.");
+
+      /* Init attributes */
+      this->size = BYTE_SIZE_BIT;
+      addr       = this->childs[1]->evaluate();
+
+      /* The last store at the same index wins, otherwise the concrete memory holds the byte */
+      for (array = this->childs[0]; array->getKind() == STORE_NODE; array = array->getChilds()[0]) {
+        if (array->getChilds()[1]->evaluate() == addr)
+          break;
+      }
+
+      if (array->getKind() == STORE_NODE)
+        this->eval = array->getChilds()[2]->evaluate();
+      else
+        this->eval = triton::api.getConcreteMemoryValue(addr.convert_to<triton::uint64>());
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+      this->spreadVariables();
+
+      /* Init parents */
+      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
+        (*it)->init();
+    }
+
+
+    void SelectNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 SelectNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
+    /* ====== store */
+
+
+    StoreNode::StoreNode(AbstractNode* array, AbstractNode* index, AbstractNode* expr) {
+      this->kind = STORE_NODE;
+      this->addChild(array);
+      this->addChild(index);
+      this->addChild(expr);
+      this->init();
+    }
+
+
+    StoreNode::StoreNode(const StoreNode& copy) : AbstractNode(copy) {
+    }
+
+
+    StoreNode::~StoreNode() {
+    }
+
+
+    void StoreNode::init(void) {
+      if (this->childs.size() < 3)
+        throw triton::exceptions::Ast("StoreNode::init(): Must take at least three childs.");
+
+      if (this->childs[0]->getKind() != ARRAY_NODE && this->childs[0]->getKind() != STORE_NODE)
+        throw triton::exceptions::Ast("StoreNode::init(): The array must be an ARRAY_NODE or a STORE_NODE.");
+
+      if (this->childs[2]->getBitvectorSize() != BYTE_SIZE_BIT)
+        throw triton::exceptions::Ast("StoreNode::init(): The stored value must be a byte.");
+
+      /* Init attributes, the stores are evaluated by the select nodes */
+      this->size = 0;
+      this->eval = 0;
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+      this->spreadVariables();
+
+      /* Init parents */
+      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
+        (*it)->init();
+    }
+
+
+    void StoreNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 StoreNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
     /* ====== String node */
 
 
@@ -2908,6 +3244,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -2956,6 +3293,7 @@ namespace triton {
         this->size        = symVar->getSize();
         this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
         this->symbolized  = true;
+        this->setVariables(triton::api.recordVariableSet(std::vector<triton::usize>(1, symVar->getId())));
       }
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
@@ -3027,6 +3365,7 @@ namespace triton {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
+      this->spreadVariables();
 
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
@@ -3120,6 +3459,14 @@ namespace triton {
 namespace triton {
   namespace ast {
 
+    AbstractNode* array(triton::uint32 indexSize) {
+      AbstractNode* node = new ArrayNode(indexSize);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::api.recordAstNode(node);
+    }
+
+
     AbstractNode* assert_(AbstractNode* expr) {
       AbstractNode* node = new AssertNode(expr);
       if (node == nullptr)
@@ -3137,7 +3484,11 @@ namespace triton {
 
 
     AbstractNode* bvadd(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvaddNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvadd(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvaddNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3145,7 +3496,11 @@ namespace triton {
 
 
     AbstractNode* bvand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvandNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvand(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3177,7 +3532,11 @@ namespace triton {
 
 
     AbstractNode* bvlshr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvlshrNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvlshr(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvlshrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3185,7 +3544,11 @@ namespace triton {
 
 
     AbstractNode* bvmul(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvmulNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvmul(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvmulNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3201,7 +3564,11 @@ namespace triton {
 
 
     AbstractNode* bvneg(AbstractNode* expr) {
-      AbstractNode* node = new BvnegNode(expr);
+      AbstractNode* node = triton::api.getAstRules()->bvneg(expr);
+      if (node != nullptr)
+        return node;
+
+      node = new BvnegNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3217,7 +3584,11 @@ namespace triton {
 
 
     AbstractNode* bvnot(AbstractNode* expr) {
-      AbstractNode* node = new BvnotNode(expr);
+      AbstractNode* node = triton::api.getAstRules()->bvnot(expr);
+      if (node != nullptr)
+        return node;
+
+      node = new BvnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3225,7 +3596,11 @@ namespace triton {
 
 
     AbstractNode* bvor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvorNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvor(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3289,7 +3664,11 @@ namespace triton {
 
 
     AbstractNode* bvshl(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvshlNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvshl(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvshlNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3329,7 +3708,11 @@ namespace triton {
 
 
     AbstractNode* bvsub(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsubNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvsub(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvsubNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3401,7 +3784,11 @@ namespace triton {
 
 
     AbstractNode* bvxor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvxorNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->bvxor(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new BvxorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3417,7 +3804,11 @@ namespace triton {
 
 
     AbstractNode* concat(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new ConcatNode(expr1, expr2);
+      AbstractNode* node = triton::api.getAstRules()->concat(expr1, expr2);
+      if (node != nullptr)
+        return node;
+
+      node = new ConcatNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3425,7 +3816,11 @@ namespace triton {
 
 
     AbstractNode* concat(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new ConcatNode(exprs);
+      AbstractNode* node = triton::api.getAstRules()->concat(exprs);
+      if (node != nullptr)
+        return node;
+
+      node = new ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3433,10 +3828,7 @@ namespace triton {
 
 
     AbstractNode* concat(std::list<AbstractNode*> exprs) {
-      AbstractNode* node = new ConcatNode(exprs);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::ast::concat(std::vector<AbstractNode*>(exprs.begin(), exprs.end()));
     }
 
 
@@ -3473,7 +3865,11 @@ namespace triton {
 
 
     AbstractNode* extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
-      AbstractNode* node = new ExtractNode(high, low, expr);
+      AbstractNode* node = triton::api.getAstRules()->extract(high, low, expr);
+      if (node != nullptr)
+        return node;
+
+      node = new ExtractNode(high, low, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3496,6 +3892,14 @@ namespace triton {
     }
 
 
+    AbstractNode* land(std::vector<AbstractNode*> exprs) {
+      AbstractNode* node = new LandNode(exprs);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::api.recordAstNode(node);
+    }
+
+
     AbstractNode* let(std::string alias, AbstractNode* expr2, AbstractNode* expr3) {
       AbstractNode* node = new LetNode(alias, expr2, expr3);
       if (node == nullptr)
@@ -3528,6 +3932,22 @@ namespace triton {
     }
 
 
+    AbstractNode* select(AbstractNode* array, AbstractNode* index) {
+      AbstractNode* node = new SelectNode(array, index);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::api.recordAstNode(node);
+    }
+
+
+    AbstractNode* store(AbstractNode* array, AbstractNode* index, AbstractNode* expr) {
+      AbstractNode* node = new StoreNode(array, index, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::api.recordAstNode(node);
+    }
+
+
     AbstractNode* string(std::string value) {
       AbstractNode* node = new StringNode(value);
       if (node == nullptr)
@@ -3537,7 +3957,11 @@ namespace triton {
 
 
     AbstractNode* sx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new SxNode(sizeExt, expr);
+      AbstractNode* node = triton::api.getAstRules()->sx(sizeExt, expr);
+      if (node != nullptr)
+        return node;
+
+      node = new SxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3556,7 +3980,11 @@ namespace triton {
 
 
     AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new ZxNode(sizeExt, expr);
+      AbstractNode* node = triton::api.getAstRules()->zx(sizeExt, expr);
+      if (node != nullptr)
+        return node;
+
+      node = new ZxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3566,6 +3994,7 @@ namespace triton {
     AbstractNode* newInstance(AbstractNode* node) {
       AbstractNode* newNode = nullptr;
       switch (node->getKind()) {
+        case ARRAY_NODE:                newNode = new ArrayNode(*reinterpret_cast<ArrayNode*>(node)); break;
         case ASSERT_NODE:               newNode = new AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
         case BVADD_NODE:                newNode = new BvaddNode(*reinterpret_cast<BvaddNode*>(node)); break;
         case BVAND_NODE:                newNode = new BvandNode(*reinterpret_cast<BvandNode*>(node)); break;
@@ -3611,6 +4040,8 @@ namespace triton {
         case LNOT_NODE:                 newNode = new LnotNode(*reinterpret_cast<LnotNode*>(node)); break;
         case LOR_NODE:                  newNode = new LorNode(*reinterpret_cast<LorNode*>(node)); break;
         case REFERENCE_NODE:            newNode = new ReferenceNode(*reinterpret_cast<ReferenceNode*>(node)); break;
+        case SELECT_NODE:               newNode = new SelectNode(*reinterpret_cast<SelectNode*>(node)); break;
+        case STORE_NODE:                newNode = new StoreNode(*reinterpret_cast<StoreNode*>(node)); break;
         case STRING_NODE:               newNode = new StringNode(*reinterpret_cast<StringNode*>(node)); break;
         case SX_NODE:                   newNode = new SxNode(*reinterpret_cast<SxNode*>(node)); break;
         case VARIABLE_NODE:             newNode = new VariableNode(*reinterpret_cast<VariableNode*>(node)); break;
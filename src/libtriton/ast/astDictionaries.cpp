@@ -26,6 +26,8 @@ namespace triton {
 
 
     AstDictionaries::~AstDictionaries() {
+      for (auto it = this->arrayDictionary.begin(); it != this->arrayDictionary.end(); it++)
+        delete it->second;
       for (auto it = this->assertDictionary.begin(); it != this->assertDictionary.end(); it++)
         delete it->second;
       for (auto it = this->bvaddDictionary.begin(); it != this->bvaddDictionary.end(); it++)
@@ -116,6 +118,10 @@ namespace triton {
         delete it->second;
       for (auto it = this->referenceDictionary.begin(); it != this->referenceDictionary.end(); it++)
         delete it->second;
+      for (auto it = this->selectDictionary.begin(); it != this->selectDictionary.end(); it++)
+        delete it->second;
+      for (auto it = this->storeDictionary.begin(); it != this->storeDictionary.end(); it++)
+        delete it->second;
       for (auto it = this->stringDictionary.begin(); it != this->stringDictionary.end(); it++)
         delete it->second;
       for (auto it = this->sxDictionary.begin(); it != this->sxDictionary.end(); it++)
@@ -131,6 +137,7 @@ namespace triton {
       this->allocatedNodes              = other.allocatedNodes;
       this->allocatedDictionaries       = other.allocatedDictionaries;
 
+      this->arrayDictionary             = other.arrayDictionary;
       this->assertDictionary            = other.assertDictionary;
       this->bvaddDictionary             = other.bvaddDictionary;
       this->bvandDictionary             = other.bvandDictionary;
@@ -176,6 +183,8 @@ namespace triton {
       this->lnotDictionary              = other.lnotDictionary;
       this->lorDictionary               = other.lorDictionary;
       this->referenceDictionary         = other.referenceDictionary;
+      this->selectDictionary            = other.selectDictionary;
+      this->storeDictionary             = other.storeDictionary;
       this->stringDictionary            = other.stringDictionary;
       this->sxDictionary                = other.sxDictionary;
       this->variableDictionary          = other.variableDictionary;
@@ -186,6 +195,7 @@ namespace triton {
 
 
     void AstDictionaries::linkDictionaries(void) {
+      this->dictionaries[triton::ast::ARRAY_NODE]              = &this->arrayDictionary;
       this->dictionaries[triton::ast::ASSERT_NODE]             = &this->assertDictionary;
       this->dictionaries[triton::ast::BVADD_NODE]              = &this->bvaddDictionary;
       this->dictionaries[triton::ast::BVAND_NODE]              = &this->bvandDictionary;
@@ -231,6 +241,8 @@ namespace triton {
       this->dictionaries[triton::ast::LNOT_NODE]               = &this->lnotDictionary;
       this->dictionaries[triton::ast::LOR_NODE]                = &this->lorDictionary;
       this->dictionaries[triton::ast::REFERENCE_NODE]          = &this->referenceDictionary;
+      this->dictionaries[triton::ast::SELECT_NODE]             = &this->selectDictionary;
+      this->dictionaries[triton::ast::STORE_NODE]              = &this->storeDictionary;
       this->dictionaries[triton::ast::STRING_NODE]             = &this->stringDictionary;
       this->dictionaries[triton::ast::SX_NODE]                 = &this->sxDictionary;
       this->dictionaries[triton::ast::VARIABLE_NODE]           = &this->variableDictionary;
@@ -308,6 +320,7 @@ namespace triton {
 
     std::map<std::string, triton::usize> AstDictionaries::getAstDictionariesStats(void) {
       std::map<std::string, triton::usize> stats;
+      stats["array"]                  = this->arrayDictionary.size();
       stats["assert"]                 = this->assertDictionary.size();
       stats["bvadd"]                  = this->bvaddDictionary.size();
       stats["bvand"]                  = this->bvandDictionary.size();
@@ -353,6 +366,8 @@ namespace triton {
       stats["lnot"]                   = this->lnotDictionary.size();
       stats["lor"]                    = this->lorDictionary.size();
       stats["reference"]              = this->referenceDictionary.size();
+      stats["select"]                 = this->selectDictionary.size();
+      stats["store"]                  = this->storeDictionary.size();
       stats["string"]                 = this->stringDictionary.size();
       stats["sx"]                     = this->sxDictionary.size();
       stats["variable"]               = this->variableDictionary.size();
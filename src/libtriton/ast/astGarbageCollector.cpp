@@ -14,6 +14,7 @@ namespace triton {
   namespace ast {
 
     AstGarbageCollector::AstGarbageCollector() {
+      this->concurrent = false;
     }
 
 
@@ -25,8 +26,10 @@ namespace triton {
     void AstGarbageCollector::freeAllAstNodes(void) {
       std::set<triton::ast::AbstractNode*>::iterator it;
 
-      for (it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
+      for (it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
+        this->removeVariableSetOwner(&(*it)->getVariables());
         delete *it;
+      }
 
       this->variableNodes.clear();
       this->allocatedNodes.clear();
@@ -43,7 +46,8 @@ namespace triton {
         if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
           this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
 
-        /* Delete the node */
+        /* Release its variables and delete the node */
+        this->removeVariableSetOwner(&(*it)->getVariables());
         delete *it;
       }
       nodes.clear();
@@ -59,9 +63,18 @@ namespace triton {
 
 
     triton::ast::AbstractNode* AstGarbageCollector::recordAstNode(triton::ast::AbstractNode* node) {
+      std::unique_lock<std::mutex> lock(this->mutex, std::defer_lock);
+
+      if (this->concurrent)
+        lock.lock();
+
       /* Check if the AST_DICTIONARIES is enabled. */
       if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
+        const std::vector<triton::usize>* variables = &node->getVariables();
         triton::ast::AbstractNode* ret = triton::api.browseAstDictionaries(node);
+        /* The node is deleted when the dictionaries already hold the same one */
+        if (ret != nullptr && ret != node)
+          this->removeVariableSetOwner(variables);
         if (ret != nullptr)
           return ret;
       }
@@ -74,10 +87,58 @@ namespace triton {
 
 
     void AstGarbageCollector::recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node) {
+      std::unique_lock<std::mutex> lock(this->mutex, std::defer_lock);
+
+      if (this->concurrent)
+        lock.lock();
+
       this->variableNodes[name] = node;
     }
 
 
+    const std::vector<triton::usize>* AstGarbageCollector::recordVariableSet(const std::vector<triton::usize>& variables) {
+      std::unique_lock<std::mutex> lock(this->mutex, std::defer_lock);
+
+      if (this->concurrent)
+        lock.lock();
+
+      return &(*this->variableSets.insert(variables).first);
+    }
+
+
+    void AstGarbageCollector::acquireVariableSet(const std::vector<triton::usize>* variables) {
+      std::unique_lock<std::mutex> lock(this->mutex, std::defer_lock);
+
+      if (this->concurrent)
+        lock.lock();
+
+      this->variableSetOwners[variables]++;
+    }
+
+
+    void AstGarbageCollector::releaseVariableSet(const std::vector<triton::usize>* variables) {
+      std::unique_lock<std::mutex> lock(this->mutex, std::defer_lock);
+
+      if (this->concurrent)
+        lock.lock();
+
+      this->removeVariableSetOwner(variables);
+    }
+
+
+    void AstGarbageCollector::removeVariableSetOwner(const std::vector<triton::usize>* variables) {
+      /* The empty set of a node without variable is not recorded */
+      std::map<const std::vector<triton::usize>*, triton::usize>::iterator it = this->variableSetOwners.find(variables);
+      if (it == this->variableSetOwners.end())
+        return;
+
+      if (--it->second == 0) {
+        this->variableSetOwners.erase(it);
+        this->variableSets.erase(this->variableSets.find(*variables));
+      }
+    }
+
+
     const std::set<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
       return this->allocatedNodes;
     }
@@ -89,6 +150,11 @@ namespace triton {
 
 
     triton::ast::AbstractNode* AstGarbageCollector::getAstVariableNode(const std::string& name) const {
+      std::unique_lock<std::mutex> lock(this->mutex, std::defer_lock);
+
+      if (this->concurrent)
+        lock.lock();
+
       if (this->variableNodes.find(name) != this->variableNodes.end())
         return this->variableNodes.at(name);
       return nullptr;
@@ -98,8 +164,10 @@ namespace triton {
     void AstGarbageCollector::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
       /* Remove unused nodes before the assignation */
       for (std::set<triton::ast::AbstractNode*>::iterator it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (nodes.find(*it) == nodes.end())
+        if (nodes.find(*it) == nodes.end()) {
+          this->removeVariableSetOwner(&(*it)->getVariables());
           delete *it;
+        }
       }
       this->allocatedNodes = nodes;
     }
@@ -109,6 +177,11 @@ namespace triton {
       this->variableNodes = nodes;
     }
 
+
+    void AstGarbageCollector::enableConcurrentRecords(bool flag) {
+      this->concurrent = flag;
+    }
+
   }; /* ast namespace */
 }; /*triton namespace */
 
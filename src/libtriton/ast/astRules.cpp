@@ -0,0 +1,456 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <astRules.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstRules::AstRules() {
+      for (triton::uint32 index = 0; index < triton::ast::LAST_RULE; index++) {
+        this->enabled[index] = false;
+        this->hits[index]    = 0;
+      }
+
+      /* Folding constants never removes a variable from an expression, the other rules stay opt-in */
+      this->enabled[triton::ast::CONSTANT_FOLDING] = true;
+    }
+
+
+    void AstRules::enable(enum rule_e rule, bool flag) {
+      if (rule >= triton::ast::LAST_RULE)
+        throw triton::exceptions::AstRules("AstRules::enable(): Invalid rule.");
+      this->enabled[rule] = flag;
+    }
+
+
+    bool AstRules::isEnabled(enum rule_e rule) const {
+      if (rule >= triton::ast::LAST_RULE)
+        throw triton::exceptions::AstRules("AstRules::isEnabled(): Invalid rule.");
+      return this->enabled[rule];
+    }
+
+
+    std::map<std::string, triton::usize> AstRules::getStats(void) const {
+      std::map<std::string, triton::usize> stats;
+
+      stats["CONSTANT_FOLDING"] = this->hits[triton::ast::CONSTANT_FOLDING];
+      stats["IDENTITY"]         = this->hits[triton::ast::IDENTITY];
+      stats["ABSORPTION"]       = this->hits[triton::ast::ABSORPTION];
+      stats["EXTRACT_CONCAT"]   = this->hits[triton::ast::EXTRACT_CONCAT];
+      stats["EXTRACT_EXTRACT"]  = this->hits[triton::ast::EXTRACT_EXTRACT];
+      stats["EXTENSION_CHAIN"]  = this->hits[triton::ast::EXTENSION_CHAIN];
+      stats["XOR_SELF"]         = this->hits[triton::ast::XOR_SELF];
+
+      return stats;
+    }
+
+
+    void AstRules::clearStats(void) {
+      for (triton::uint32 index = 0; index < triton::ast::LAST_RULE; index++)
+        this->hits[index] = 0;
+    }
+
+
+    bool AstRules::isConstant(AbstractNode* node) const {
+      return (node->getKind() == BV_NODE);
+    }
+
+
+    bool AstRules::isConstant(AbstractNode* node, triton::uint512 value) const {
+      return (node->getKind() == BV_NODE && node->evaluate() == value);
+    }
+
+
+    bool AstRules::isSame(AbstractNode* node1, AbstractNode* node2) const {
+      if (node1 == node2)
+        return true;
+
+      if (node1->getKind() == REFERENCE_NODE && node2->getKind() == REFERENCE_NODE)
+        return (reinterpret_cast<ReferenceNode*>(node1)->getValue() == reinterpret_cast<ReferenceNode*>(node2)->getValue());
+
+      return false;
+    }
+
+
+    bool AstRules::isSameSize(AbstractNode* node1, AbstractNode* node2) const {
+      return (node1->getBitvectorSize() && node1->getBitvectorSize() == node2->getBitvectorSize());
+    }
+
+
+    void AstRules::getExtractBounds(AbstractNode* node, triton::uint32& high, triton::uint32& low) const {
+      high = reinterpret_cast<DecimalNode*>(node->getChilds()[0])->getValue().convert_to<triton::uint32>();
+      low  = reinterpret_cast<DecimalNode*>(node->getChilds()[1])->getValue().convert_to<triton::uint32>();
+    }
+
+
+    triton::uint32 AstRules::getExtensionSize(AbstractNode* node) const {
+      return reinterpret_cast<DecimalNode*>(node->getChilds()[0])->getValue().convert_to<triton::uint32>();
+    }
+
+
+    AbstractNode* AstRules::hit(enum rule_e rule, AbstractNode* node) {
+      this->hits[rule]++;
+      return node;
+    }
+
+
+    /* The folded values may overflow, a constant always holds a value of its size */
+    AbstractNode* AstRules::fold(const triton::uint512& value, triton::uint32 size) {
+      triton::uint512 mask = -1;
+      mask = mask >> (512 - size);
+      return this->hit(CONSTANT_FOLDING, triton::ast::bv(value & mask, size));
+    }
+
+
+    AbstractNode* AstRules::bvadd(AbstractNode* expr1, AbstractNode* expr2) {
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2))
+        return this->fold(expr1->evaluate() + expr2->evaluate(), expr1->getBitvectorSize());
+
+      if (this->enabled[IDENTITY]) {
+        if (this->isConstant(expr2, 0))
+          return this->hit(IDENTITY, expr1);
+        if (this->isConstant(expr1, 0))
+          return this->hit(IDENTITY, expr2);
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvand(AbstractNode* expr1, AbstractNode* expr2) {
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2))
+        return this->fold(expr1->evaluate() & expr2->evaluate(), expr1->getBitvectorSize());
+
+      if (this->enabled[ABSORPTION]) {
+        if (this->isConstant(expr2, 0))
+          return this->hit(ABSORPTION, expr2);
+        if (this->isConstant(expr1, 0))
+          return this->hit(ABSORPTION, expr1);
+      }
+
+      if (this->enabled[IDENTITY]) {
+        if (this->isConstant(expr2, expr2->getBitvectorMask()))
+          return this->hit(IDENTITY, expr1);
+        if (this->isConstant(expr1, expr1->getBitvectorMask()))
+          return this->hit(IDENTITY, expr2);
+        if (this->isSame(expr1, expr2))
+          return this->hit(IDENTITY, expr1);
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvlshr(AbstractNode* expr1, AbstractNode* expr2) {
+      triton::uint512 shift = 0;
+
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2)) {
+        shift = expr2->evaluate();
+        if (shift >= expr1->getBitvectorSize())
+          return this->fold(0, expr1->getBitvectorSize());
+        return this->fold(expr1->evaluate() >> shift.convert_to<triton::uint32>(), expr1->getBitvectorSize());
+      }
+
+      if (this->enabled[IDENTITY] && this->isConstant(expr2, 0))
+        return this->hit(IDENTITY, expr1);
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvmul(AbstractNode* expr1, AbstractNode* expr2) {
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2))
+        return this->fold(expr1->evaluate() * expr2->evaluate(), expr1->getBitvectorSize());
+
+      if (this->enabled[ABSORPTION]) {
+        if (this->isConstant(expr2, 0))
+          return this->hit(ABSORPTION, expr2);
+        if (this->isConstant(expr1, 0))
+          return this->hit(ABSORPTION, expr1);
+      }
+
+      if (this->enabled[IDENTITY]) {
+        if (this->isConstant(expr2, 1))
+          return this->hit(IDENTITY, expr1);
+        if (this->isConstant(expr1, 1))
+          return this->hit(IDENTITY, expr2);
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvneg(AbstractNode* expr) {
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr))
+        return this->fold((-(expr->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>(), expr->getBitvectorSize());
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvnot(AbstractNode* expr) {
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr))
+        return this->fold(~expr->evaluate(), expr->getBitvectorSize());
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvor(AbstractNode* expr1, AbstractNode* expr2) {
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2))
+        return this->fold(expr1->evaluate() | expr2->evaluate(), expr1->getBitvectorSize());
+
+      if (this->enabled[ABSORPTION]) {
+        if (this->isConstant(expr2, expr2->getBitvectorMask()))
+          return this->hit(ABSORPTION, expr2);
+        if (this->isConstant(expr1, expr1->getBitvectorMask()))
+          return this->hit(ABSORPTION, expr1);
+      }
+
+      if (this->enabled[IDENTITY]) {
+        if (this->isConstant(expr2, 0))
+          return this->hit(IDENTITY, expr1);
+        if (this->isConstant(expr1, 0))
+          return this->hit(IDENTITY, expr2);
+        if (this->isSame(expr1, expr2))
+          return this->hit(IDENTITY, expr1);
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvshl(AbstractNode* expr1, AbstractNode* expr2) {
+      triton::uint512 shift = 0;
+
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2)) {
+        shift = expr2->evaluate();
+        if (shift >= expr1->getBitvectorSize())
+          return this->fold(0, expr1->getBitvectorSize());
+        return this->fold(expr1->evaluate() << shift.convert_to<triton::uint32>(), expr1->getBitvectorSize());
+      }
+
+      if (this->enabled[IDENTITY] && this->isConstant(expr2, 0))
+        return this->hit(IDENTITY, expr1);
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvsub(AbstractNode* expr1, AbstractNode* expr2) {
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2))
+        return this->fold(expr1->evaluate() - expr2->evaluate(), expr1->getBitvectorSize());
+
+      if (this->enabled[IDENTITY] && this->isConstant(expr2, 0))
+        return this->hit(IDENTITY, expr1);
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::bvxor(AbstractNode* expr1, AbstractNode* expr2) {
+      if (!this->isSameSize(expr1, expr2))
+        return nullptr;
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr1) && this->isConstant(expr2))
+        return this->fold(expr1->evaluate() ^ expr2->evaluate(), expr1->getBitvectorSize());
+
+      if (this->enabled[IDENTITY]) {
+        if (this->isConstant(expr2, 0))
+          return this->hit(IDENTITY, expr1);
+        if (this->isConstant(expr1, 0))
+          return this->hit(IDENTITY, expr2);
+      }
+
+      if (this->enabled[XOR_SELF] && this->isSame(expr1, expr2))
+        return this->hit(XOR_SELF, triton::ast::bv(0, expr1->getBitvectorSize()));
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::concat(AbstractNode* expr1, AbstractNode* expr2) {
+      std::vector<AbstractNode*> exprs;
+
+      if (!this->enabled[CONSTANT_FOLDING] || !this->isConstant(expr1) || !this->isConstant(expr2))
+        return nullptr;
+
+      exprs.push_back(expr1);
+      exprs.push_back(expr2);
+
+      return this->concat(exprs);
+    }
+
+
+    AbstractNode* AstRules::concat(const std::vector<AbstractNode*>& exprs) {
+      triton::uint512 value = 0;
+      triton::uint32 size   = 0;
+
+      if (!this->enabled[CONSTANT_FOLDING] || exprs.size() < 2)
+        return nullptr;
+
+      for (triton::uint32 index = 0; index < exprs.size(); index++) {
+        if (!this->isConstant(exprs[index]))
+          return nullptr;
+        size += exprs[index]->getBitvectorSize();
+      }
+
+      if (size > MAX_BITS_SUPPORTED)
+        return nullptr;
+
+      for (triton::uint32 index = 0; index < exprs.size(); index++)
+        value = ((value << exprs[index]->getBitvectorSize()) | exprs[index]->evaluate());
+
+      return this->fold(value, size);
+    }
+
+
+    AbstractNode* AstRules::extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
+      triton::uint32 size = expr->getBitvectorSize();
+
+      if (low > high || high >= size)
+        return nullptr;
+
+      if (this->enabled[IDENTITY] && low == 0 && high == size - 1)
+        return this->hit(IDENTITY, expr);
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr))
+        return this->fold(expr->evaluate() >> low, (high - low) + 1);
+
+      /* ((_ extract h l) ((_ extract h' l') x)) => ((_ extract h+l' l+l') x) */
+      if (this->enabled[EXTRACT_EXTRACT] && expr->getKind() == EXTRACT_NODE) {
+        triton::uint32 innerHigh = 0;
+        triton::uint32 innerLow  = 0;
+        this->getExtractBounds(expr, innerHigh, innerLow);
+        return this->hit(EXTRACT_EXTRACT, triton::ast::extract(high + innerLow, low + innerLow, expr->getChilds()[2]));
+      }
+
+      /* Keeps only the operands of the concatenation which hold the extracted bits */
+      if (this->enabled[EXTRACT_CONCAT] && expr->getKind() == CONCAT_NODE) {
+        std::vector<AbstractNode*>& childs = expr->getChilds();
+        std::vector<AbstractNode*> parts;
+        triton::uint32 offset = 0;
+
+        for (triton::uint32 index = childs.size(); index > 0; index--) {
+          AbstractNode* child = childs[index-1];
+          triton::uint32 csize = child->getBitvectorSize();
+
+          /* The low bit is inside this operand */
+          if (parts.empty() && low >= offset && low < offset + csize) {
+            if (high < offset + csize)
+              return this->hit(EXTRACT_CONCAT, triton::ast::extract(high - offset, low - offset, child));
+            /* Only aligned bounds avoid new extract nodes */
+            if (low != offset)
+              break;
+            parts.push_back(child);
+          }
+
+          /* The high bit is inside this operand */
+          else if (!parts.empty()) {
+            if (high >= offset + csize) {
+              parts.push_back(child);
+            }
+            else {
+              if (high != offset + csize - 1)
+                break;
+              parts.push_back(child);
+              if (parts.size() == childs.size())
+                break;
+              return this->hit(EXTRACT_CONCAT, triton::ast::concat(std::vector<AbstractNode*>(parts.rbegin(), parts.rend())));
+            }
+          }
+
+          offset += csize;
+        }
+      }
+
+      /* ((_ extract h l) ((_ zero_extend n) x)) => ((_ extract h l) x) when h is inside x */
+      if (this->enabled[EXTENSION_CHAIN] && (expr->getKind() == ZX_NODE || expr->getKind() == SX_NODE)) {
+        AbstractNode* inner = expr->getChilds()[1];
+        if (high < inner->getBitvectorSize())
+          return this->hit(EXTENSION_CHAIN, triton::ast::extract(high, low, inner));
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::sx(triton::uint32 sizeExt, AbstractNode* expr) {
+      triton::uint32 size = expr->getBitvectorSize();
+
+      if (!size || sizeExt + size > MAX_BITS_SUPPORTED)
+        return nullptr;
+
+      if (this->enabled[IDENTITY] && sizeExt == 0)
+        return this->hit(IDENTITY, expr);
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr)) {
+        triton::uint512 value = expr->evaluate();
+        if ((value >> (size - 1)) & 1)
+          value |= ~expr->getBitvectorMask();
+        return this->fold(value, sizeExt + size);
+      }
+
+      if (this->enabled[EXTENSION_CHAIN]) {
+        /* ((_ sign_extend n) ((_ sign_extend m) x)) => ((_ sign_extend n+m) x) */
+        if (expr->getKind() == SX_NODE)
+          return this->hit(EXTENSION_CHAIN, triton::ast::sx(sizeExt + this->getExtensionSize(expr), expr->getChilds()[1]));
+
+        /* ((_ sign_extend n) ((_ zero_extend m) x)) => ((_ zero_extend n+m) x) when m > 0 */
+        if (expr->getKind() == ZX_NODE && this->getExtensionSize(expr) > 0)
+          return this->hit(EXTENSION_CHAIN, triton::ast::zx(sizeExt + this->getExtensionSize(expr), expr->getChilds()[1]));
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRules::zx(triton::uint32 sizeExt, AbstractNode* expr) {
+      triton::uint32 size = expr->getBitvectorSize();
+
+      if (!size || sizeExt + size > MAX_BITS_SUPPORTED)
+        return nullptr;
+
+      if (this->enabled[IDENTITY] && sizeExt == 0)
+        return this->hit(IDENTITY, expr);
+
+      if (this->enabled[CONSTANT_FOLDING] && this->isConstant(expr))
+        return this->fold(expr->evaluate(), sizeExt + size);
+
+      /* ((_ zero_extend n) ((_ zero_extend m) x)) => ((_ zero_extend n+m) x) */
+      if (this->enabled[EXTENSION_CHAIN] && expr->getKind() == ZX_NODE)
+        return this->hit(EXTENSION_CHAIN, triton::ast::zx(sizeExt + this->getExtensionSize(expr), expr->getChilds()[1]));
+
+      return nullptr;
+    }
+
+  };
+};
@@ -22,18 +22,23 @@ namespace triton {
         /* Init representations interface */
         this->representations[triton::ast::representations::SMT_REPRESENTATION] = new triton::ast::representations::AstSmtRepresentation();
         this->representations[triton::ast::representations::PYTHON_REPRESENTATION] = new triton::ast::representations::AstPythonRepresentation();
+        this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION] = new triton::ast::representations::AstSmtDagRepresentation();
 
         if (this->representations[triton::ast::representations::SMT_REPRESENTATION] == nullptr)
           throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
 
         if (this->representations[triton::ast::representations::PYTHON_REPRESENTATION] == nullptr)
           throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
+
+        if (this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION] == nullptr)
+          throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
       }
 
 
       AstRepresentation::~AstRepresentation() {
         delete this->representations[triton::ast::representations::SMT_REPRESENTATION];
         delete this->representations[triton::ast::representations::PYTHON_REPRESENTATION];
+        delete this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION];
       }
 
 
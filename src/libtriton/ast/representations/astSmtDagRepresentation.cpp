@@ -0,0 +1,363 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <sstream>
+#include <utility>
+
+#include <astSmtDagRepresentation.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+    namespace representations {
+
+      AstSmtDagRepresentation::AstSmtDagRepresentation() {
+      }
+
+
+      AstSmtDagRepresentation::~AstSmtDagRepresentation() {
+      }
+
+
+      bool AstSmtDagRepresentation::isCommand(triton::ast::AbstractNode* node) const {
+        switch (node->getKind()) {
+          case ASSERT_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_FUNCTION_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      bool AstSmtDagRepresentation::isLogical(triton::ast::AbstractNode* node) const {
+        switch (node->getKind()) {
+          case BVSGE_NODE:
+          case BVSGT_NODE:
+          case BVSLE_NODE:
+          case BVSLT_NODE:
+          case BVUGE_NODE:
+          case BVUGT_NODE:
+          case BVULE_NODE:
+          case BVULT_NODE:
+          case DISTINCT_NODE:
+          case EQUAL_NODE:
+          case LAND_NODE:
+          case LNOT_NODE:
+          case LOR_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      bool AstSmtDagRepresentation::isShared(const State& state, triton::ast::AbstractNode* node) const {
+        std::map<triton::ast::AbstractNode*, triton::usize>::const_iterator it = state.references.find(node);
+
+        if (it == state.references.end() || it->second < 2)
+          return false;
+
+        /* Leaves are shorter than their alias */
+        switch (node->getKind()) {
+          case ARRAY_NODE:
+          case BV_NODE:
+          case BVDECL_NODE:
+          case DECIMAL_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            return false;
+          default:
+            return !this->isCommand(node);
+        }
+      }
+
+
+      bool AstSmtDagRepresentation::isShorter(const State& state, triton::ast::AbstractNode* node, triton::usize body, triton::usize definition, triton::usize alias) const {
+        triton::usize references = state.references.find(node)->second;
+
+        /* Each reference prints the alias instead of the body, ties keep the alias */
+        return (references * body >= body + definition + references * alias);
+      }
+
+
+      void AstSmtDagRepresentation::postOrder(triton::ast::AbstractNode* root, std::set<triton::ast::AbstractNode*>& visited, std::vector<triton::ast::AbstractNode*>& order) const {
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> worklist;
+
+        if (!visited.insert(root).second)
+          return;
+
+        /* Iterative walk, full ASTs may be too deep for the call stack */
+        worklist.push_back(std::make_pair(root, 0));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back().first;
+          triton::usize index             = worklist.back().second;
+
+          if (index < node->getChilds().size()) {
+            worklist.back().second++;
+            triton::ast::AbstractNode* child = node->getChilds()[index];
+            if (visited.insert(child).second)
+              worklist.push_back(std::make_pair(child, 0));
+            continue;
+          }
+
+          order.push_back(node);
+          worklist.pop_back();
+        }
+      }
+
+
+      bool AstSmtDagRepresentation::printLeaf(std::ostream& stream, triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        switch (node->getKind()) {
+          case ARRAY_NODE:     stream << triton::ast::MEMORY_ARRAY_NAME; break;
+          case BVDECL_NODE:    stream << "(_ BitVec " << reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue() << ")"; break;
+          case DECIMAL_NODE:   stream << reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue(); break;
+          case REFERENCE_NODE: stream << "ref!" << reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue(); break;
+          case STRING_NODE:    stream << reinterpret_cast<triton::ast::StringNode*>(node)->getValue(); break;
+          case VARIABLE_NODE:  stream << reinterpret_cast<triton::ast::VariableNode*>(node)->getValue(); break;
+          case BV_NODE:
+            stream << "(_ bv" << reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue() << " " << reinterpret_cast<triton::ast::DecimalNode*>(childs[1])->getValue() << ")";
+            break;
+          default:
+            return false;
+        }
+
+        return true;
+      }
+
+
+      triton::usize AstSmtDagRepresentation::printOpening(std::ostream& stream, triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        switch (node->getKind()) {
+          case ASSERT_NODE:           stream << "(assert";   return 0;
+          case BVADD_NODE:            stream << "(bvadd";    return 0;
+          case BVAND_NODE:            stream << "(bvand";    return 0;
+          case BVASHR_NODE:           stream << "(bvashr";   return 0;
+          case BVLSHR_NODE:           stream << "(bvlshr";   return 0;
+          case BVMUL_NODE:            stream << "(bvmul";    return 0;
+          case BVNAND_NODE:           stream << "(bvnand";   return 0;
+          case BVNEG_NODE:            stream << "(bvneg";    return 0;
+          case BVNOR_NODE:            stream << "(bvnor";    return 0;
+          case BVNOT_NODE:            stream << "(bvnot";    return 0;
+          case BVOR_NODE:             stream << "(bvor";     return 0;
+          case BVSDIV_NODE:           stream << "(bvsdiv";   return 0;
+          case BVSGE_NODE:            stream << "(bvsge";    return 0;
+          case BVSGT_NODE:            stream << "(bvsgt";    return 0;
+          case BVSHL_NODE:            stream << "(bvshl";    return 0;
+          case BVSLE_NODE:            stream << "(bvsle";    return 0;
+          case BVSLT_NODE:            stream << "(bvslt";    return 0;
+          case BVSMOD_NODE:           stream << "(bvsmod";   return 0;
+          case BVSREM_NODE:           stream << "(bvsrem";   return 0;
+          case BVSUB_NODE:            stream << "(bvsub";    return 0;
+          case BVUDIV_NODE:           stream << "(bvudiv";   return 0;
+          case BVUGE_NODE:            stream << "(bvuge";    return 0;
+          case BVUGT_NODE:            stream << "(bvugt";    return 0;
+          case BVULE_NODE:            stream << "(bvule";    return 0;
+          case BVULT_NODE:            stream << "(bvult";    return 0;
+          case BVUREM_NODE:           stream << "(bvurem";   return 0;
+          case BVXNOR_NODE:           stream << "(bvxnor";   return 0;
+          case BVXOR_NODE:            stream << "(bvxor";    return 0;
+          case COMPOUND_NODE:                                return 0;
+          case CONCAT_NODE:           stream << "(concat";   return 0;
+          case DISTINCT_NODE:         stream << "(distinct"; return 0;
+          case EQUAL_NODE:            stream << "(=";        return 0;
+          case ITE_NODE:              stream << "(ite";      return 0;
+          case LAND_NODE:             stream << "(and";      return 0;
+          case LNOT_NODE:             stream << "(not";      return 0;
+          case LOR_NODE:              stream << "(or";       return 0;
+          case SELECT_NODE:           stream << "(select";   return 0;
+          case STORE_NODE:            stream << "(store";    return 0;
+
+          /* The indices are part of the operator */
+          case BVROL_NODE:            stream << "((_ rotate_left ";  this->printLeaf(stream, childs[0]); stream << ")"; return 1;
+          case BVROR_NODE:            stream << "((_ rotate_right "; this->printLeaf(stream, childs[0]); stream << ")"; return 1;
+          case SX_NODE:               stream << "((_ sign_extend ";  this->printLeaf(stream, childs[0]); stream << ")"; return 1;
+          case ZX_NODE:               stream << "((_ zero_extend ";  this->printLeaf(stream, childs[0]); stream << ")"; return 1;
+          case DECLARE_FUNCTION_NODE: stream << "(declare-fun ";     this->printLeaf(stream, childs[0]); stream << " ()"; return 1;
+          case LET_NODE:              stream << "(let ((";           this->printLeaf(stream, childs[0]); return 1;
+
+          case EXTRACT_NODE:
+            stream << "((_ extract ";
+            this->printLeaf(stream, childs[0]);
+            stream << " ";
+            this->printLeaf(stream, childs[1]);
+            stream << ")";
+            return 2;
+
+          default:
+            throw triton::exceptions::AstRepresentation("AstSmtDagRepresentation::printOpening(): Invalid kind node.");
+        }
+      }
+
+
+      std::ostream& AstSmtDagRepresentation::printNode(std::ostream& stream, const State& state, triton::ast::AbstractNode* root) const {
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> worklist;
+        triton::ast::AbstractNode* next = root;
+
+        /* Iterative walk, full ASTs may be too deep for the call stack */
+        while (true) {
+          if (next != nullptr) {
+            std::map<triton::ast::AbstractNode*, triton::usize>::const_iterator alias = state.aliases.find(next);
+            if (alias != state.aliases.end())
+              stream << "dag!" << alias->second;
+            else if (!this->printLeaf(stream, next))
+              worklist.push_back(std::make_pair(next, this->printOpening(stream, next)));
+            next = nullptr;
+          }
+
+          if (worklist.empty())
+            break;
+
+          triton::ast::AbstractNode* node = worklist.back().first;
+          triton::usize index             = worklist.back().second;
+          triton::ast::kind_e kind        = node->getKind();
+
+          if (index < node->getChilds().size()) {
+            worklist.back().second++;
+            if (kind == LET_NODE && index == 2)
+              stream << ")) ";
+            else if (kind != COMPOUND_NODE)
+              stream << " ";
+            next = node->getChilds()[index];
+            continue;
+          }
+
+          if (kind != COMPOUND_NODE)
+            stream << ")";
+          worklist.pop_back();
+        }
+
+        return stream;
+      }
+
+
+      std::ostream& AstSmtDagRepresentation::printCommand(std::ostream& stream, State& state, triton::ast::AbstractNode* node, std::set<triton::ast::AbstractNode*>& visited) const {
+        std::vector<triton::ast::AbstractNode*> order;
+
+        if (node->getKind() == COMPOUND_NODE) {
+          std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+          for (triton::usize index = 0; index < childs.size(); index++) {
+            if (this->isCommand(childs[index]))
+              this->printCommand(stream, state, childs[index], visited);
+            else
+              this->printNode(stream, state, childs[index]);
+          }
+          return stream;
+        }
+
+        /* Define the shared nodes first reached by this command, childs first */
+        this->postOrder(node, visited, order);
+        for (triton::usize index = 0; index < order.size(); index++) {
+          triton::ast::AbstractNode* shared = order[index];
+          if (!this->isShared(state, shared))
+            continue;
+
+          triton::usize alias = state.aliases.size();
+          std::ostringstream name;
+          std::ostringstream definition;
+          std::ostringstream body;
+
+          name << "dag!" << alias;
+          definition << "(define-fun " << name.str() << " () ";
+          if (this->isLogical(shared))
+            definition << "Bool ";
+          else if (shared->getKind() == STORE_NODE)
+            definition << "(Array (_ BitVec " << shared->getChilds()[1]->getBitvectorSize() << ") (_ BitVec " << BYTE_SIZE_BIT << ")) ";
+          else
+            definition << "(_ BitVec " << shared->getBitvectorSize() << ") ";
+
+          this->printNode(body, state, shared);
+          if (!this->isShorter(state, shared, body.str().size(), definition.str().size() + 1, name.str().size()))
+            continue;
+
+          stream << definition.str() << body.str() << ")";
+          state.aliases[shared] = alias;
+        }
+
+        return this->printNode(stream, state, node);
+      }
+
+
+      std::ostream& AstSmtDagRepresentation::printTerm(std::ostream& stream, State& state, triton::ast::AbstractNode* node) const {
+        std::set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> order;
+        triton::usize bindings = 0;
+
+        /* Bind the shared nodes, childs first, each let sees the previous ones */
+        this->postOrder(node, visited, order);
+        for (triton::usize index = 0; index < order.size(); index++) {
+          triton::ast::AbstractNode* shared = order[index];
+          if (!this->isShared(state, shared))
+            continue;
+
+          triton::usize alias = state.aliases.size();
+          std::ostringstream name;
+          std::ostringstream body;
+
+          /* The binding costs `(let ((name body)) ...)` */
+          name << "dag!" << alias;
+          this->printNode(body, state, shared);
+          if (!this->isShorter(state, shared, body.str().size(), name.str().size() + 12, name.str().size()))
+            continue;
+
+          stream << "(let ((" << name.str() << " " << body.str() << ")) ";
+          state.aliases[shared] = alias;
+          bindings++;
+        }
+
+        this->printNode(stream, state, node);
+
+        while (bindings--)
+          stream << ")";
+
+        return stream;
+      }
+
+
+      std::ostream& AstSmtDagRepresentation::printRoot(std::ostream& stream, State& state, triton::ast::AbstractNode* node) const {
+        std::set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> order;
+
+        /* Count the references of every node */
+        this->postOrder(node, visited, order);
+        for (triton::usize index = 0; index < order.size(); index++) {
+          /* A let node binds names, its subterms cannot be moved out of its scope */
+          if (order[index]->getKind() == LET_NODE) {
+            state.references.clear();
+            return this->printNode(stream, state, node);
+          }
+          std::vector<triton::ast::AbstractNode*>& childs = order[index]->getChilds();
+          for (triton::usize child = 0; child < childs.size(); child++)
+            state.references[childs[child]]++;
+        }
+
+        if (this->isCommand(node)) {
+          visited.clear();
+          return this->printCommand(stream, state, node, visited);
+        }
+
+        return this->printTerm(stream, state, node);
+      }
+
+
+      /* Representation dispatcher from an abstract node */
+      std::ostream& AstSmtDagRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
+        State state;
+        return this->printRoot(stream, state, node);
+      }
+
+    };
+  };
+};
@@ -25,6 +25,7 @@ namespace triton {
       /* Representation dispatcher from an abstract node */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
         switch (node->getKind()) {
+          case ARRAY_NODE:                return this->print(stream, reinterpret_cast<triton::ast::ArrayNode*>(node)); break;
           case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
           case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
           case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
@@ -70,6 +71,8 @@ namespace triton {
           case LNOT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LnotNode*>(node)); break;
           case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
           case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
+          case SELECT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::SelectNode*>(node)); break;
+          case STORE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::StoreNode*>(node)); break;
           case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
           case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
           case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
@@ -81,6 +84,13 @@ namespace triton {
       }
 
 
+      /* array representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ArrayNode* node) {
+        stream << triton::ast::MEMORY_ARRAY_NAME;
+        return stream;
+      }
+
+
       /* assert representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
         stream << "(assert " << node->getChilds()[0] << ")";
@@ -374,7 +384,13 @@ namespace triton {
 
       /* land representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::LandNode* node) {
-        stream << "(and " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
+        triton::usize size = node->getChilds().size();
+
+        stream << "(and";
+        for (triton::usize index = 0; index < size; index++)
+          stream << " " << node->getChilds()[index];
+        stream << ")";
+
         return stream;
       }
 
@@ -407,6 +423,20 @@ namespace triton {
       }
 
 
+      /* select representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::SelectNode* node) {
+        stream << "(select " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
+        return stream;
+      }
+
+
+      /* store representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::StoreNode* node) {
+        stream << "(store " << node->getChilds()[0] << " " << node->getChilds()[1] << " " << node->getChilds()[2] << ")";
+        return stream;
+      }
+
+
       /* string representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
         stream << node->getValue();
@@ -27,7 +27,19 @@ namespace triton {
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
+      std::map<triton::ast::AbstractNode*, z3::expr>::iterator it = this->converted.find(&e);
+
+      if (it != this->converted.end()) {
+        this->result.setExpr(it->second);
+        return this->result;
+      }
+
       e.accept(*this);
+
+      /* Inside a let, a node may depend on the bound symbols */
+      if (this->symbols.empty())
+        this->converted.insert(std::make_pair(&e, this->result.getExpr()));
+
       return this->result;
     }
 
@@ -37,6 +49,15 @@ namespace triton {
     }
 
 
+    void TritonToZ3Ast::operator()(triton::ast::ArrayNode& e) {
+      z3::context& ctx  = this->result.getContext();
+      z3::sort sort     = ctx.array_sort(ctx.bv_sort(e.getIndexSize()), ctx.bv_sort(BYTE_SIZE_BIT));
+      z3::expr newexpr  = ctx.constant(triton::ast::MEMORY_ARRAY_NAME, sort);
+
+      this->result.setExpr(newexpr);
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AssertNode& e) {
       throw triton::exceptions::AstTranslations("TritonToZ3Ast::AssertNode(): Not implemented.");
     }
@@ -395,10 +416,16 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::LandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_and(this->result.getContext(), 2, ops));
+      std::vector<z3::expr> exprs;
+      std::vector<Z3_ast> ops;
+
+      /* The z3 expressions hold a reference on the ops */
+      for (triton::uint32 index = 0; index < e.getChilds().size(); index++) {
+        exprs.push_back(this->eval(*e.getChilds()[index]).getExpr());
+        ops.push_back(exprs.back());
+      }
+
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_and(this->result.getContext(), static_cast<unsigned int>(ops.size()), ops.data()));
 
       this->result.setExpr(newexpr);
     }
@@ -440,6 +467,25 @@ namespace triton {
     }
 
 
+    void TritonToZ3Ast::operator()(triton::ast::SelectNode& e) {
+      Z3Result op1      = this->eval(*e.getChilds()[0]); // array
+      Z3Result op2      = this->eval(*e.getChilds()[1]); // index
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_select(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+
+      this->result.setExpr(newexpr);
+    }
+
+
+    void TritonToZ3Ast::operator()(triton::ast::StoreNode& e) {
+      Z3Result op1      = this->eval(*e.getChilds()[0]); // array
+      Z3Result op2      = this->eval(*e.getChilds()[1]); // index
+      Z3Result op3      = this->eval(*e.getChilds()[2]); // value
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_store(this->result.getContext(), op1.getExpr(), op2.getExpr(), op3.getExpr()));
+
+      this->result.setExpr(newexpr);
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::StringNode& e) {
       if (this->symbols.find(e.getValue()) == this->symbols.end())
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::StringNode(): Symbols not found.");
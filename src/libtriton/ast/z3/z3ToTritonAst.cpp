@@ -5,7 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <list>
+#include <map>
+#include <utility>
+#include <vector>
 
 #include <api.hpp>
 #include <exceptions.hpp>
@@ -43,19 +45,61 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
-      return this->visit(this->expr);
-    }
+      std::map<triton::uint32, AbstractNode*> translated;
+      std::vector<std::pair<z3::expr, bool>> worklist;
+
+      /*
+       * Z3 returns DAGs. Each Z3 node is converted once (memoized on its id) and the
+       * walk uses an explicit work-stack, so a deep or heavily shared expression neither
+       * blows the call stack nor expands into a tree. Nodes are built through the AST
+       * builders and thus through the AST dictionaries when they are enabled.
+       */
+      worklist.push_back(std::make_pair(this->expr, false));
+      while (!worklist.empty()) {
+        z3::expr current    = worklist.back().first;
+        bool expanded       = worklist.back().second;
+        triton::uint32 id   = Z3_get_ast_id(current.ctx(), current);
+
+        if (translated.find(id) != translated.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        /* Currently, only support application node */
+        if (current.is_quantifier())
+          throw triton::exceptions::AstTranslations("Z3ToTritonAst::convert(): Quantifier not supported yet.");
+
+        if (!current.is_app())
+          throw triton::exceptions::AstTranslations("Z3ToTritonAst::convert(): At this moment only application are supported.");
+
+        /* First, convert the arguments */
+        if (!expanded) {
+          worklist.back().second = true;
+          for (triton::uint32 i = current.num_args(); i > 0; i--) {
+            z3::expr arg = current.arg(i-1);
+            if (translated.find(Z3_get_ast_id(arg.ctx(), arg)) == translated.end())
+              worklist.push_back(std::make_pair(arg, false));
+          }
+          continue;
+        }
 
+        /* Then, the node itself */
+        std::vector<AbstractNode*> args;
+        for (triton::uint32 i = 0; i < current.num_args(); i++) {
+          z3::expr arg = current.arg(i);
+          args.push_back(translated[Z3_get_ast_id(arg.ctx(), arg)]);
+        }
 
-    AbstractNode* Z3ToTritonAst::visit(z3::expr const& expr) {
-      AbstractNode* node = nullptr;
+        translated[id] = this->visit(current, args);
+        worklist.pop_back();
+      }
 
-      /* Currently, only support application node */
-      if (expr.is_quantifier())
-        throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Quantifier not supported yet.");
+      return translated[Z3_get_ast_id(this->expr.ctx(), this->expr)];
+    }
 
-      if (!expr.is_app())
-        throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): At this moment only application are supported.");
+
+    AbstractNode* Z3ToTritonAst::visit(z3::expr const& expr, const std::vector<AbstractNode*>& args) {
+      AbstractNode* node = nullptr;
 
       /* Get the function declaration */
       z3::func_decl function = expr.decl();
@@ -66,41 +110,39 @@ namespace triton {
         case Z3_OP_EQ: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EQ must conatin two arguments.");
-          node = triton::ast::equal(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::equal(args[0], args[1]);
           break;
         }
 
         case Z3_OP_DISTINCT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_DISTINCT must conatin at least two arguments.");
-          node = triton::ast::distinct(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::distinct(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::distinct(node, this->visit(expr.arg(i)));
+            node = triton::ast::distinct(node, args[i]);
           break;
         }
 
         case Z3_OP_ITE: {
           if (expr.num_args() != 3)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ITE must conatin three arguments.");
-          node = triton::ast::ite(this->visit(expr.arg(0)), this->visit(expr.arg(1)), this->visit(expr.arg(2)));
+          node = triton::ast::ite(args[0], args[1], args[2]);
           break;
         }
 
         case Z3_OP_AND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_AND must conatin at least two arguments.");
-          node = triton::ast::land(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
-          for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::land(node, this->visit(expr.arg(i)));
+          node = triton::ast::land(args);
           break;
         }
 
         case Z3_OP_OR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_OR must conatin at least two arguments.");
-          node = triton::ast::lor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::lor(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::lor(node, this->visit(expr.arg(i)));
+            node = triton::ast::lor(node, args[i]);
           break;
         }
 
@@ -108,7 +150,7 @@ namespace triton {
         case Z3_OP_NOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_NOT must conatin at one argument.");
-          node = triton::ast::lnot(this->visit(expr.arg(0)));
+          node = triton::ast::lnot(args[0]);
           break;
         }
 
@@ -122,212 +164,212 @@ namespace triton {
         case Z3_OP_BNEG: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNEG must conatin one argument.");
-          node = triton::ast::bvneg(this->visit(expr.arg(0)));
+          node = triton::ast::bvneg(args[0]);
           break;
         }
 
         case Z3_OP_BADD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BADD must conatin at least two arguments.");
-          node = triton::ast::bvadd(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvadd(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvadd(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvadd(node, args[i]);
           break;
         }
 
         case Z3_OP_BSUB: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSUB must conatin at least two arguments.");
-          node = triton::ast::bvsub(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsub(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsub(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsub(node, args[i]);
           break;
         }
 
         case Z3_OP_BMUL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BMUL must conatin at least two arguments.");
-          node = triton::ast::bvmul(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvmul(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvmul(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvmul(node, args[i]);
           break;
         }
 
         case Z3_OP_BSDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSDIV must conatin at least two arguments.");
-          node = triton::ast::bvsdiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsdiv(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsdiv(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsdiv(node, args[i]);
           break;
         }
 
         case Z3_OP_BUDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUDIV must conatin at least two arguments.");
-          node = triton::ast::bvudiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvudiv(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvudiv(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvudiv(node, args[i]);
           break;
         }
 
         case Z3_OP_BSREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSREM must conatin at least two arguments.");
-          node = triton::ast::bvsrem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsrem(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsrem(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsrem(node, args[i]);
           break;
         }
 
         case Z3_OP_BUREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUREM must conatin at least two arguments.");
-          node = triton::ast::bvurem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvurem(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvurem(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvurem(node, args[i]);
           break;
         }
 
         case Z3_OP_BSMOD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSMOD must conatin at least two arguments.");
-          node = triton::ast::bvsmod(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsmod(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsmod(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsmod(node, args[i]);
           break;
         }
 
         case Z3_OP_ULEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULEQ must conatin at least two arguments.");
-          node = triton::ast::bvule(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvule(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvule(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvule(node, args[i]);
           break;
         }
 
         case Z3_OP_SLEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLEQ must conatin at least two arguments.");
-          node = triton::ast::bvsle(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsle(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsle(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsle(node, args[i]);
           break;
         }
 
         case Z3_OP_UGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGEQ must conatin at least two arguments.");
-          node = triton::ast::bvuge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvuge(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvuge(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvuge(node, args[i]);
           break;
         }
 
         case Z3_OP_SGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGEQ must conatin at least two arguments.");
-          node = triton::ast::bvsge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsge(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsge(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsge(node, args[i]);
           break;
         }
 
         case Z3_OP_ULT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULT must conatin at least two arguments.");
-          node = triton::ast::bvult(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvult(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvult(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvult(node, args[i]);
           break;
         }
 
         case Z3_OP_SLT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLT must conatin at least two arguments.");
-          node = triton::ast::bvslt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvslt(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvslt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvslt(node, args[i]);
           break;
         }
 
         case Z3_OP_UGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGT must conatin at least two arguments.");
-          node = triton::ast::bvugt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvugt(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvugt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvugt(node, args[i]);
           break;
         }
 
         case Z3_OP_SGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGT must conatin at least two arguments.");
-          node = triton::ast::bvsgt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsgt(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsgt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsgt(node, args[i]);
           break;
         }
 
         case Z3_OP_BAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BAND must conatin at least two arguments.");
-          node = triton::ast::bvand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvand(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvand(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvand(node, args[i]);
           break;
         }
 
         case Z3_OP_BOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BOR must conatin at least two arguments.");
-          node = triton::ast::bvor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvor(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvor(node, args[i]);
           break;
         }
 
         case Z3_OP_BNOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOT must conatin one argument.");
-          node = triton::ast::bvnot(this->visit(expr.arg(0)));
+          node = triton::ast::bvnot(args[0]);
           break;
         }
 
         case Z3_OP_BXOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXOR must conatin at least two arguments.");
-          node = triton::ast::bvxor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvxor(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvxor(node, args[i]);
           break;
         }
 
         case Z3_OP_BNAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNAND must conatin at least two arguments.");
-          node = triton::ast::bvnand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvnand(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnand(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvnand(node, args[i]);
           break;
         }
 
         case Z3_OP_BNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOR must conatin at least two arguments.");
-          node = triton::ast::bvnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvnor(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvnor(node, args[i]);
           break;
         }
 
         case Z3_OP_BXNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXNOR must conatin at least two arguments.");
-          node = triton::ast::bvxnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvxnor(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxnor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvxnor(node, args[i]);
           break;
         }
 
@@ -335,11 +377,6 @@ namespace triton {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_CONCAT must conatin at leat two arguments.");
 
-          std::list<AbstractNode*> args;
-          for (triton::uint32 i = 0; i < expr.num_args(); i++) {
-            args.push_back(this->visit(expr.arg(i)));
-          }
-
           node = triton::ast::concat(args);
           break;
         }
@@ -347,72 +384,88 @@ namespace triton {
         case Z3_OP_SIGN_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SIGN_EXT must conatin one argument.");
-          node = triton::ast::sx(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::sx(Z3_get_decl_int_parameter(expr.ctx(), expr.decl(), 0), args[0]);
           break;
         }
 
         case Z3_OP_ZERO_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ZERO_EXT must conatin one argument.");
-          node = triton::ast::zx(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::zx(Z3_get_decl_int_parameter(expr.ctx(), expr.decl(), 0), args[0]);
           break;
         }
 
         case Z3_OP_EXTRACT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EXTRACT must conatin one argument.");
-          node = triton::ast::extract(expr.hi(), expr.lo(), this->visit(expr.arg(0)));
+          node = triton::ast::extract(expr.hi(), expr.lo(), args[0]);
           break;
         }
 
         case Z3_OP_BSHL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSHL must conatin at least two arguments.");
-          node = triton::ast::bvshl(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvshl(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvshl(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvshl(node, args[i]);
           break;
         }
 
         case Z3_OP_BLSHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BLSHR must conatin at least two arguments.");
-          node = triton::ast::bvlshr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvlshr(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvlshr(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvlshr(node, args[i]);
           break;
         }
 
         case Z3_OP_BASHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BASHR must conatin at least two arguments.");
-          node = triton::ast::bvashr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvashr(args[0], args[1]);
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvashr(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvashr(node, args[i]);
           break;
         }
 
         case Z3_OP_ROTATE_LEFT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_LEFT must conatin one argument.");
-          node = triton::ast::bvrol(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::bvrol(Z3_get_decl_int_parameter(expr.ctx(), expr.decl(), 0), args[0]);
           break;
         }
 
         case Z3_OP_ROTATE_RIGHT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_RIGHT must conatin one argument.");
-          node = triton::ast::bvror(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::bvror(Z3_get_decl_int_parameter(expr.ctx(), expr.decl(), 0), args[0]);
+          break;
+        }
+
+        case Z3_OP_SELECT: {
+          if (expr.num_args() != 2)
+            throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SELECT must conatin two arguments.");
+          node = triton::ast::select(args[0], args[1]);
+          break;
+        }
+
+        case Z3_OP_STORE: {
+          if (expr.num_args() != 3)
+            throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_STORE must conatin three arguments.");
+          node = triton::ast::store(args[0], args[1], args[2]);
           break;
         }
 
-        /* Variable or string */
+        /* Variable, memory array or string */
         case Z3_OP_UNINTERPRETED: {
           std::string name = function.name().str();
           triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(name);
 
           if (symVar)
             node = triton::ast::variable(*symVar);
+          else if (expr.is_array() && name == triton::ast::MEMORY_ARRAY_NAME)
+            node = triton::ast::array(expr.get_sort().array_domain().bv_size());
           else
             node = triton::ast::string(name);
 
@@ -75,6 +75,12 @@ namespace triton {
         initAstRepresentationNamespace(astRepresentationDict);
         PyObject* idAstRepresentationDictClass = xPyClass_New(nullptr, astRepresentationDict, xPyString_FromString("AST_REPRESENTATION"));
 
+        /* Create the AST_RULE namespace ============================================================= */
+
+        PyObject* astRuleDict = xPyDict_New();
+        initAstRuleNamespace(astRuleDict);
+        PyObject* idAstRuleDictClass = xPyClass_New(nullptr, astRuleDict, xPyString_FromString("AST_RULE"));
+
         /* Create the CALLBACK namespace ============================================================= */
 
         PyObject* callbackDict = xPyDict_New();
@@ -92,6 +98,12 @@ namespace triton {
         initElfNamespace(elfDict);
         PyObject* idElfDictClass = xPyClass_New(nullptr, elfDict, xPyString_FromString("ELF"));
 
+        /* Create the EXPLORATION namespace ========================================================== */
+
+        PyObject* explorationDict = xPyDict_New();
+        initExplorationNamespace(explorationDict);
+        PyObject* idExplorationClass = xPyClass_New(nullptr, explorationDict, xPyString_FromString("EXPLORATION"));
+
         /* Create the OPCODE namespace =============================================================== */
 
         triton::bindings::python::opcodesDict = xPyDict_New();
@@ -119,6 +131,12 @@ namespace triton {
         triton::bindings::python::registersDict = xPyDict_New();
         PyObject* idRegClass = xPyClass_New(nullptr, triton::bindings::python::registersDict, xPyString_FromString("REG"));
 
+        /* Create the SOLVER namespace =================================================================== */
+
+        PyObject* solverDict = xPyDict_New();
+        initSolverNamespace(solverDict);
+        PyObject* idSolverClass = xPyClass_New(nullptr, solverDict, xPyString_FromString("SOLVER"));
+
         /* Create the SYMEXPR namespace ============================================================== */
 
         PyObject* symExprDict = xPyDict_New();
@@ -145,14 +163,17 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "ARCH",                idArchDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_NODE",            idAstNodeDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_REPRESENTATION",  idAstRepresentationDictClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "AST_RULE",            idAstRuleDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CALLBACK",            idCallbackDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "ELF",                 idElfDictClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "EXPLORATION",         idExplorationClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);            /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);            /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPERAND",             idOperandClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPTIMIZATION",        idSymOptiClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);           /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);                /* Empty: filled on the fly */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER",              idSolverClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYMEXPR",             idSymExprClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "VERSION",             idVersionClass);
         #if defined(__unix__) || defined(__APPLE__)
@@ -231,6 +231,11 @@ a \>> b           | (bvlshr a b)
 \section ast_py_api Python API - Methods of the ast module
 <hr>
 
+- **array(integer indexSize)**<br>
+Returns the memory array (`triton::ast::array()`) node as \ref py_AstNode_page. Its indexes are bit-vectors of `indexSize` bits
+and its values are bytes.<br>
+e.g: `memory`.
+
 - **assert_(AstNode expr1)**<br>
 Returns the ast `triton::ast::assert_()` representation as \ref py_AstNode_page.<br>
 e.g: `(assert expr1)`.
@@ -412,6 +417,14 @@ Be careful, the targeted node reference is always on the max vector size, except
 expressions.<br>
 e.g: `ref!123`.
 
+- **select(AstNode array, AstNode index)**<br>
+Returns the ast `triton::ast::select()` representation as \ref py_AstNode_page.<br>
+e.g: `(select array index)`.
+
+- **store(AstNode array, AstNode index, AstNode expr)**<br>
+Returns the ast `triton::ast::store()` representation as \ref py_AstNode_page.<br>
+e.g: `(store array index expr)`.
+
 - **string(string s)**<br>
 Returns a `triton::ast::string()` node as \ref py_AstNode_page.
 
@@ -435,6 +448,19 @@ namespace triton {
     namespace python {
 
 
+      static PyObject* ast_array(PyObject* self, PyObject* indexSize) {
+        if (indexSize == nullptr || (!PyLong_Check(indexSize) && !PyInt_Check(indexSize)))
+          return PyErr_Format(PyExc_TypeError, "array(): expected an integer as argument");
+
+        try {
+          return PyAstNode(triton::ast::array(PyLong_AsUint32(indexSize)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* ast_assert(PyObject* self, PyObject* expr) {
         if (!PyAstNode_Check(expr))
           return PyErr_Format(PyExc_TypeError, "assert_(): expected a AstNode as first argument");
@@ -1381,6 +1407,54 @@ namespace triton {
       }
 
 
+      static PyObject* ast_select(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "select(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "select(): expected a AstNode as second argument");
+
+        try {
+          return PyAstNode(triton::ast::select(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ast_store(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3);
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || !PyAstNode_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as third argument");
+
+        try {
+          return PyAstNode(triton::ast::store(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyAstNode_AsAstNode(op3)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* ast_string(PyObject* self, PyObject* expr) {
         if (!PyString_Check(expr))
           return PyErr_Format(PyExc_TypeError, "string(): expected a string as first argument");
@@ -1452,6 +1526,7 @@ namespace triton {
 
 
       PyMethodDef astCallbacks[] = {
+        {"array",       (PyCFunction)ast_array,      METH_O,           ""},
         {"assert_",     (PyCFunction)ast_assert,     METH_O,           ""},
         {"bv",          (PyCFunction)ast_bv,         METH_VARARGS,     ""},
         {"bvadd",       (PyCFunction)ast_bvadd,      METH_VARARGS,     ""},
@@ -1498,6 +1573,8 @@ namespace triton {
         {"lnot",        (PyCFunction)ast_lnot,       METH_O,           ""},
         {"lor",         (PyCFunction)ast_lor,        METH_VARARGS,     ""},
         {"reference",   (PyCFunction)ast_reference,  METH_O,           ""},
+        {"select",      (PyCFunction)ast_select,     METH_VARARGS,     ""},
+        {"store",       (PyCFunction)ast_store,      METH_VARARGS,     ""},
         {"string",      (PyCFunction)ast_string,     METH_O,           ""},
         {"sx",          (PyCFunction)ast_sx,         METH_VARARGS,     ""},
         {"variable",    (PyCFunction)ast_variable,   METH_O,           ""},
@@ -10,6 +10,7 @@
 #include <api.hpp>
 #include <bitsVector.hpp>
 #include <cpuSize.hpp>
+#include <exceptions.hpp>
 #include <immediate.hpp>
 #include <memoryAccess.hpp>
 #include <pythonBindings.hpp>
@@ -17,6 +18,7 @@
 #include <pythonUtils.hpp>
 #include <pythonXFunctions.hpp>
 #include <register.hpp>
+#include <x86Semantics.hpp>
 
 
 
@@ -53,6 +55,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 - \ref py_ElfRelocationTable_page
 - \ref py_ElfSectionHeader_page
 - \ref py_ElfSymbolTable_page
+- \ref py_ExplorationEngine_page
 - \ref py_Immediate_page
 - \ref py_Instruction_page
 - \ref py_MemoryAccess_page
@@ -60,6 +63,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 - \ref py_Register_page
 - \ref py_SolverModel_page
 - \ref py_SymbolicExpression_page
+- \ref py_SymbolicMapView_page
 - \ref py_SymbolicVariable_page
 
 
@@ -70,8 +74,16 @@ If you want to use the libTriton without Python bindings, recompile the project
 
 \subsection triton_py_api_methods Methods
 
-- <b>addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
+- <b>addCallback(function cb, \ref py_CALLBACK_page kind, [\ref py_AST_NODE_page, ...] filter=[])</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
+If a `filter` is given, a simplification callback only receives the roots whose kind is in the list.
+
+- <b>addSummaries(\ref py_Elf_page binary, integer base=0)</b><br>
+Binds the built-in summaries to the routines defined in the symbols table of a binary loaded at `base`. Returns the number of bound routines.
+When the first instruction of a summarized routine is processed, the effect of the whole call is applied instead. See \ref engine_Summary_page.
+
+- **addSummary(integer addr, string name)**<br>
+Binds the built-in summary of a libc routine (e.g: `memcpy`, `strlen`) to an address. Returns false if there is no built-in summary for this name.
 
 - <b>assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
@@ -95,6 +107,12 @@ Builds a symbolic memory cell from a \ref py_MemoryAccess_page and returns a \re
 - **buildSymbolicRegister(\ref py_REG_page reg)**<br>
 Builds a symbolic register from a \ref py_REG_page and returns a \ref py_AstNode_page.
 
+- **clearAstRulesStats(void)**<br>
+Resets the hit counters of the AST rules.
+
+- **clearConcreteCallbacksCache(void)**<br>
+Drops all memoized results of the `GET_CONCRETE_MEMORY_VALUE` and `GET_CONCRETE_REGISTER_VALUE` callbacks.
+
 - **clearPathConstraints(void)**<br>
 Clears the logical conjunction vector of path constraints.
 
@@ -146,21 +164,51 @@ Returns the new symbolic volatile expression as \ref py_SymbolicExpression_page
 - **disassembly(\ref py_Instruction_page inst)**<br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- **enableAstRule(\ref py_AST_RULE_page rule, bool flag)**<br>
+Enables or disables a rewriting rule applied when AST nodes are built. Only `AST_RULE.CONSTANT_FOLDING` is enabled by default.
+
+- **enableConcreteCallbacksCache(bool flag)**<br>
+Enabled, the `GET_CONCRETE_MEMORY_VALUE` and `GET_CONCRETE_REGISTER_VALUE` callbacks are called only once per address and
+register until the next instruction or a write through setConcreteMemoryValue() or setConcreteRegisterValue().
+
+- **enableConcreteCallbacksCachePerInstruction(bool flag)**<br>
+Enabled (default), the memoized results of concrete callbacks are dropped at each new instruction. Otherwise they are kept
+until clearConcreteCallbacksCache() is called.
+
 - **enableSymbolicEngine(bool flag)**<br>
 Enables or disables the symbolic execution engine.
 
 - **enableSymbolicOptimization(\ref py_OPTIMIZATION_page opti, bool flag)**<br>
 Enables or disablrs a symbolic optimization.
 
+- **enableSymbolicSimplificationBatchPerBlock(bool flag)**<br>
+Enabled, `SYMBOLIC_SIMPLIFICATION_BATCH` callbacks are called once per basic block instead of once per instruction.
+
 - **enableSymbolicZ3Simplification(bool flag)**<br>
 Enabled, Triton will use the simplification passes of z3 before to call its recorded simplification passes.
 
 - **enableTaintEngine(bool flag)**<br>
 Enables or disables the taint engine.
 
+- **enumerateModels(\ref py_AstNode_page node, function callback, integer limit=0, list variables=[], integer timeout=0, \ref py_SOLVER_page backend=SOLVER.BACKEND_DEFAULT)**<br>
+Enumerates the models of a symbolic constraint and calls `callback` on each one as a dictionary of {integer symVarId : \ref py_SolverModel_page model}.
+The enumeration stops when the callback returns False, after `limit` models (0 is unlimited) or when the `timeout` of the whole enumeration expires.
+Only the `variables` (ids or \ref py_SymbolicVariable_page) are projected, all variables of the constraint by default. Returns a tuple
+(integer count, \ref py_SOLVER_page status).
+
 - **evaluateAstViaZ3(\ref py_AstNode_page node)**<br>
 Evaluates an AST via Z3 and returns the symbolic value as integer.
 
+- **flushSymbolicSimplifications(void)**<br>
+Calls the `SYMBOLIC_SIMPLIFICATION_BATCH` callbacks on all symbolic expressions created since the last flush.
+
+- **freeze(void)**<br>
+Freezes the state once a trace is processed. All reference nodes are unrolled, then every function which modifies
+the state raises an exception and the concrete callbacks are no longer processed. Queries like getFullAstFromId(),
+getModel() or isMemoryTainted() may then be called concurrently on the same state. Reading the state takes no lock,
+building new AST nodes takes the lock of the AST garbage collector. Existing nodes are never modified, so
+AstNode::setChild() raises an exception and getFullAst() raises one on a node holding reference nodes.
+
 - **getAllRegisters(void)**<br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
@@ -176,8 +224,11 @@ Returns the partial AST as \ref py_AstNode_page from a symbolic expression id.
 - **getAstRepresentationMode(void)**<br>
 Returns the AST representation mode as \ref py_AST_REPRESENTATION_page.
 
+- **getAstRulesStats(void)**<br>
+Returns a dictionary which contains the number of times each AST rule has been applied.
+
 - **getConcreteMemoryAreaValue(integer baseAddr, integer size)**<br>
-Returns the concrete value of a memory area.
+Returns the concrete value of a memory area as bytes.
 
 - **getConcreteMemoryValue(intger addr)**<br>
 Returns the concrete value of a memory cell.
@@ -194,11 +245,15 @@ Returns the full AST of a root node as \ref py_AstNode_page.
 - **getFullAstFromId(integer symExprId)**<br>
 Returns the full AST as \ref py_AstNode_page from a symbolic expression id.
 
-- **getModel(\ref py_AstNode_page node)**<br>
+- **getModel(\ref py_AstNode_page node, integer timeout=0, bool status=False, \ref py_SOLVER_page backend=SOLVER.BACKEND_DEFAULT)**<br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
+The `timeout` is in milliseconds, 0 uses the default timeout. If `status` is True, returns a tuple (model, \ref py_SOLVER_page status).
+The query is sent to the `backend`. On a frozen state, the GIL is released while the solver runs, so several python threads
+may solve at the same time.
 
-- **getModels(\ref py_AstNode_page node)**<br>
-Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+- **getModels(\ref py_AstNode_page node, integer limit, integer timeout=0, bool status=False, \ref py_SOLVER_page backend=SOLVER.BACKEND_DEFAULT)**<br>
+Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. The `timeout` bounds
+the whole enumeration. If `status` is True, returns a tuple (models, \ref py_SOLVER_page status) where the status is the result of the last check.
 
 - **getParentRegisters(void)**<br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
@@ -209,14 +264,34 @@ Returns the logical conjunction vector of path constraints as list of \ref py_Pa
 - **getPathConstraintsAst(void)**<br>
 Returns the logical conjunction AST of path constraints as \ref py_AstNode_page.
 
+- **getPathConstraintsPrefixAst(integer count)**<br>
+Returns the logical conjunction AST of the first `count` path constraints as \ref py_AstNode_page. The prefixes share their sub-conjunctions, so
+`land(getPathConstraintsPrefixAst(k), branch)` is cheap to build when negating the k-th branch.
+
+- **getSolverBackend(void)**<br>
+Returns the default backend of the solver queries as \ref py_SOLVER_page.
+
+- **getSolverCapabilities(\ref py_SOLVER_page backend)**<br>
+Returns the capabilities of a solver backend as a mask of `SOLVER.CAPABILITY_*`.
+
+- **getSolverStatistics(void)**<br>
+Returns the statistics of the solver queries as a dictionary of {string name : integer value}. The names are `queries`, `sat`, `unsat`,
+`unknown`, `timeout`, `canceled`, `time_ms` and `max_time_ms`.
+
+- **getSummaries(void)**<br>
+Returns the summaries as a dictionary of {integer addr : string name}.
+
 - **getSymbolicExpressionFromId(intger symExprId)**<br>
 Returns the symbolic expression as \ref py_SymbolicExpression_page corresponding to the id.
 
 - **getSymbolicExpressions(void)**<br>
-Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+Returns all symbolic expressions as a \ref py_SymbolicMapView_page of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
 - **getSymbolicMemory(void)**<br>
-Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
+Returns the map of symbolic memory as a \ref py_SymbolicMapView_page of {integer address : \ref py_SymbolicExpression_page expr}.
+
+- **getSymbolicMemoryAreaValue(integer baseAddr, integer size)**<br>
+Returns the symbolic value of a memory area as bytes.
 
 - **getSymbolicMemoryId(intger addr)**<br>
 Returns the symbolic expression id as integer corresponding to the memory address.
@@ -245,12 +320,37 @@ Returns the symbolic variable as \ref py_SymbolicVariable_page corresponding to
 - **getSymbolicVariables(void)**<br>
 Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
 
+- **getSymbolicVariablesFromExpression(integer symExprId)**<br>
+Returns the symbolic variables reachable from a symbolic expression as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
+The full AST is not built, each node holds the variables of its tree.
+
 - **getTaintedSymbolicExpressions(void)**<br>
 Returns the list of all tainted \ref py_SymbolicExpression_page.
 
+- **interruptSolver(void)**<br>
+Interrupts the running solver queries of all threads, they return `SOLVER.CANCELED`.
+
+- **invalidateConcreteCallbacksCache(\ref py_MemoryAccess_page mem)**<br>
+Drops the memoized result of a memory access. Writes through Triton do it automatically.
+
+- **invalidateConcreteCallbacksCache(\ref py_REG_page reg)**<br>
+Drops the memoized result of a register. Writes through Triton do it automatically.
+
 - **isArchitectureValid(void)**<br>
 Returns true if the architecture is valid.
 
+- **isAstRuleEnabled(\ref py_AST_RULE_page rule)**<br>
+Returns true if the AST rule is enabled.
+
+- **isConcreteCallbacksCacheEnabled(void)**<br>
+Returns true if the concrete callbacks are memoized.
+
+- **isConcreteCallbacksCachePerInstructionEnabled(void)**<br>
+Returns true if the memoized results of concrete callbacks are dropped at each new instruction.
+
+- **isFrozen(void)**<br>
+Returns true if the state is frozen.
+
 - **isMemoryMapped(integer baseAddr, integer size=1)**<br>
 Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation.
 
@@ -263,6 +363,9 @@ Returns true if the memory is tainted.
 - **isRegisterTainted(\ref py_REG_page reg)**<br>
 Returns true if the register is tainted.
 
+- **isSummarized(integer addr)**<br>
+Returns true if a summary is bound to the address.
+
 - **isSymbolicEngineEnabled(void)**<br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -272,6 +375,9 @@ Returns true if the symbolic expression id exists.
 - **isSymbolicOptimizationEnabled(\ref py_OPTIMIZATION_page opti)**<br>
 Returns true if the symbolic optimization is enabled.
 
+- **isSymbolicSimplificationBatchPerBlockEnabled(void)**<br>
+Returns true if `SYMBOLIC_SIMPLIFICATION_BATCH` callbacks are called once per basic block.
+
 - **isSymbolicZ3SimplificationEnabled(void)**<br>
 Returns true if Triton can use the simplification passes of z3.
 
@@ -293,9 +399,18 @@ Removes all recorded callbacks.
 - <b>removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- **removeSummary(integer addr)**<br>
+Removes the summary bound to an address.
+
 - **resetEngines(void)**<br>
 Resets everything.
 
+- **resetSemanticsHandler(\ref py_OPCODE_page opcode)**<br>
+Restores the builtin semantics of an instruction overridden by `setSemanticsHandler()`.
+
+- **resetSolverStatistics(void)**<br>
+Clears the statistics of the solver queries.
+
 - **setArchitecture(\ref py_ARCH_page arch)**<br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -307,6 +422,8 @@ Sets the concrete value of a memory area. Note that by setting a concrete value
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
 - **setConcreteMemoryAreaValue(integer baseAddr, bytes opcodes)**<br>
+The `opcodes` argument may be any object which supports the buffer protocol (bytes, bytearray, memoryview, ...), its content
+is not copied into an intermediate list.
 Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
@@ -322,6 +439,19 @@ the symbolic state (if it exists). You should probably use the concretize functi
 Sets the concrete value of a register. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- **setSemanticsHandler(\ref py_OPCODE_page opcode, function handler)**<br>
+Sets (or overrides) the semantics of an instruction. When an instruction with this opcode is processed, `handler(inst)` is
+called in place of the builtin semantics and must build its expressions (e.g: with `createSymbolicRegisterExpression()`).
+
+- **setSolverBackend(\ref py_SOLVER_page backend)**<br>
+Sets the default backend of the solver queries, `SOLVER.BACKEND_Z3` or `SOLVER.BACKEND_BITBLAST`.
+
+- **setSolverMemoryLimit(integer mb)**<br>
+Sets the memory limit of the solver in megabytes, 0 if unlimited. The limit is shared by the whole process.
+
+- **setSolverTimeout(integer ms)**<br>
+Sets the default timeout of the solver queries in milliseconds, 0 if unlimited.
+
 - **setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)**<br>
 Sets the targeted memory as tainted or not.
 
@@ -332,6 +462,10 @@ Sets the targeted register as tainted or not.
 Calls all simplification callbacks recorded and returns the simplified node as \ref py_AstNode_page. If the `z3` flag is
 set to True, Triton will use z3 to simplify the given `node` before to call recorded callbacks.
 
+- **sliceExpressions(integer symExprId)**<br>
+Returns the backward slice of a symbolic expression as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+The slice contains the expression itself and all expressions it depends on, the full AST is not built.
+
 - <b>taintAssignmentMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an assignment - `memDst` is untained.
 
@@ -377,6 +511,9 @@ Taints `regDst` from `memSrc` with an union - `regDst` is tainted if `regDst` or
 - <b>taintUnionRegisterRegister(\ref py_REG_page regDst, \ref py_REG_page regSrc)</b><br>
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are tainted.
 
+- **unfreeze(void)**<br>
+Unfreezes the state, it may be modified again. The partial ASTs get their reference nodes back.
+
 - **unmapMemory(integer baseAddr, integer size=1)**<br>
 Removes the range `[baseAddr:size]` from the internal memory representation.
 
@@ -395,13 +532,16 @@ Untaints a register.
 - \ref py_ARCH_page
 - \ref py_AST_NODE_page
 - \ref py_AST_REPRESENTATION_page
+- \ref py_AST_RULE_page
 - \ref py_CALLBACK_page
 - \ref py_CPUSIZE_page
 - \ref py_ELF_page
+- \ref py_EXPLORATION_page
 - \ref py_OPCODE_page
 - \ref py_OPERAND_page
 - \ref py_OPTIMIZATION_page
 - \ref py_REG_page
+- \ref py_SOLVER_page
 - \ref py_SYMEXPR_page
 - \ref py_SYSCALL_page
 - \ref py_VERSION_page
@@ -583,6 +723,20 @@ namespace triton {
       }
 
 
+      static PyObject* triton_ExplorationEngine(PyObject* self, PyObject* binary) {
+        /* Check if the first arg is an Elf */
+        if (binary == nullptr || !PyElf_Check(binary))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine(): Expects an Elf as first argument.");
+
+        try {
+          return PyExplorationEngine(binary);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_Immediate(PyObject* self, PyObject* args) {
         PyObject* value = nullptr;
         PyObject* size  = nullptr;
@@ -679,11 +833,13 @@ namespace triton {
 
 
       static PyObject* triton_addCallback(PyObject* self, PyObject* args) {
+        std::set<triton::ast::kind_e> kinds;
         PyObject* function = nullptr;
         PyObject* mode     = nullptr;
+        PyObject* filter   = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &function, &mode);
+        PyArg_ParseTuple(args, "|OOO", &function, &mode, &filter);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -695,8 +851,20 @@ namespace triton {
         if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
           return PyErr_Format(PyExc_TypeError, "addCallback(): Expects a CALLBACK as second argument.");
 
+        if (filter != nullptr && !PyList_Check(filter))
+          return PyErr_Format(PyExc_TypeError, "addCallback(): Expects a list of AST_NODE as third argument.");
+
+        if (filter != nullptr) {
+          for (Py_ssize_t index = 0; index < PyList_Size(filter); index++) {
+            PyObject* item = PyList_GetItem(filter, index);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "addCallback(): Expects a list of AST_NODE as third argument.");
+            kinds.insert(static_cast<triton::ast::kind_e>(PyLong_AsUint32(item)));
+          }
+        }
+
         try {
-          triton::api.addCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)));
+          triton::api.addCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)), kinds);
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -707,6 +875,63 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addSummaries(PyObject* self, PyObject* args) {
+        PyObject* binary      = nullptr;
+        PyObject* base        = nullptr;
+        triton::uint64 c_base = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &binary, &base);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSummaries(): Architecture is not defined.");
+
+        if (binary == nullptr || !PyElf_Check(binary))
+          return PyErr_Format(PyExc_TypeError, "addSummaries(): Expects an Elf as first argument.");
+
+        if (base != nullptr && !PyLong_Check(base) && !PyInt_Check(base))
+          return PyErr_Format(PyExc_TypeError, "addSummaries(): Expects a base address (integer) as second argument.");
+
+        try {
+          if (base != nullptr)
+            c_base = PyLong_AsUint64(base);
+          return PyLong_FromUsize(triton::api.addSummaries(*PyElf_AsElf(binary), c_base));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_addSummary(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* name = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &name);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSummary(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "addSummary(): Expects an address (integer) as first argument.");
+
+        if (name == nullptr || !PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "addSummary(): Expects a name (string) as second argument.");
+
+        try {
+          if (triton::api.addSummary(PyLong_AsUint64(addr), PyString_AsString(name)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -780,6 +1005,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "buildSemantics(): Expects an Instruction as argument.");
 
         try {
+          PyInstruction_Invalidate(inst);
           triton::api.buildSemantics(*PyInstruction_AsInstruction(inst));
         }
         catch (const std::exception& e) {
@@ -842,6 +1068,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearAstRulesStats(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearAstRulesStats(): Architecture is not defined.");
+        triton::api.clearAstRulesStats();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearConcreteCallbacksCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearConcreteCallbacksCache(): Architecture is not defined.");
+        triton::api.clearConcreteCallbacksCache();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_clearPathConstraints(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1050,7 +1296,7 @@ namespace triton {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicFlagExpression(): Architecture is not defined.");
 
-        if (inst == nullptr || (!PyInstance_Check(inst)))
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
           return PyErr_Format(PyExc_TypeError, "createSymbolicFlagExpression(): Expects an Instruction as first argument.");
 
         if (node == nullptr || (!PyAstNode_Check(node)))
@@ -1065,11 +1311,13 @@ namespace triton {
         if (comment != nullptr)
           ccomment = PyString_AsString(comment);
 
-        triton::arch::Instruction arg1 = *PyInstruction_AsInstruction(inst);
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
         triton::ast::AbstractNode *arg2 = PyAstNode_AsAstNode(node);
         triton::arch::Register arg3 = *PyRegister_AsRegister(flag);
 
         try {
+          /* The expression is added to the instruction itself */
+          PyInstruction_Invalidate(inst);
           return PySymbolicExpression(triton::api.createSymbolicFlagExpression(arg1, arg2, arg3, ccomment));
         }
         catch (const std::exception& e) {
@@ -1092,7 +1340,7 @@ namespace triton {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicMemoryExpression(): Architecture is not defined.");
 
-        if (inst == nullptr || (!PyInstance_Check(inst)))
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
           return PyErr_Format(PyExc_TypeError, "createSymbolicMemoryExpression(): Expects an Instruction as first argument.");
 
         if (node == nullptr || (!PyAstNode_Check(node)))
@@ -1107,11 +1355,13 @@ namespace triton {
         if (comment != nullptr)
           ccomment = PyString_AsString(comment);
 
-        triton::arch::Instruction arg1 = *PyInstruction_AsInstruction(inst);
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
         triton::ast::AbstractNode *arg2 = PyAstNode_AsAstNode(node);
         triton::arch::MemoryAccess arg3 = *PyMemoryAccess_AsMemoryAccess(mem);
 
         try {
+          /* The expression is added to the instruction itself */
+          PyInstruction_Invalidate(inst);
           return PySymbolicExpression(triton::api.createSymbolicMemoryExpression(arg1, arg2, arg3, ccomment));
         }
         catch (const std::exception& e) {
@@ -1134,7 +1384,7 @@ namespace triton {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicRegisterExpression(): Architecture is not defined.");
 
-        if (inst == nullptr || (!PyInstance_Check(inst)))
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
           return PyErr_Format(PyExc_TypeError, "createSymbolicRegisterExpression(): Expects an Instruction as first argument.");
 
         if (node == nullptr || (!PyAstNode_Check(node)))
@@ -1149,11 +1399,13 @@ namespace triton {
         if (comment != nullptr)
           ccomment = PyString_AsString(comment);
 
-        triton::arch::Instruction arg1 = *PyInstruction_AsInstruction(inst);
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
         triton::ast::AbstractNode *arg2 = PyAstNode_AsAstNode(node);
         triton::arch::Register arg3 = *PyRegister_AsRegister(reg);
 
         try {
+          /* The expression is added to the instruction itself */
+          PyInstruction_Invalidate(inst);
           return PySymbolicExpression(triton::api.createSymbolicRegisterExpression(arg1, arg2, arg3, ccomment));
         }
         catch (const std::exception& e) {
@@ -1175,7 +1427,7 @@ namespace triton {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicVolatileExpression(): Architecture is not defined.");
 
-        if (inst == nullptr || (!PyInstance_Check(inst)))
+        if (inst == nullptr || (!PyInstruction_Check(inst)))
           return PyErr_Format(PyExc_TypeError, "createSymbolicVolatileExpression(): Expects an Instruction as first argument.");
 
         if (node == nullptr || (!PyAstNode_Check(node)))
@@ -1187,10 +1439,12 @@ namespace triton {
         if (comment != nullptr)
           ccomment = PyString_AsString(comment);
 
-        triton::arch::Instruction arg1 = *PyInstruction_AsInstruction(inst);
+        triton::arch::Instruction& arg1 = *PyInstruction_AsInstruction(inst);
         triton::ast::AbstractNode *arg2 = PyAstNode_AsAstNode(node);
 
         try {
+          /* The expression is added to the instruction itself */
+          PyInstruction_Invalidate(inst);
           return PySymbolicExpression(triton::api.createSymbolicVolatileExpression(arg1, arg2, ccomment));
         }
         catch (const std::exception& e) {
@@ -1208,6 +1462,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "disassembly(): Expects an Instruction as argument.");
 
         try {
+          PyInstruction_Invalidate(inst);
           triton::api.disassembly(*PyInstruction_AsInstruction(inst));
         }
         catch (const std::exception& e) {
@@ -1219,6 +1474,63 @@ namespace triton {
       }
 
 
+      static PyObject* triton_enableAstRule(PyObject* self, PyObject* args) {
+        PyObject* rule = nullptr;
+        PyObject* flag = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &rule, &flag);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableAstRule(): Architecture is not defined.");
+
+        if (rule == nullptr || (!PyLong_Check(rule) && !PyInt_Check(rule)))
+          return PyErr_Format(PyExc_TypeError, "enableAstRule(): Expects an AST_RULE as argument.");
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableAstRule(): Expects an boolean flag as second argument.");
+
+        try {
+          triton::api.enableAstRule(static_cast<enum triton::ast::rule_e>(PyLong_AsUint32(rule)), PyLong_AsBool(flag));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_enableConcreteCallbacksCache(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableConcreteCallbacksCache(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableConcreteCallbacksCache(): Expects a boolean as argument.");
+
+        triton::api.enableConcreteCallbacksCache(PyLong_AsBool(flag));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_enableConcreteCallbacksCachePerInstruction(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableConcreteCallbacksCachePerInstruction(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableConcreteCallbacksCachePerInstruction(): Expects a boolean as argument.");
+
+        triton::api.enableConcreteCallbacksCachePerInstruction(PyLong_AsBool(flag));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_enableSymbolicEngine(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1268,6 +1580,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_enableSymbolicSimplificationBatchPerBlock(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableSymbolicSimplificationBatchPerBlock(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableSymbolicSimplificationBatchPerBlock(): Expects a boolean as argument.");
+
+        try {
+          triton::api.enableSymbolicSimplificationBatchPerBlock(PyLong_AsBool(flag));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_enableSymbolicZ3Simplification(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1308,6 +1640,102 @@ namespace triton {
       }
 
 
+      /* Calls the python callback of enumerateModels() on a model */
+      static bool enumerateModelsCallback(const std::map<triton::uint32, triton::engines::solver::SolverModel>& model, void* data) {
+        PyObject* mdict = xPyDict_New();
+        for (auto it = model.begin(); it != model.end(); it++)
+          PyDict_SetItem(mdict, PyLong_FromUint32(it->first), PySolverModel(it->second));
+
+        /* Create function args */
+        PyObject* args = xPyTuple_New(1);
+        PyTuple_SetItem(args, 0, mdict);
+
+        /* Call the callback */
+        PyObject* ret = PyObject_CallObject(static_cast<PyObject*>(data), args);
+        Py_DECREF(args);
+
+        /* Check the call */
+        if (ret == nullptr) {
+          PyErr_Print();
+          throw triton::exceptions::Callbacks("enumerateModels(): Fail to call the python callback.");
+        }
+
+        /* Only False stops the enumeration */
+        bool next = (ret != Py_False);
+        Py_DECREF(ret);
+
+        return next;
+      }
+
+
+      static PyObject* triton_enumerateModels(PyObject* self, PyObject* args) {
+        PyObject* node      = nullptr;
+        PyObject* function  = nullptr;
+        PyObject* limit     = nullptr;
+        PyObject* variables = nullptr;
+        PyObject* timeout   = nullptr;
+        PyObject* backend   = nullptr;
+        PyObject* ret       = nullptr;
+        std::vector<triton::usize> projection;
+        triton::engines::solver::status_e status;
+        triton::usize count = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOOOO", &node, &function, &limit, &variables, &timeout, &backend);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Expects a AstNode as first argument.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Expects a function as second argument.");
+
+        if (limit != nullptr && !PyLong_Check(limit) && !PyInt_Check(limit))
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Expects an integer as third argument.");
+
+        if (variables != nullptr && !PyList_Check(variables))
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Expects a list as fourth argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Expects an integer as fifth argument.");
+
+        if (backend != nullptr && !PyLong_Check(backend) && !PyInt_Check(backend))
+          return PyErr_Format(PyExc_TypeError, "enumerateModels(): Expects a SOLVER backend as sixth argument.");
+
+        /* Extract the projection */
+        if (variables != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(variables); i++) {
+            PyObject* item = PyList_GetItem(variables, i);
+            if (PySymbolicVariable_Check(item))
+              projection.push_back(PySymbolicVariable_AsSymbolicVariable(item)->getId());
+            else if (PyLong_Check(item) || PyInt_Check(item))
+              projection.push_back(PyLong_AsUsize(item));
+            else
+              return PyErr_Format(PyExc_TypeError, "enumerateModels(): Each item of the list must be an integer or a SymbolicVariable.");
+          }
+        }
+
+        try {
+          count = triton::api.enumerateModels(PyAstNode_AsAstNode(node), enumerateModelsCallback, function,
+                                              limit != nullptr ? PyLong_AsUint32(limit) : 0, projection, &status,
+                                              timeout != nullptr ? PyLong_AsUint32(timeout) : 0,
+                                              backend != nullptr ? static_cast<triton::engines::solver::backend_e>(PyLong_AsUint32(backend)) : triton::engines::solver::BACKEND_DEFAULT);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        ret = xPyTuple_New(2);
+        PyTuple_SetItem(ret, 0, PyLong_FromUsize(count));
+        PyTuple_SetItem(ret, 1, PyLong_FromUint32(status));
+
+        return ret;
+      }
+
+
       static PyObject* triton_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1331,6 +1759,40 @@ namespace triton {
       }
 
 
+      static PyObject* triton_flushSymbolicSimplifications(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "flushSymbolicSimplifications(): Architecture is not defined.");
+
+        try {
+          triton::api.flushSymbolicSimplifications();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_freeze(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "freeze(): Architecture is not defined.");
+
+        try {
+          triton::api.freeze();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         std::set<triton::arch::Register*> reg;
@@ -1408,9 +1870,31 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getAstRulesStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        std::map<std::string, triton::usize> stats;
+        std::map<std::string, triton::usize>::iterator it;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstRulesStats(): Architecture is not defined.");
+
+        try {
+          stats = triton::api.getAstRulesStats();
+          ret   = xPyDict_New();
+          for (it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
         std::vector<triton::uint8> vv;
-        triton::uint8*  area = nullptr;
         PyObject*       ret  = nullptr;
         PyObject*       addr = nullptr;
         PyObject*       size = nullptr;
@@ -1423,16 +1907,9 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Architecture is not defined.");
 
         try {
-          vv   = triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
-          area = new triton::uint8[vv.size()];
-
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
-
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
+          vv  = triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
+          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(vv.data()), vv.size());
           return ret;
-
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1512,21 +1989,61 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getModel(PyObject* self, PyObject* node) {
-        PyObject* ret = nullptr;
+      static PyObject* triton_getModel(PyObject* self, PyObject* args) {
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* timeout = nullptr;
+        PyObject* flag    = nullptr;
+        PyObject* backend = nullptr;
+        triton::engines::solver::status_e status;
         std::map<triton::uint32, triton::engines::solver::SolverModel> model;
         std::map<triton::uint32, triton::engines::solver::SolverModel>::iterator it;
 
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &node, &timeout, &flag, &backend);
+
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "getModel(): Architecture is not defined.");
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as first argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects an integer as second argument.");
+
+        if (flag != nullptr && !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a boolean as third argument.");
+
+        if (backend != nullptr && !PyLong_Check(backend) && !PyInt_Check(backend))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a SOLVER backend as fourth argument.");
 
         try {
+          triton::ast::AbstractNode* constraint = PyAstNode_AsAstNode(node);
+          triton::uint32 ms = (timeout != nullptr ? PyLong_AsUint32(timeout) : 0);
+          triton::engines::solver::backend_e kind = (backend != nullptr ? static_cast<triton::engines::solver::backend_e>(PyLong_AsUint32(backend)) : triton::engines::solver::BACKEND_DEFAULT);
+
+          /* A frozen state does not call back into python, other threads may query it while the solver runs */
+          if (triton::api.isFrozen()) {
+            std::string error;
+
+            Py_BEGIN_ALLOW_THREADS
+            try {
+              model = triton::api.getModel(constraint, &status, ms, kind);
+            }
+            catch (const std::exception& e) {
+              error = e.what();
+            }
+            Py_END_ALLOW_THREADS
+
+            if (!error.empty())
+              return PyErr_Format(PyExc_TypeError, "%s", error.c_str());
+          }
+          else {
+            model = triton::api.getModel(constraint, &status, ms, kind);
+          }
+
           ret = xPyDict_New();
-          model = triton::api.getModel(PyAstNode_AsAstNode(node));
           for (it = model.begin(); it != model.end(); it++) {
             PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
           }
@@ -1535,20 +2052,31 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        if (flag != nullptr && PyLong_AsBool(flag)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
+        return ret;
       }
 
 
       static PyObject* triton_getModels(PyObject* self, PyObject* args) {
-        PyObject* ret   = nullptr;
-        PyObject* node  = nullptr;
-        PyObject* limit = nullptr;
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* limit   = nullptr;
+        PyObject* timeout = nullptr;
+        PyObject* flag    = nullptr;
+        PyObject* backend = nullptr;
         triton::uint32 index = 0;
+        triton::engines::solver::status_e status;
         std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
         std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>>::iterator it;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &limit);
+        PyArg_ParseTuple(args, "|OOOOO", &node, &limit, &timeout, &flag, &backend);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1560,8 +2088,18 @@ namespace triton {
         if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
           return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
 
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as third argument.");
+
+        if (flag != nullptr && !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a boolean as fourth argument.");
+
+        if (backend != nullptr && !PyLong_Check(backend) && !PyInt_Check(backend))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a SOLVER backend as fifth argument.");
+
         try {
-          models = triton::api.getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
+          models = triton::api.getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit), &status, timeout != nullptr ? PyLong_AsUint32(timeout) : 0,
+                                         backend != nullptr ? static_cast<triton::engines::solver::backend_e>(PyLong_AsUint32(backend)) : triton::engines::solver::BACKEND_DEFAULT);
           ret = xPyList_New(models.size());
           for (it = models.begin(); it != models.end(); it++) {
             PyObject* mdict = xPyDict_New();
@@ -1577,6 +2115,13 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        if (flag != nullptr && PyLong_AsBool(flag)) {
+          PyObject* tuple = xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          return tuple;
+        }
+
         return ret;
       }
 
@@ -1642,16 +2187,16 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
+      static PyObject* triton_getPathConstraintsPrefixAst(PyObject* self, PyObject* count) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsPrefixAst(): Architecture is not defined.");
 
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+        if (!PyLong_Check(count) && !PyInt_Check(count))
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsPrefixAst(): Expects an integer as argument.");
 
         try {
-          return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+          return PyAstNode(triton::api.getPathConstraintsPrefixAst(PyLong_AsUsize(count)));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1659,19 +2204,49 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_getSolverBackend(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverBackend(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUint32(triton::api.getSolverBackend());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSolverCapabilities(PyObject* self, PyObject* backend) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverCapabilities(): Architecture is not defined.");
+
+        if (!PyLong_Check(backend) && !PyInt_Check(backend))
+          return PyErr_Format(PyExc_TypeError, "getSolverCapabilities(): Expects a SOLVER backend as argument.");
+
+        try {
+          return PyLong_FromUint32(triton::api.getSolverCapabilities(static_cast<triton::engines::solver::backend_e>(PyLong_AsUint32(backend))));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSolverStatistics(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& expressions = triton::api.getSymbolicExpressions();
-        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getSolverStatistics(): Architecture is not defined.");
 
         try {
+          std::map<std::string, triton::usize> stats = triton::api.getSolverStatistics();
           ret = xPyDict_New();
-          for (it = expressions.begin(); it != expressions.end(); it++)
-            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1681,20 +2256,18 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicMemory(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_getSummaries(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> regs = triton::api.getSymbolicMemory();
-        std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*>::iterator it;
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getSummaries(): Architecture is not defined.");
 
         try {
+          const std::map<triton::uint64, std::string>& summaries = triton::api.getSummaries();
           ret = xPyDict_New();
-          for (it = regs.begin(); it != regs.end(); it++) {
-            PyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-          }
+          for (auto it = summaries.begin(); it != summaries.end(); it++)
+            PyDict_SetItem(ret, PyLong_FromUint64(it->first), PyString_FromString(it->second.c_str()));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1704,6 +2277,71 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressions(): Architecture is not defined.");
+
+        /* The expressions are wrapped only when they are accessed */
+        return PySymbolicMapView(triton::bindings::python::SYMBOLIC_EXPRESSIONS_VIEW);
+      }
+
+
+      static PyObject* triton_getSymbolicMemory(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Architecture is not defined.");
+
+        /* The expressions are wrapped only when they are accessed */
+        return PySymbolicMapView(triton::bindings::python::SYMBOLIC_MEMORY_VIEW);
+      }
+
+
+      static PyObject* triton_getSymbolicMemoryAreaValue(PyObject* self, PyObject* args) {
+        std::vector<triton::uint8> vv;
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryAreaValue(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryAreaValue(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryAreaValue(): Expects an integer as second argument.");
+
+        try {
+          vv = triton::api.getSymbolicMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
+          return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(vv.data()), vv.size());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getSymbolicMemoryId(PyObject* self, PyObject* addr) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1855,6 +2493,32 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getSymbolicVariablesFromExpression(PyObject* self, PyObject* symExprId) {
+        PyObject* ret = nullptr;
+        std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*> variables;
+        std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>::const_iterator it;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariablesFromExpression(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariablesFromExpression(): Expects an integer as argument.");
+
+        try {
+          variables = triton::api.getSymbolicVariablesFromExpression(PyLong_AsUsize(symExprId));
+          ret = xPyDict_New();
+          for (it = variables.begin(); it != variables.end(); it++)
+            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicVariable(it->second));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -1882,6 +2546,42 @@ namespace triton {
       }
 
 
+      static PyObject* triton_interruptSolver(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "interruptSolver(): Architecture is not defined.");
+
+        try {
+          triton::api.interruptSolver();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_invalidateConcreteCallbacksCache(PyObject* self, PyObject* obj) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "invalidateConcreteCallbacksCache(): Architecture is not defined.");
+
+        if (PyMemoryAccess_Check(obj))
+          triton::api.invalidateConcreteCallbacksCache(*PyMemoryAccess_AsMemoryAccess(obj));
+
+        else if (PyRegister_Check(obj))
+          triton::api.invalidateConcreteCallbacksCache(*PyRegister_AsRegister(obj));
+
+        else
+          return PyErr_Format(PyExc_TypeError, "invalidateConcreteCallbacksCache(): Expects a MemoryAccess or a Register as argument.");
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_isArchitectureValid(PyObject* self, PyObject* noarg) {
         if (triton::api.isArchitectureValid() == true)
           Py_RETURN_TRUE;
@@ -1889,6 +2589,51 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isAstRuleEnabled(PyObject* self, PyObject* rule) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isAstRuleEnabled(): Architecture is not defined.");
+
+        if (!PyInt_Check(rule) && !PyLong_Check(rule))
+          return PyErr_Format(PyExc_TypeError, "isAstRuleEnabled(): Expects an AST_RULE as argument.");
+
+        try {
+          if (triton::api.isAstRuleEnabled(static_cast<enum triton::ast::rule_e>(PyLong_AsUint32(rule))) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_isConcreteCallbacksCacheEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isConcreteCallbacksCacheEnabled(): Architecture is not defined.");
+
+        if (triton::api.isConcreteCallbacksCacheEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isConcreteCallbacksCachePerInstructionEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isConcreteCallbacksCachePerInstructionEnabled(): Architecture is not defined.");
+
+        if (triton::api.isConcreteCallbacksCachePerInstructionEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isFrozen(PyObject* self, PyObject* noarg) {
+        if (triton::api.isFrozen() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_isMemoryMapped(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -1958,6 +2703,25 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isSummarized(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSummarized(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "isSummarized(): Expects an integer as argument.");
+
+        try {
+          if (triton::api.isSummarized(PyLong_AsUint64(addr)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "isSymbolicEngineEnabled(): Architecture is not defined.");
@@ -1994,6 +2758,16 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isSymbolicSimplificationBatchPerBlockEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSymbolicSimplificationBatchPerBlockEnabled(): Architecture is not defined.");
+
+        if (triton::api.isSymbolicSimplificationBatchPerBlockEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_isSymbolicZ3SimplificationEnabled(PyObject* self, PyObject* noarg) {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "isSymbolicZ3SimplificationEnabled(): Architecture is not defined.");
@@ -2083,6 +2857,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "processing(): Expects an Instruction as argument.");
 
         try {
+          PyInstruction_Invalidate(inst);
           triton::api.processing(*PyInstruction_AsInstruction(inst));
         }
         catch (const std::exception& e) {
@@ -2136,6 +2911,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_removeSummary(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSummary(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "removeSummary(): Expects an integer as argument.");
+
+        try {
+          triton::api.removeSummary(PyLong_AsUint64(addr));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2153,6 +2948,88 @@ namespace triton {
       }
 
 
+      /* The python handlers of setSemanticsHandler() according to the instruction id */
+      static std::map<triton::uint32, PyObject*> semanticsHandlers;
+
+
+      /* Calls the python handler of an instruction. The handler works on a copy which is then copied back */
+      static void semanticsHandler(triton::arch::Instruction& inst) {
+        std::map<triton::uint32, PyObject*>::iterator it = semanticsHandlers.find(inst.getType());
+        if (it == semanticsHandlers.end())
+          return;
+
+        /* The handler may reset itself */
+        PyObject* function = it->second;
+        Py_INCREF(function);
+
+        /* Create function args */
+        PyObject* pyInst = PyInstruction(inst);
+        PyObject* args   = xPyTuple_New(1);
+        Py_INCREF(pyInst);
+        PyTuple_SetItem(args, 0, pyInst);
+
+        /* Call the handler */
+        PyObject* ret = PyObject_CallObject(function, args);
+        Py_DECREF(args);
+        Py_DECREF(function);
+
+        /* Check the call */
+        if (ret == nullptr) {
+          PyErr_Print();
+          Py_DECREF(pyInst);
+          throw triton::exceptions::Callbacks("setSemanticsHandler(): Fail to call the python handler.");
+        }
+
+        inst = *PyInstruction_AsInstruction(pyInst);
+        Py_DECREF(ret);
+        Py_DECREF(pyInst);
+      }
+
+
+      static PyObject* triton_resetSemanticsHandler(PyObject* self, PyObject* opcode) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "resetSemanticsHandler(): Architecture is not defined.");
+
+        if (!PyLong_Check(opcode) && !PyInt_Check(opcode))
+          return PyErr_Format(PyExc_TypeError, "resetSemanticsHandler(): Expects an OPCODE as argument.");
+
+        try {
+          triton::uint32 id = PyLong_AsUint32(opcode);
+          triton::arch::x86::semantics::resetHandler(id);
+
+          std::map<triton::uint32, PyObject*>::iterator it = semanticsHandlers.find(id);
+          if (it != semanticsHandlers.end()) {
+            Py_DECREF(it->second);
+            semanticsHandlers.erase(it);
+          }
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_resetSolverStatistics(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "resetSolverStatistics(): Architecture is not defined.");
+
+        try {
+          triton::api.resetSolverStatistics();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2248,6 +3125,24 @@ namespace triton {
           }
         }
 
+        // Python object: any other buffer (memoryview, ...)
+        else if (PyObject_CheckBuffer(values)) {
+          Py_buffer view;
+
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0)
+            return nullptr;
+
+          try {
+            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
+          }
+          catch (const std::exception& e) {
+            PyBuffer_Release(&view);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+          PyBuffer_Release(&view);
+        }
+
         // Invalid Python object
         else
           return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a bytes array as second argument.");
@@ -2329,6 +3224,100 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setSemanticsHandler(PyObject* self, PyObject* args) {
+        PyObject* opcode   = nullptr;
+        PyObject* function = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &opcode, &function);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSemanticsHandler(): Architecture is not defined.");
+
+        if (opcode == nullptr || (!PyLong_Check(opcode) && !PyInt_Check(opcode)))
+          return PyErr_Format(PyExc_TypeError, "setSemanticsHandler(): Expects an OPCODE as first argument.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "setSemanticsHandler(): Expects a function as second argument.");
+
+        try {
+          triton::uint32 id = PyLong_AsUint32(opcode);
+          triton::arch::x86::semantics::setHandler(id, semanticsHandler);
+
+          Py_INCREF(function);
+          Py_XDECREF(semanticsHandlers[id]);
+          semanticsHandlers[id] = function;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverBackend(PyObject* self, PyObject* backend) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverBackend(): Architecture is not defined.");
+
+        if (!PyLong_Check(backend) && !PyInt_Check(backend))
+          return PyErr_Format(PyExc_TypeError, "setSolverBackend(): Expects a SOLVER backend as argument.");
+
+        try {
+          triton::api.setSolverBackend(static_cast<triton::engines::solver::backend_e>(PyLong_AsUint32(backend)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverMemoryLimit(PyObject* self, PyObject* mb) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Architecture is not defined.");
+
+        if (!PyLong_Check(mb) && !PyInt_Check(mb))
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverMemoryLimit(PyLong_AsUint32(mb));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverTimeout(PyObject* self, PyObject* ms) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Architecture is not defined.");
+
+        if (!PyLong_Check(ms) && !PyInt_Check(ms))
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverTimeout(PyLong_AsUint32(ms));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem    = nullptr;
         PyObject* flag   = nullptr;
@@ -2414,6 +3403,32 @@ namespace triton {
       }
 
 
+      static PyObject* triton_sliceExpressions(PyObject* self, PyObject* symExprId) {
+        PyObject* ret = nullptr;
+        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> expressions;
+        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Expects an integer as argument.");
+
+        try {
+          expressions = triton::api.sliceExpressions(PyLong_AsUsize(symExprId));
+          ret = xPyDict_New();
+          for (it = expressions.begin(); it != expressions.end(); it++)
+            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_taintAssignmentMemoryImmediate(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2759,6 +3774,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_unfreeze(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "unfreeze(): Architecture is not defined.");
+
+        try {
+          triton::api.unfreeze();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_unmapMemory(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -2841,17 +3873,22 @@ namespace triton {
       PyMethodDef tritonCallbacks[] = {
         {"Bitvector",                           (PyCFunction)triton_Bitvector,                              METH_VARARGS,       ""},
         {"Elf",                                 (PyCFunction)triton_Elf,                                    METH_O,             ""},
+        {"ExplorationEngine",                   (PyCFunction)triton_ExplorationEngine,                      METH_O,             ""},
         {"Immediate",                           (PyCFunction)triton_Immediate,                              METH_VARARGS,       ""},
         {"Instruction",                         (PyCFunction)triton_Instruction,                            METH_NOARGS,        ""},
         {"MemoryAccess",                        (PyCFunction)triton_MemoryAccess,                           METH_VARARGS,       ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addSummaries",                        (PyCFunction)triton_addSummaries,                           METH_VARARGS,       ""},
+        {"addSummary",                          (PyCFunction)triton_addSummary,                             METH_VARARGS,       ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
         {"buildSymbolicImmediate",              (PyCFunction)triton_buildSymbolicImmediate,                 METH_O,             ""},
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
+        {"clearAstRulesStats",                  (PyCFunction)triton_clearAstRulesStats,                     METH_NOARGS,        ""},
+        {"clearConcreteCallbacksCache",         (PyCFunction)triton_clearConcreteCallbacksCache,            METH_NOARGS,        ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
@@ -2868,29 +3905,43 @@ namespace triton {
         {"createSymbolicRegisterExpression",    (PyCFunction)triton_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)triton_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
         {"disassembly",                         (PyCFunction)triton_disassembly,                            METH_O,             ""},
+        {"enableAstRule",                       (PyCFunction)triton_enableAstRule,                          METH_VARARGS,       ""},
+        {"enableConcreteCallbacksCache",        (PyCFunction)triton_enableConcreteCallbacksCache,           METH_O,             ""},
+        {"enableConcreteCallbacksCachePerInstruction", (PyCFunction)triton_enableConcreteCallbacksCachePerInstruction, METH_O, ""},
         {"enableSymbolicEngine",                (PyCFunction)triton_enableSymbolicEngine,                   METH_O,             ""},
         {"enableSymbolicOptimization",          (PyCFunction)triton_enableSymbolicOptimization,             METH_VARARGS,       ""},
+        {"enableSymbolicSimplificationBatchPerBlock", (PyCFunction)triton_enableSymbolicSimplificationBatchPerBlock, METH_O, ""},
         {"enableSymbolicZ3Simplification",      (PyCFunction)triton_enableSymbolicZ3Simplification,         METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
+        {"enumerateModels",                     (PyCFunction)triton_enumerateModels,                        METH_VARARGS,       ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
+        {"flushSymbolicSimplifications",        (PyCFunction)triton_flushSymbolicSimplifications,           METH_NOARGS,        ""},
+        {"freeze",                              (PyCFunction)triton_freeze,                                 METH_NOARGS,        ""},
         {"getAllRegisters",                     (PyCFunction)triton_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
+        {"getAstRulesStats",                    (PyCFunction)triton_getAstRulesStats,                       METH_NOARGS,        ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
-        {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
+        {"getModel",                            (PyCFunction)triton_getModel,                               METH_VARARGS,       ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getPathConstraintsPrefixAst",         (PyCFunction)triton_getPathConstraintsPrefixAst,            METH_O,             ""},
+        {"getSolverBackend",                    (PyCFunction)triton_getSolverBackend,                       METH_NOARGS,        ""},
+        {"getSolverCapabilities",               (PyCFunction)triton_getSolverCapabilities,                  METH_O,             ""},
+        {"getSolverStatistics",                 (PyCFunction)triton_getSolverStatistics,                    METH_NOARGS,        ""},
+        {"getSummaries",                        (PyCFunction)triton_getSummaries,                           METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
+        {"getSymbolicMemoryAreaValue",          (PyCFunction)triton_getSymbolicMemoryAreaValue,             METH_VARARGS,       ""},
         {"getSymbolicMemoryId",                 (PyCFunction)triton_getSymbolicMemoryId,                    METH_O,             ""},
         {"getSymbolicMemoryValue",              (PyCFunction)triton_getSymbolicMemoryValue,                 METH_O,             ""},
         {"getSymbolicRegisterId",               (PyCFunction)triton_getSymbolicRegisterId,                  METH_O,             ""},
@@ -2899,14 +3950,23 @@ namespace triton {
         {"getSymbolicVariableFromId",           (PyCFunction)triton_getSymbolicVariableFromId,              METH_O,             ""},
         {"getSymbolicVariableFromName",         (PyCFunction)triton_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)triton_getSymbolicVariables,                   METH_NOARGS,        ""},
+        {"getSymbolicVariablesFromExpression",  (PyCFunction)triton_getSymbolicVariablesFromExpression,     METH_O,             ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
+        {"interruptSolver",                     (PyCFunction)triton_interruptSolver,                        METH_NOARGS,        ""},
+        {"invalidateConcreteCallbacksCache",    (PyCFunction)triton_invalidateConcreteCallbacksCache,       METH_O,             ""},
         {"isArchitectureValid",                 (PyCFunction)triton_isArchitectureValid,                    METH_NOARGS,        ""},
+        {"isAstRuleEnabled",                    (PyCFunction)triton_isAstRuleEnabled,                       METH_O,             ""},
+        {"isConcreteCallbacksCacheEnabled",     (PyCFunction)triton_isConcreteCallbacksCacheEnabled,        METH_NOARGS,        ""},
+        {"isConcreteCallbacksCachePerInstructionEnabled", (PyCFunction)triton_isConcreteCallbacksCachePerInstructionEnabled, METH_NOARGS, ""},
+        {"isFrozen",                            (PyCFunction)triton_isFrozen,                               METH_NOARGS,        ""},
         {"isMemoryMapped",                      (PyCFunction)triton_isMemoryMapped,                         METH_VARARGS,       ""},
         {"isMemoryTainted",                     (PyCFunction)triton_isMemoryTainted,                        METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)triton_isRegisterTainted,                      METH_O,             ""},
+        {"isSummarized",                        (PyCFunction)triton_isSummarized,                           METH_O,             ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)triton_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)triton_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isSymbolicOptimizationEnabled",       (PyCFunction)triton_isSymbolicOptimizationEnabled,          METH_O,             ""},
+        {"isSymbolicSimplificationBatchPerBlockEnabled", (PyCFunction)triton_isSymbolicSimplificationBatchPerBlockEnabled, METH_NOARGS, ""},
         {"isSymbolicZ3SimplificationEnabled",   (PyCFunction)triton_isSymbolicZ3SimplificationEnabled,      METH_NOARGS,        ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
@@ -2914,15 +3974,23 @@ namespace triton {
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
+        {"removeSummary",                       (PyCFunction)triton_removeSummary,                          METH_O,             ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"resetSemanticsHandler",               (PyCFunction)triton_resetSemanticsHandler,                  METH_O,             ""},
+        {"resetSolverStatistics",               (PyCFunction)triton_resetSolverStatistics,                  METH_NOARGS,        ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)triton_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)triton_setConcreteRegisterValue,               METH_O,             ""},
+        {"setSemanticsHandler",                 (PyCFunction)triton_setSemanticsHandler,                    METH_VARARGS,       ""},
+        {"setSolverBackend",                    (PyCFunction)triton_setSolverBackend,                       METH_O,             ""},
+        {"setSolverMemoryLimit",                (PyCFunction)triton_setSolverMemoryLimit,                   METH_O,             ""},
+        {"setSolverTimeout",                    (PyCFunction)triton_setSolverTimeout,                       METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
+        {"sliceExpressions",                    (PyCFunction)triton_sliceExpressions,                       METH_O,             ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)triton_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)triton_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
         {"taintAssignmentMemoryRegister",       (PyCFunction)triton_taintAssignmentMemoryRegister,          METH_VARARGS,       ""},
@@ -2937,6 +4005,7 @@ namespace triton {
         {"taintUnionRegisterImmediate",         (PyCFunction)triton_taintUnionRegisterImmediate,            METH_O,             ""},
         {"taintUnionRegisterMemory",            (PyCFunction)triton_taintUnionRegisterMemory,               METH_VARARGS,       ""},
         {"taintUnionRegisterRegister",          (PyCFunction)triton_taintUnionRegisterRegister,             METH_VARARGS,       ""},
+        {"unfreeze",                            (PyCFunction)triton_unfreeze,                               METH_NOARGS,        ""},
         {"unmapMemory",                         (PyCFunction)triton_unmapMemory,                            METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
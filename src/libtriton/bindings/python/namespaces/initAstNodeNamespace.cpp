@@ -26,6 +26,7 @@ The AST_NODE namespace contains all kinds of node.
 \section AST_NODE_py_api Python API - Items of the AST_NODE namespace
 <hr>
 
+- **AST_NODE.ARRAY**
 - **AST_NODE.ASSERT**
 - **AST_NODE.BV**
 - **AST_NODE.BVADD**
@@ -73,6 +74,8 @@ The AST_NODE namespace contains all kinds of node.
 - **AST_NODE.LOR**
 - **AST_NODE.PARAM**
 - **AST_NODE.REFERENCE**
+- **AST_NODE.SELECT**
+- **AST_NODE.STORE**
 - **AST_NODE.STRING**
 - **AST_NODE.SX**
 - **AST_NODE.UNDEFINED**
@@ -88,6 +91,7 @@ namespace triton {
     namespace python {
 
       void initAstNodeNamespace(PyObject* astNodeDict) {
+        PyDict_SetItemString(astNodeDict, "ARRAY",             PyLong_FromUint32(triton::ast::ARRAY_NODE));
         PyDict_SetItemString(astNodeDict, "ASSERT",            PyLong_FromUint32(triton::ast::ASSERT_NODE));
         PyDict_SetItemString(astNodeDict, "BV",                PyLong_FromUint32(triton::ast::BV_NODE));
         PyDict_SetItemString(astNodeDict, "BVADD",             PyLong_FromUint32(triton::ast::BVADD_NODE));
@@ -135,6 +139,8 @@ namespace triton {
         PyDict_SetItemString(astNodeDict, "LOR",               PyLong_FromUint32(triton::ast::LOR_NODE));
         PyDict_SetItemString(astNodeDict, "PARAM",             PyLong_FromUint32(triton::ast::PARAM_NODE));
         PyDict_SetItemString(astNodeDict, "REFERENCE",         PyLong_FromUint32(triton::ast::REFERENCE_NODE));
+        PyDict_SetItemString(astNodeDict, "SELECT",            PyLong_FromUint32(triton::ast::SELECT_NODE));
+        PyDict_SetItemString(astNodeDict, "STORE",             PyLong_FromUint32(triton::ast::STORE_NODE));
         PyDict_SetItemString(astNodeDict, "STRING",            PyLong_FromUint32(triton::ast::STRING_NODE));
         PyDict_SetItemString(astNodeDict, "SX",                PyLong_FromUint32(triton::ast::SX_NODE));
         PyDict_SetItemString(astNodeDict, "UNDEFINED",         PyLong_FromUint32(triton::ast::UNDEFINED_NODE));
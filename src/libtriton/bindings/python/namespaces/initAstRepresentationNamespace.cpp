@@ -38,6 +38,11 @@ Enabled, all prints of AST expressions will be represented into the SMT2-Lib syn
 - **AST_REPRESENTATION.PYTHON**<br>
 Enabled, all prints of AST expressions will be represented into the Python syntax.
 
+- **AST_REPRESENTATION.SMT_DAG**<br>
+Enabled, all prints of AST expressions will be represented into the SMT2-Lib syntax and the subterms referenced
+more than once are printed only once, bound via `let` (terms) or `define-fun` (commands). This mode is used to
+send formulas to the solver.
+
 
 */
 
@@ -50,6 +55,7 @@ namespace triton {
       void initAstRepresentationNamespace(PyObject* astRepresentationDict) {
         PyDict_SetItemString(astRepresentationDict, "SMT",    PyLong_FromUint32(triton::ast::representations::SMT_REPRESENTATION));
         PyDict_SetItemString(astRepresentationDict, "PYTHON", PyLong_FromUint32(triton::ast::representations::PYTHON_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "SMT_DAG", PyLong_FromUint32(triton::ast::representations::SMT_DAG_REPRESENTATION));
       }
 
     }; /* python namespace */
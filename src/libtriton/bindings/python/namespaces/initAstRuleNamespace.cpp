@@ -0,0 +1,86 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <astRules.hpp>
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+
+
+
+/*! \page py_AST_RULE_page AST_RULE
+    \brief [**python api**] All information about the AST_RULE python namespace.
+
+\tableofcontents
+
+\section AST_RULE_py_description Description
+<hr>
+
+The AST_RULE namespace contains all rewriting rules which can be applied when an AST node is built.
+A matching rule returns an existing or smaller node instead of allocating a new one. Only `AST_RULE.CONSTANT_FOLDING`
+is enabled by default, because it never removes a variable from an expression. The other rules may drop a variable
+(`x & 0`) or return another kind of node (a full extraction returns its operand), which changes the slicing, the model
+projections and the scripts which match node kinds, so they must be enabled with `enableAstRule()`.
+
+\subsection AST_RULE_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> enableAstRule(AST_RULE.XOR_SELF, True)
+>>> print ast.bvadd(ast.bv(1, 8), ast.bv(2, 8))
+(_ bv3 8)
+>>> print getAstRulesStats()
+{'EXTRACT_EXTRACT': 0L, 'IDENTITY': 0L, 'CONSTANT_FOLDING': 1L, 'XOR_SELF': 0L, 'ABSORPTION': 0L, 'EXTRACT_CONCAT': 0L, 'EXTENSION_CHAIN': 0L}
+~~~~~~~~~~~~~
+
+\section AST_RULE_py_api Python API - Items of the AST_RULE namespace
+<hr>
+
+- **AST_RULE.CONSTANT_FOLDING**<br>
+Enabled (default), arithmetic, bitwise, shift, concat, extract and extend nodes which only take constants are replaced by a constant.
+
+- **AST_RULE.IDENTITY**<br>
+Enabled, `x + 0`, `x - 0`, `x | 0`, `x ^ 0`, `x & ~0`, `x * 1`, `x << 0`, `x >> 0`, `x & x`, `x | x`, full extractions and extensions of zero bits return `x`.
+
+- **AST_RULE.ABSORPTION**<br>
+Enabled, `x & 0` and `x * 0` return `0`, `x | ~0` returns `~0`.
+
+- **AST_RULE.EXTRACT_CONCAT**<br>
+Enabled, an extraction of a concatenation only keeps the operands which hold the extracted bits.
+
+- **AST_RULE.EXTRACT_EXTRACT**<br>
+Enabled, an extraction of an extraction is merged into a single extraction.
+
+- **AST_RULE.EXTENSION_CHAIN**<br>
+Enabled, chains of zero and sign extensions are merged and an extraction of the original bits of an extension skips the extension.
+
+- **AST_RULE.XOR_SELF**<br>
+Enabled, `x ^ x` returns `0`.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initAstRuleNamespace(PyObject* astRuleDict) {
+        PyDict_SetItemString(astRuleDict, "CONSTANT_FOLDING", PyLong_FromUint32(triton::ast::CONSTANT_FOLDING));
+        PyDict_SetItemString(astRuleDict, "IDENTITY",         PyLong_FromUint32(triton::ast::IDENTITY));
+        PyDict_SetItemString(astRuleDict, "ABSORPTION",       PyLong_FromUint32(triton::ast::ABSORPTION));
+        PyDict_SetItemString(astRuleDict, "EXTRACT_CONCAT",   PyLong_FromUint32(triton::ast::EXTRACT_CONCAT));
+        PyDict_SetItemString(astRuleDict, "EXTRACT_EXTRACT",  PyLong_FromUint32(triton::ast::EXTRACT_EXTRACT));
+        PyDict_SetItemString(astRuleDict, "EXTENSION_CHAIN",  PyLong_FromUint32(triton::ast::EXTENSION_CHAIN));
+        PyDict_SetItemString(astRuleDict, "XOR_SELF",         PyLong_FromUint32(triton::ast::XOR_SELF));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
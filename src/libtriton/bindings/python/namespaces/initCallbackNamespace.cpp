@@ -34,17 +34,23 @@ The CALLBACK namespace contains all kinds of callbacks.
 
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as unique argument a \ref py_MemoryAccess_page. Callbacks will be called each time that the
-Triton library will need a concrete memory value. The callback must return nothing.
+Triton library will need a concrete memory value. The callback must return nothing. A memory area is requested
+with the largest accesses possible (up to 64 bytes). See also enableConcreteCallbacksCache().
 
 - **CALLBACK.GET_CONCRETE_REGISTER_VALUE**<br>
 The callback takes as unique argument a \ref py_Register_page. Callbacks will be called each time that the
-Triton library will need a concrete register value. The callback must return nothing.
+Triton library will need a concrete register value. The callback must return nothing. See also enableConcreteCallbacksCache().
 
 - **CALLBACK.SYMBOLIC_SIMPLIFICATION**<br>
 Defines a callback which be called before all symbolic assignments. The callback takes as uniq argument
 an \ref py_AstNode_page and must return a valid \ref py_AstNode_page. The returned node is used as assignment.
 See also the page about \ref SMT_simplification_page.
 
+- **CALLBACK.SYMBOLIC_SIMPLIFICATION_BATCH**<br>
+Defines a callback which be called once per instruction (or once per basic block) with the list of \ref py_AstNode_page
+of all symbolic expressions created since the last call. The callback must return a list of the same length, the
+returned nodes are used as assignments. See also the page about \ref SMT_simplification_page.
+
 */
 
 
@@ -54,9 +60,10 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
-        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
-        PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
-        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",     PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
+        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",       PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION_BATCH", PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION_BATCH));
       }
 
     }; /* python namespace */
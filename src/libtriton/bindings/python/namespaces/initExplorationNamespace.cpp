@@ -0,0 +1,63 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <explorationEngine.hpp>
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+
+
+
+/*! \page py_EXPLORATION_page EXPLORATION
+    \brief [**python api**] All information about the EXPLORATION python namespace.
+
+\tableofcontents
+
+\section EXPLORATION_py_description Description
+<hr>
+
+The EXPLORATION namespace contains all search strategies of the \ref py_ExplorationEngine_page.
+
+\subsection EXPLORATION_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> engine = ExplorationEngine(Elf('./crackme'))
+>>> engine.setStrategy(EXPLORATION.STRATEGY_DFS)
+~~~~~~~~~~~~~
+
+\section EXPLORATION_py_api Python API - Items of the EXPLORATION namespace
+<hr>
+
+- **EXPLORATION.STRATEGY_COVERAGE**<br>
+Runs first the inputs which flip a branch toward an uncovered address.
+
+- **EXPLORATION.STRATEGY_DFS**<br>
+Runs first the last generated input.
+
+- **EXPLORATION.STRATEGY_GENERATIONAL**<br>
+Runs the inputs generation by generation, each child only flips the branches after its parent's one.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initExplorationNamespace(PyObject* explorationDict) {
+        PyDict_SetItemString(explorationDict, "STRATEGY_COVERAGE",     PyLong_FromUint32(triton::engines::exploration::STRATEGY_COVERAGE));
+        PyDict_SetItemString(explorationDict, "STRATEGY_DFS",          PyLong_FromUint32(triton::engines::exploration::STRATEGY_DFS));
+        PyDict_SetItemString(explorationDict, "STRATEGY_GENERATIONAL", PyLong_FromUint32(triton::engines::exploration::STRATEGY_GENERATIONAL));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
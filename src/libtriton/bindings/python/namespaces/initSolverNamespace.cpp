@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+#include <solverEnums.hpp>
+
+
+
+/*! \page py_SOLVER_page SOLVER
+    \brief [**python api**] All information about the SOLVER python namespace.
+
+\tableofcontents
+
+\section SOLVER_py_description Description
+<hr>
+
+The SOLVER namespace contains all results of a solver query, the solver backends and their capabilities.
+
+\subsection SOLVER_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> model, status = getModel(constraint, 500, True)
+>>> if status == SOLVER.TIMEOUT:
+...     print 'No answer within 500ms'
+~~~~~~~~~~~~~
+
+\section SOLVER_py_api Python API - Items of the SOLVER namespace
+<hr>
+
+- **SOLVER.BACKEND_BITBLAST**<br>
+The built-in bit-blaster on top of a CDCL SAT solver, only for bit-vectors.
+
+- **SOLVER.BACKEND_DEFAULT**<br>
+The default backend, set by setSolverBackend().
+
+- **SOLVER.BACKEND_Z3**<br>
+The Z3 SMT solver.
+
+- **SOLVER.CANCELED**<br>
+The query has been interrupted by interruptSolver().
+
+- **SOLVER.CAPABILITY_ARRAYS**<br>
+The backend handles the memory array.
+
+- **SOLVER.CAPABILITY_INCREMENTAL**<br>
+The models are enumerated without restarting the query.
+
+- **SOLVER.CAPABILITY_INTERRUPT**<br>
+The running queries may be interrupted.
+
+- **SOLVER.CAPABILITY_MEMORY_LIMIT**<br>
+The memory of the backend may be bounded.
+
+- **SOLVER.CAPABILITY_MODELS**<br>
+The backend returns models.
+
+- **SOLVER.CAPABILITY_TIMEOUT**<br>
+The queries may be bounded by a timeout.
+
+- **SOLVER.CAPABILITY_UNSAT_CORES**<br>
+The backend returns unsat cores.
+
+- **SOLVER.SAT**<br>
+The constraint is satisfiable.
+
+- **SOLVER.TIMEOUT**<br>
+The timeout of the query expired.
+
+- **SOLVER.UNKNOWN**<br>
+The solver gave up (e.g: memory limit).
+
+- **SOLVER.UNSAT**<br>
+The constraint is unsatisfiable.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initSolverNamespace(PyObject* solverDict) {
+        PyDict_SetItemString(solverDict, "BACKEND_BITBLAST",        PyLong_FromUint32(triton::engines::solver::BACKEND_BITBLAST));
+        PyDict_SetItemString(solverDict, "BACKEND_DEFAULT",         PyLong_FromUint32(triton::engines::solver::BACKEND_DEFAULT));
+        PyDict_SetItemString(solverDict, "BACKEND_Z3",              PyLong_FromUint32(triton::engines::solver::BACKEND_Z3));
+        PyDict_SetItemString(solverDict, "CANCELED",                PyLong_FromUint32(triton::engines::solver::CANCELED));
+        PyDict_SetItemString(solverDict, "CAPABILITY_ARRAYS",       PyLong_FromUint32(triton::engines::solver::CAPABILITY_ARRAYS));
+        PyDict_SetItemString(solverDict, "CAPABILITY_INCREMENTAL",  PyLong_FromUint32(triton::engines::solver::CAPABILITY_INCREMENTAL));
+        PyDict_SetItemString(solverDict, "CAPABILITY_INTERRUPT",    PyLong_FromUint32(triton::engines::solver::CAPABILITY_INTERRUPT));
+        PyDict_SetItemString(solverDict, "CAPABILITY_MEMORY_LIMIT", PyLong_FromUint32(triton::engines::solver::CAPABILITY_MEMORY_LIMIT));
+        PyDict_SetItemString(solverDict, "CAPABILITY_MODELS",       PyLong_FromUint32(triton::engines::solver::CAPABILITY_MODELS));
+        PyDict_SetItemString(solverDict, "CAPABILITY_TIMEOUT",      PyLong_FromUint32(triton::engines::solver::CAPABILITY_TIMEOUT));
+        PyDict_SetItemString(solverDict, "CAPABILITY_UNSAT_CORES",  PyLong_FromUint32(triton::engines::solver::CAPABILITY_UNSAT_CORES));
+        PyDict_SetItemString(solverDict, "SAT",                     PyLong_FromUint32(triton::engines::solver::SAT));
+        PyDict_SetItemString(solverDict, "TIMEOUT",                 PyLong_FromUint32(triton::engines::solver::TIMEOUT));
+        PyDict_SetItemString(solverDict, "UNKNOWN",                 PyLong_FromUint32(triton::engines::solver::UNKNOWN));
+        PyDict_SetItemString(solverDict, "UNSAT",                   PyLong_FromUint32(triton::engines::solver::UNSAT));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -38,6 +38,24 @@ Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory
 - **OPTIMIZATION.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **OPTIMIZATION.BULK_STRING_OPERATIONS**<br>
+Enabled, Triton will process a `REP` prefixed `MOVS`, `STOS` or `LODS` in a single step when the counter and the direction
+flag are not symbolized. The ranges are copied or filled at once, memory cells copied from concrete cells are concretized
+instead of getting a new expression and the memory accesses are recorded by chunks of at most 64 bytes. The per-iteration
+semantics are kept when the counter or the direction flag are symbolized, when an accessed range is above 16 MB or when it
+wraps around the address space. With an address-size prefix (`0x67`), the counter is
+`ECX` or `CX`.
+
+- **OPTIMIZATION.DEAD_EXPRESSIONS**<br>
+Enabled, Triton will remove symbolic expressions which are overwritten before being referenced. The liveness is tracked
+over a sliding window of 16 instructions and expressions of the current instruction are always kept. An expression
+removed stays valid as long as an instruction holds it.
+
+- **OPTIMIZATION.MEMORY_ARRAY**<br>
+Enabled, Triton will model the `LOAD` and `STORE` accesses whose address is symbolized with `select` and `store` over an
+SMT array named `memory`. The address may take any value in a window of 16 bytes around its concrete value, out of this
+window it is concretized. The solver then works in the `QF_ABV` logic.
+
 - **OPTIMIZATION.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -58,6 +76,9 @@ namespace triton {
       void initSymOptiNamespace(PyObject* symOptiDict) {
         PyDict_SetItemString(symOptiDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::engines::symbolic::ALIGNED_MEMORY));
         PyDict_SetItemString(symOptiDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::engines::symbolic::AST_DICTIONARIES));
+        PyDict_SetItemString(symOptiDict, "BULK_STRING_OPERATIONS", PyLong_FromUint32(triton::engines::symbolic::BULK_STRING_OPERATIONS));
+        PyDict_SetItemString(symOptiDict, "DEAD_EXPRESSIONS",       PyLong_FromUint32(triton::engines::symbolic::DEAD_EXPRESSIONS));
+        PyDict_SetItemString(symOptiDict, "MEMORY_ARRAY",           PyLong_FromUint32(triton::engines::symbolic::MEMORY_ARRAY));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_TAINTED));
         PyDict_SetItemString(symOptiDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::engines::symbolic::PC_TRACKING_SYMBOLIC));
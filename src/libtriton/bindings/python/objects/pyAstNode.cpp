@@ -70,6 +70,10 @@ Returns the parents list nodes as \ref py_AstNode_page. The list is empty if the
 - **getValue(void)**<br>
 Returns the node value as integer or string (it depends of the kind). For example if the kind of node is `decimal`, the value is an integer.
 
+- **getVariables(void)**<br>
+Returns the sorted list of the symbolic variable ids of the tree as integer. The list is propagated from the childs
+when the node is built, so it does not walk the tree.
+
 - **isSigned(void)**<br>
 According to the size of the expression, returns true if the MSB is 1.
 
@@ -202,6 +206,21 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getVariables(PyObject* self, PyObject* noarg) {
+        try {
+          PyObject* ret = nullptr;
+          const std::vector<triton::usize>& variables = PyAstNode_AsAstNode(self)->getVariables();
+          ret = xPyList_New(variables.size());
+          for (triton::usize index = 0; index < variables.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(variables[index]));
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_isSigned(PyObject* self, PyObject* noarg) {
         try {
           if (PyAstNode_AsAstNode(self)->isSigned())
@@ -458,6 +477,7 @@ namespace triton {
         {"getKind",           AstNode_getKind,           METH_NOARGS,     ""},
         {"getParents",        AstNode_getParents,        METH_NOARGS,     ""},
         {"getValue",          AstNode_getValue,          METH_NOARGS,     ""},
+        {"getVariables",      AstNode_getVariables,      METH_NOARGS,     ""},
         {"isSigned",          AstNode_isSigned,          METH_NOARGS,     ""},
         {"isSymbolized",      AstNode_isSymbolized,      METH_NOARGS,     ""},
         {"setChild",          AstNode_setChild,          METH_VARARGS,    ""},
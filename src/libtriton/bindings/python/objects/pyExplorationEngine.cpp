@@ -0,0 +1,434 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <exceptions.hpp>
+#include <explorationEngine.hpp>
+#include <pythonObjects.hpp>
+#include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
+
+
+
+/*! \page py_ExplorationEngine_page ExplorationEngine
+    \brief [**python api**] All information about the ExplorationEngine python object.
+
+\tableofcontents
+
+\section py_ExplorationEngine_description Description
+<hr>
+
+This object is used to explore the paths of an ELF binary. The engine emulates the binary from its entry point
+(`main` by default) with symbolic inputs, negates the branches of the path constraints and runs the new inputs
+until the worklist is empty or the maximum number of runs is reached. An input is a dictionary of the symbolic
+bytes `{address: value}`.
+
+The runs are processed on the API of the calling thread, so `explore()` overwrites its state (architecture,
+memory, symbolic expressions). Several workers need a libtriton built with `-DTHREAD_LOCAL_API=on`.
+
+\subsection py_ExplorationEngine_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> engine = ExplorationEngine(Elf('./src/samples/crackmes/crackme_xor'))
+>>> engine.addArgumentSeed(5)
+>>> engine.explore()
+
+>>> inputs = [''.join(chr(i[k]) for k in sorted(i)) for i in engine.getInputs()]
+>>> 'elite' in inputs
+True
+~~~~~~~~~~~~~
+
+\subsection py_ExplorationEngine_constructor Constructor
+
+~~~~~~~~~~~~~{.py}
+>>> engine = ExplorationEngine(Elf('./crackme'))
+~~~~~~~~~~~~~
+
+\section ExplorationEngine_py_api Python API - Methods of the ExplorationEngine class
+<hr>
+
+- **addArgumentSeed(integer size, integer value=0x41)**<br>
+Queues an `argv[1]` of `size` bytes filled with `value`. The entry point receives `argc` and `argv`.
+
+- **addSeed(dict input)**<br>
+Queues an input. All bytes of the input are symbolized.
+
+- **explore(void)**<br>
+Explores the binary until the worklist is empty or the maximum number of runs is reached. Without seed, an
+`argv[1]` of 8 bytes is explored.
+
+- **getCoverage(void)**<br>
+Returns the addresses of the executed instructions as list of integer.
+
+- **getCrashes(void)**<br>
+Returns the inputs which jumped to an address neither mapped nor summarized as list of dict.
+
+- **getInputs(void)**<br>
+Returns all inputs which have been run as list of dict.
+
+- **getStats(void)**<br>
+Returns the statistics of the exploration as dict of `{string: integer}` (e.g: `iterations`, `paths`, `inputs`,
+`crashes`, `errors`, `solver_queries`).
+
+- **setEntryPoint(integer addr / string symbol)**<br>
+Sets the entry point of the runs. Returns False if the symbol is not defined.
+
+- **setMaxInstructions(integer limit)**<br>
+Sets the maximum number of instructions of a run.
+
+- **setMaxIterations(integer limit)**<br>
+Sets the maximum number of runs.
+
+- **setStrategy(\ref py_EXPLORATION_page strategy)**<br>
+Sets the search strategy.
+
+- **setWorkers(integer workers)**<br>
+Sets the number of workers. The runs are processed in parallel only when libtriton is built with `-DTHREAD_LOCAL_API=on`
+(which defines `TRITON_THREAD_LOCAL_API`), each worker then owns its own API. Otherwise, the number of workers is kept but
+all the runs are processed one by one on the calling thread.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! Returns a dict from an input.
+      static PyObject* PyDict_FromInput(const triton::engines::exploration::input_t& input) {
+        PyObject* ret = xPyDict_New();
+
+        for (triton::engines::exploration::input_t::const_iterator it = input.begin(); it != input.end(); it++)
+          PyDict_SetItem(ret, PyLong_FromUint64(it->first), PyLong_FromUint32(it->second));
+
+        return ret;
+      }
+
+
+      //! Returns a list of dict from a list of inputs.
+      static PyObject* PyList_FromInputs(const std::vector<triton::engines::exploration::input_t>& inputs) {
+        PyObject* ret = xPyList_New(inputs.size());
+
+        for (triton::usize index = 0; index < inputs.size(); index++)
+          PyList_SetItem(ret, index, PyDict_FromInput(inputs[index]));
+
+        return ret;
+      }
+
+
+      //! ExplorationEngine destructor.
+      void ExplorationEngine_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PyExplorationEngine_AsExplorationEngine(self);
+        Py_XDECREF(((ExplorationEngine_Object*)self)->binary);
+        Py_DECREF(self);
+      }
+
+
+      static PyObject* ExplorationEngine_addArgumentSeed(PyObject* self, PyObject* args) {
+        PyObject* size  = nullptr;
+        PyObject* value = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &size, &value);
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addArgumentSeed(): Expects an integer as first argument.");
+
+        if (value != nullptr && !PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addArgumentSeed(): Expects an integer as second argument.");
+
+        try {
+          triton::uint32 c_value = (value == nullptr ? 'A' : PyLong_AsUint32(value));
+          if (c_value > 0xff)
+            return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addArgumentSeed(): The value must be a byte.");
+          PyExplorationEngine_AsExplorationEngine(self)->addArgumentSeed(PyLong_AsUsize(size), static_cast<triton::uint8>(c_value));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_addSeed(PyObject* self, PyObject* input) {
+        triton::engines::exploration::input_t c_input;
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        if (input == nullptr || !PyDict_Check(input))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addSeed(): Expects a dict as argument.");
+
+        try {
+          while (PyDict_Next(input, &pos, &key, &value)) {
+            if ((!PyLong_Check(key) && !PyInt_Check(key)) || (!PyLong_Check(value) && !PyInt_Check(value)))
+              return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addSeed(): Expects a dict of {integer: integer}.");
+
+            triton::uint32 c_value = PyLong_AsUint32(value);
+            if (c_value > 0xff)
+              return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addSeed(): The values must be bytes.");
+
+            c_input[PyLong_AsUint64(key)] = static_cast<triton::uint8>(c_value);
+          }
+
+          PyExplorationEngine_AsExplorationEngine(self)->addSeed(c_input);
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_explore(PyObject* self, PyObject* noarg) {
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->explore();
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_getCoverage(PyObject* self, PyObject* noarg) {
+        try {
+          const std::set<triton::uint64>& coverage = PyExplorationEngine_AsExplorationEngine(self)->getCoverage();
+          PyObject* ret = xPyList_New(coverage.size());
+          triton::usize index = 0;
+
+          for (std::set<triton::uint64>::const_iterator it = coverage.begin(); it != coverage.end(); it++)
+            PyList_SetItem(ret, index++, PyLong_FromUint64(*it));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_getCrashes(PyObject* self, PyObject* noarg) {
+        try {
+          return PyList_FromInputs(PyExplorationEngine_AsExplorationEngine(self)->getCrashes());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_getInputs(PyObject* self, PyObject* noarg) {
+        try {
+          return PyList_FromInputs(PyExplorationEngine_AsExplorationEngine(self)->getInputs());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_getStats(PyObject* self, PyObject* noarg) {
+        try {
+          std::map<std::string, triton::usize> stats = PyExplorationEngine_AsExplorationEngine(self)->getStats();
+          PyObject* ret = xPyDict_New();
+
+          for (std::map<std::string, triton::usize>::const_iterator it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setEntryPoint(PyObject* self, PyObject* entry) {
+        try {
+          if (entry != nullptr && PyString_Check(entry)) {
+            if (PyExplorationEngine_AsExplorationEngine(self)->setEntryPoint(std::string(PyString_AsString(entry))))
+              Py_RETURN_TRUE;
+            Py_RETURN_FALSE;
+          }
+
+          if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+            return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setEntryPoint(): Expects an integer or a string as argument.");
+
+          PyExplorationEngine_AsExplorationEngine(self)->setEntryPoint(PyLong_AsUint64(entry));
+          Py_RETURN_TRUE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setMaxInstructions(PyObject* self, PyObject* limit) {
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setMaxInstructions(): Expects an integer as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->setMaxInstructions(PyLong_AsUsize(limit));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setMaxIterations(PyObject* self, PyObject* limit) {
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setMaxIterations(): Expects an integer as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->setMaxIterations(PyLong_AsUsize(limit));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setStrategy(PyObject* self, PyObject* strategy) {
+        if (strategy == nullptr || (!PyLong_Check(strategy) && !PyInt_Check(strategy)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setStrategy(): Expects an EXPLORATION as argument.");
+
+        try {
+          triton::uint32 c_strategy = PyLong_AsUint32(strategy);
+          switch (c_strategy) {
+            case triton::engines::exploration::STRATEGY_COVERAGE:
+            case triton::engines::exploration::STRATEGY_DFS:
+            case triton::engines::exploration::STRATEGY_GENERATIONAL:
+              PyExplorationEngine_AsExplorationEngine(self)->setStrategy(static_cast<triton::engines::exploration::strategy_e>(c_strategy));
+              break;
+            default:
+              return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setStrategy(): Invalid strategy.");
+          }
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setWorkers(PyObject* self, PyObject* workers) {
+        if (workers == nullptr || (!PyLong_Check(workers) && !PyInt_Check(workers)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setWorkers(): Expects an integer as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->setWorkers(PyLong_AsUsize(workers));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! ExplorationEngine methods.
+      PyMethodDef ExplorationEngine_callbacks[] = {
+        {"addArgumentSeed",     ExplorationEngine_addArgumentSeed,    METH_VARARGS,    ""},
+        {"addSeed",             ExplorationEngine_addSeed,            METH_O,          ""},
+        {"explore",             ExplorationEngine_explore,            METH_NOARGS,     ""},
+        {"getCoverage",         ExplorationEngine_getCoverage,        METH_NOARGS,     ""},
+        {"getCrashes",          ExplorationEngine_getCrashes,         METH_NOARGS,     ""},
+        {"getInputs",           ExplorationEngine_getInputs,          METH_NOARGS,     ""},
+        {"getStats",            ExplorationEngine_getStats,           METH_NOARGS,     ""},
+        {"setEntryPoint",       ExplorationEngine_setEntryPoint,      METH_O,          ""},
+        {"setMaxInstructions",  ExplorationEngine_setMaxInstructions, METH_O,          ""},
+        {"setMaxIterations",    ExplorationEngine_setMaxIterations,   METH_O,          ""},
+        {"setStrategy",         ExplorationEngine_setStrategy,        METH_O,          ""},
+        {"setWorkers",          ExplorationEngine_setWorkers,         METH_O,          ""},
+        {nullptr,               nullptr,                              0,               nullptr}
+      };
+
+
+      PyTypeObject ExplorationEngine_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "ExplorationEngine",                        /* tp_name */
+        sizeof(ExplorationEngine_Object),           /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)ExplorationEngine_dealloc,      /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "ExplorationEngine objects",                /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        ExplorationEngine_callbacks,                /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyExplorationEngine(PyObject* binary) {
+        ExplorationEngine_Object* object;
+
+        PyType_Ready(&ExplorationEngine_Type);
+        object = PyObject_NEW(ExplorationEngine_Object, &ExplorationEngine_Type);
+        if (object != NULL) {
+          object->engine = new triton::engines::exploration::ExplorationEngine(*PyElf_AsElf(binary));
+          object->binary = binary;
+          Py_INCREF(binary);
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
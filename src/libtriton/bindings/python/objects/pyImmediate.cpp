@@ -146,6 +146,9 @@ namespace triton {
 
 
       static PyObject* Immediate_setValue(PyObject* self, PyObject* value) {
+        if (PyImmediate_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "Immediate::setValue(): The immediate belongs to an instruction and is read-only.");
+
         try {
           if (!PyLong_Check(value) && !PyInt_Check(value))
             return PyErr_Format(PyExc_TypeError, "setValue(): expected an integer as argument");
@@ -241,13 +244,15 @@ namespace triton {
       };
 
 
-      PyObject* PyImmediate(const triton::arch::Immediate& imm) {
+      PyObject* PyImmediate(const triton::arch::Immediate& imm, bool readOnly) {
         Immediate_Object* object;
 
         PyType_Ready(&Immediate_Type);
         object = PyObject_NEW(Immediate_Object, &Immediate_Type);
-        if (object != NULL)
-          object->imm = new triton::arch::Immediate(imm);
+        if (object != NULL) {
+          object->imm      = new triton::arch::Immediate(imm);
+          object->readOnly = readOnly;
+        }
 
         return (PyObject*)object;
       }
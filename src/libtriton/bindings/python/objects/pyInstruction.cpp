@@ -78,6 +78,12 @@ if __name__ == '__main__':
     sys.exit(0)
 ~~~~~~~~~~~~~
 
+The tuples returned by the operand and access getters are built once and cached in the instruction. Calling the same getter
+again returns the same objects until the instruction is modified (`setAddress()`, `setOpcodes()`, `setThreadId()`,
+`updateContext()`) or processed again (`processing()`, `buildSemantics()`, `disassembly()`). As they are shared, the
+\ref py_Immediate_page, \ref py_MemoryAccess_page and \ref py_Register_page objects of these tuples are read-only: their
+setters raise an exception.
+
 \section Instruction_py_api Python API - Methods of the Instruction class
 <hr>
 
@@ -91,7 +97,7 @@ Returns the disassembly of the instruction as string.
 Returns the first operand of the instruction.
 
 - **getLoadAccess(void)**<br>
-Returns the list of all implicit and explicit LOAD access as list of tuple <\ref py_MemoryAccess_page, \ref py_AstNode_page>.
+Returns all implicit and explicit LOAD access as tuple of tuple <\ref py_MemoryAccess_page, \ref py_AstNode_page>.
 
 - **getNextAddress(void)**<br>
 Returns the next address of the instruction as integer.
@@ -100,7 +106,7 @@ Returns the next address of the instruction as integer.
 Returns the opcodes of the instruction as bytes.
 
 - **getOperands(void)**<br>
-Returns the operands of the instruction as list of \ref py_Immediate_page, \ref py_MemoryAccess_page or \ref py_Register_page.
+Returns the operands of the instruction as tuple of \ref py_Immediate_page, \ref py_MemoryAccess_page or \ref py_Register_page.
 
 - **getPrefix(void)**<br>
 Returns the instruction prefix as \ref py_PREFIX_page.
@@ -109,7 +115,7 @@ Returns the instruction prefix as \ref py_PREFIX_page.
 Returns a list of tuple <\ref py_Immediate_page, \ref py_AstNode_page> which represents all implicit and explicit immediate inputs.
 
 - **getReadRegisters(void)**<br>
-Returns a list of tuple <\ref py_Register_page, \ref py_AstNode_page> which represents all implicit and explicit register (flags includes) inputs.
+Returns a tuple of tuple <\ref py_Register_page, \ref py_AstNode_page> which represents all implicit and explicit register (flags includes) inputs.
 
 - **getSecondOperand(void)**<br>
 Returns the second operand of the instruction.
@@ -118,13 +124,13 @@ Returns the second operand of the instruction.
 Returns the size of the instruction as integer.
 
 - **getStoreAccess(void)**<br>
-Returns the list of all implicit and explicit STORE access as list of tuple <\ref py_MemoryAccess_page, \ref py_AstNode_page>.
+Returns all implicit and explicit STORE access as tuple of tuple <\ref py_MemoryAccess_page, \ref py_AstNode_page>.
 
 - **getThirdOperand(void)**<br>
 Returns the third operand of the instruction.
 
 - **getSymbolicExpressions(void)**<br>
-Returns the symbolic expression of the instruction as list of \ref py_SymbolicExpression_page.
+Returns the symbolic expression of the instruction as tuple of \ref py_SymbolicExpression_page.
 
 - **getThreadId(void)**<br>
 Returns the thread id of the instruction as integer.
@@ -133,7 +139,7 @@ Returns the thread id of the instruction as integer.
 Returns the type of the instruction as \ref py_OPCODE_page.
 
 - **getWrittenRegisters(void)**<br>
-Returns a list of tuple <\ref py_Register_page, \ref py_AstNode_page> which represents all implicit and explicit register (flags includes) outputs.
+Returns a tuple of tuple <\ref py_Register_page, \ref py_AstNode_page> which represents all implicit and explicit register (flags includes) outputs.
 
 - **isBranch(void)**<br>
 Returns true if the instruction modifies is a branch (i.e x86: JUMP, JCC).
@@ -186,6 +192,7 @@ namespace triton {
       //! Instruction destructor.
       void Instruction_dealloc(PyObject* self) {
         std::cout << std::flush;
+        PyInstruction_Invalidate(self);
         delete PyInstruction_AsInstruction(self);
         Py_DECREF(self);
       }
@@ -248,20 +255,27 @@ namespace triton {
 
       static PyObject* Instruction_getLoadAccess(PyObject* self, PyObject* noarg) {
         try {
-          PyObject* ret;
-          triton::uint32 index = 0;
-          std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>::const_iterator it;
-          const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& loadAccess = PyInstruction_AsInstruction(self)->getLoadAccess();
+          Instruction_Object* object = reinterpret_cast<Instruction_Object*>(self);
+
+          if (object->loadAccess == nullptr) {
+            PyObject* ret;
+            triton::uint32 index = 0;
+            std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>::const_iterator it;
+            const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& loadAccess = object->inst->getLoadAccess();
+
+            ret = xPyTuple_New(loadAccess.size());
+            for (it = loadAccess.begin(); it != loadAccess.end(); it++) {
+              PyObject* item = xPyTuple_New(2);
+              PyTuple_SetItem(item, 0, PyMemoryAccess(std::get<0>(*it), true));
+              PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
+              PyTuple_SetItem(ret, index++, item);
+            }
 
-          ret = xPyList_New(loadAccess.size());
-          for (it = loadAccess.begin(); it != loadAccess.end(); it++) {
-            PyObject* item = xPyTuple_New(2);
-            PyTuple_SetItem(item, 0, PyMemoryAccess(std::get<0>(*it)));
-            PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
-            PyList_SetItem(ret, index++, item);
+            object->loadAccess = ret;
           }
 
-          return ret;
+          Py_INCREF(object->loadAccess);
+          return object->loadAccess;
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -303,20 +317,27 @@ namespace triton {
 
       static PyObject* Instruction_getStoreAccess(PyObject* self, PyObject* noarg) {
         try {
-          PyObject* ret;
-          triton::uint32 index = 0;
-          std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>::const_iterator it;
-          const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& storeAccess = PyInstruction_AsInstruction(self)->getStoreAccess();
+          Instruction_Object* object = reinterpret_cast<Instruction_Object*>(self);
+
+          if (object->storeAccess == nullptr) {
+            PyObject* ret;
+            triton::uint32 index = 0;
+            std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>::const_iterator it;
+            const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& storeAccess = object->inst->getStoreAccess();
+
+            ret = xPyTuple_New(storeAccess.size());
+            for (it = storeAccess.begin(); it != storeAccess.end(); it++) {
+              PyObject* item = xPyTuple_New(2);
+              PyTuple_SetItem(item, 0, PyMemoryAccess(std::get<0>(*it), true));
+              PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
+              PyTuple_SetItem(ret, index++, item);
+            }
 
-          ret = xPyList_New(storeAccess.size());
-          for (it = storeAccess.begin(); it != storeAccess.end(); it++) {
-            PyObject* item = xPyTuple_New(2);
-            PyTuple_SetItem(item, 0, PyMemoryAccess(std::get<0>(*it)));
-            PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
-            PyList_SetItem(ret, index++, item);
+            object->storeAccess = ret;
           }
 
-          return ret;
+          Py_INCREF(object->storeAccess);
+          return object->storeAccess;
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -326,39 +347,41 @@ namespace triton {
 
       static PyObject* Instruction_getOperands(PyObject* self, PyObject* noarg) {
         try {
-          triton::arch::Immediate         imm;
-          triton::arch::MemoryAccess      mem;
-          triton::arch::Register          reg;
+          Instruction_Object*             object;
           triton::arch::Instruction*      inst;
           triton::usize                   opSize;
           PyObject*                       operands;
 
-          inst     = PyInstruction_AsInstruction(self);
-          opSize   = inst->operands.size();
-          operands = xPyList_New(opSize);
-
-          for (triton::usize index = 0; index < opSize; index++) {
-            PyObject* obj = nullptr;
-
-            if (inst->operands[index].getType() == triton::arch::OP_IMM) {
-              imm = inst->operands[index].getImmediate();
-              obj = PyImmediate(imm);
-            }
-            else if (inst->operands[index].getType() == triton::arch::OP_MEM) {
-              mem = inst->operands[index].getMemory();
-              obj = PyMemoryAccess(mem);
-            }
-            else if (inst->operands[index].getType() == triton::arch::OP_REG) {
-              reg = inst->operands[index].getRegister();
-              obj = PyRegister(reg);
+          object = reinterpret_cast<Instruction_Object*>(self);
+          inst   = object->inst;
+
+          if (object->operands == nullptr) {
+            opSize   = inst->operands.size();
+            operands = xPyTuple_New(opSize);
+
+            for (triton::usize index = 0; index < opSize; index++) {
+              PyObject* obj = nullptr;
+
+              /* Wrappers are built from the operand in place, without an intermediate copy */
+              if (inst->operands[index].getType() == triton::arch::OP_IMM)
+                obj = PyImmediate(inst->operands[index].getConstImmediate(), true);
+              else if (inst->operands[index].getType() == triton::arch::OP_MEM)
+                obj = PyMemoryAccess(inst->operands[index].getConstMemory(), true);
+              else if (inst->operands[index].getType() == triton::arch::OP_REG)
+                obj = PyRegister(inst->operands[index].getConstRegister(), true);
+              else {
+                Py_INCREF(Py_None);
+                obj = Py_None;
+              }
+
+              PyTuple_SetItem(operands, index, obj);
             }
-            else
-              continue;
 
-            PyList_SetItem(operands, index, obj);
+            object->operands = operands;
           }
 
-          return operands;
+          Py_INCREF(object->operands);
+          return object->operands;
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -401,20 +424,27 @@ namespace triton {
 
       static PyObject* Instruction_getReadRegisters(PyObject* self, PyObject* noarg) {
         try {
-          PyObject* ret;
-          triton::uint32 index = 0;
-          std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>::const_iterator it;
-          const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& readRegisters = PyInstruction_AsInstruction(self)->getReadRegisters();
+          Instruction_Object* object = reinterpret_cast<Instruction_Object*>(self);
+
+          if (object->readRegisters == nullptr) {
+            PyObject* ret;
+            triton::uint32 index = 0;
+            std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>::const_iterator it;
+            const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& readRegisters = object->inst->getReadRegisters();
+
+            ret = xPyTuple_New(readRegisters.size());
+            for (it = readRegisters.begin(); it != readRegisters.end(); it++) {
+              PyObject* item = xPyTuple_New(2);
+              PyTuple_SetItem(item, 0, PyRegister(std::get<0>(*it), true));
+              PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
+              PyTuple_SetItem(ret, index++, item);
+            }
 
-          ret = xPyList_New(readRegisters.size());
-          for (it = readRegisters.begin(); it != readRegisters.end(); it++) {
-            PyObject* item = xPyTuple_New(2);
-            PyTuple_SetItem(item, 0, PyRegister(std::get<0>(*it)));
-            PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
-            PyList_SetItem(ret, index++, item);
+            object->readRegisters = ret;
           }
 
-          return ret;
+          Py_INCREF(object->readRegisters);
+          return object->readRegisters;
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -459,21 +489,29 @@ namespace triton {
 
       static PyObject* Instruction_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
         try {
+          Instruction_Object*         object;
           triton::arch::Instruction*  inst;
           triton::usize               exprSize;
           PyObject*                   symExprs;
 
-          inst     = PyInstruction_AsInstruction(self);
-          exprSize = inst->symbolicExpressions.size();
-          symExprs = xPyList_New(exprSize);
+          object = reinterpret_cast<Instruction_Object*>(self);
+          inst   = object->inst;
 
-          for (triton::usize index = 0; index < exprSize; index++) {
-            PyObject* obj = nullptr;
-            obj = PySymbolicExpression(inst->symbolicExpressions[index]);
-            PyList_SetItem(symExprs, index, obj);
+          if (object->symbolicExpressions == nullptr) {
+            exprSize = inst->symbolicExpressions.size();
+            symExprs = xPyTuple_New(exprSize);
+
+            for (triton::usize index = 0; index < exprSize; index++) {
+              PyObject* obj = nullptr;
+              obj = PySymbolicExpression(inst->symbolicExpressions[index]);
+              PyTuple_SetItem(symExprs, index, obj);
+            }
+
+            object->symbolicExpressions = symExprs;
           }
 
-          return symExprs;
+          Py_INCREF(object->symbolicExpressions);
+          return object->symbolicExpressions;
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -538,20 +576,27 @@ namespace triton {
 
       static PyObject* Instruction_getWrittenRegisters(PyObject* self, PyObject* noarg) {
         try {
-          PyObject* ret;
-          triton::uint32 index = 0;
-          std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>::const_iterator it;
-          const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& writtenRegisters = PyInstruction_AsInstruction(self)->getWrittenRegisters();
+          Instruction_Object* object = reinterpret_cast<Instruction_Object*>(self);
+
+          if (object->writtenRegisters == nullptr) {
+            PyObject* ret;
+            triton::uint32 index = 0;
+            std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>::const_iterator it;
+            const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& writtenRegisters = object->inst->getWrittenRegisters();
+
+            ret = xPyTuple_New(writtenRegisters.size());
+            for (it = writtenRegisters.begin(); it != writtenRegisters.end(); it++) {
+              PyObject* item = xPyTuple_New(2);
+              PyTuple_SetItem(item, 0, PyRegister(std::get<0>(*it), true));
+              PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
+              PyTuple_SetItem(ret, index++, item);
+            }
 
-          ret = xPyList_New(writtenRegisters.size());
-          for (it = writtenRegisters.begin(); it != writtenRegisters.end(); it++) {
-            PyObject* item = xPyTuple_New(2);
-            PyTuple_SetItem(item, 0, PyRegister(std::get<0>(*it)));
-            PyTuple_SetItem(item, 1, PyAstNode(std::get<1>(*it)));
-            PyList_SetItem(ret, index++, item);
+            object->writtenRegisters = ret;
           }
 
-          return ret;
+          Py_INCREF(object->writtenRegisters);
+          return object->writtenRegisters;
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -659,6 +704,7 @@ namespace triton {
         try {
           if (!PyLong_Check(addr) && !PyInt_Check(addr))
             return PyErr_Format(PyExc_TypeError, "Instruction::setAddress(): Expected an integer as argument.");
+          PyInstruction_Invalidate(self);
           PyInstruction_AsInstruction(self)->setAddress(PyLong_AsUint64(addr));
           Py_INCREF(Py_None);
           return Py_None;
@@ -680,6 +726,7 @@ namespace triton {
           triton::uint8* opcodes = reinterpret_cast<triton::uint8*>(PyBytes_AsString(opc));
           triton::uint32 size    = static_cast<triton::uint32>(PyBytes_Size(opc));
 
+          PyInstruction_Invalidate(self);
           PyInstruction_AsInstruction(self)->setOpcodes(opcodes, size);
           Py_INCREF(Py_None);
           return Py_None;
@@ -695,6 +742,7 @@ namespace triton {
           if (!PyLong_Check(tid) && !PyInt_Check(tid))
             return PyErr_Format(PyExc_TypeError, "Instruction::setThreadId(): Expected an integer as argument.");
 
+          PyInstruction_Invalidate(self);
           PyInstruction_AsInstruction(self)->setThreadId(PyLong_AsUint32(tid));
           Py_INCREF(Py_None);
           return Py_None;
@@ -715,6 +763,7 @@ namespace triton {
             return PyErr_Format(PyExc_TypeError, "Instruction::updateContext(): Expected a Memory or Register as argument.");
 
           inst = PyInstruction_AsInstruction(self);
+          PyInstruction_Invalidate(self);
 
           if (PyMemoryAccess_Check(ctx)) {
             memCtx = PyMemoryAccess_AsMemoryAccess(ctx);
@@ -846,8 +895,15 @@ namespace triton {
 
         PyType_Ready(&Instruction_Type);
         object = PyObject_NEW(Instruction_Object, &Instruction_Type);
-        if (object != NULL)
-          object->inst = new triton::arch::Instruction();
+        if (object != NULL) {
+          object->inst                = new triton::arch::Instruction();
+          object->operands            = nullptr;
+          object->loadAccess          = nullptr;
+          object->storeAccess         = nullptr;
+          object->readRegisters       = nullptr;
+          object->writtenRegisters    = nullptr;
+          object->symbolicExpressions = nullptr;
+        }
 
         return (PyObject* )object;
       }
@@ -858,12 +914,31 @@ namespace triton {
 
         PyType_Ready(&Instruction_Type);
         object = PyObject_NEW(Instruction_Object, &Instruction_Type);
-        if (object != NULL)
-          object->inst = new triton::arch::Instruction(inst);
+        if (object != NULL) {
+          object->inst                = new triton::arch::Instruction(inst);
+          object->operands            = nullptr;
+          object->loadAccess          = nullptr;
+          object->storeAccess         = nullptr;
+          object->readRegisters       = nullptr;
+          object->writtenRegisters    = nullptr;
+          object->symbolicExpressions = nullptr;
+        }
 
         return (PyObject*)object;
       }
 
+
+      void PyInstruction_Invalidate(PyObject* self) {
+        Instruction_Object* object = reinterpret_cast<Instruction_Object*>(self);
+
+        Py_CLEAR(object->operands);
+        Py_CLEAR(object->loadAccess);
+        Py_CLEAR(object->storeAccess);
+        Py_CLEAR(object->readRegisters);
+        Py_CLEAR(object->writtenRegisters);
+        Py_CLEAR(object->symbolicExpressions);
+      }
+
     }; /* python namespace */
   }; /* bindings namespace */
 }; /* triton namespace */
@@ -302,6 +302,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setBaseRegister(PyObject* self, PyObject* reg) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setBaseRegister(): The memory access belongs to an instruction and is read-only.");
+
         try {
           triton::arch::MemoryAccess *mem;
 
@@ -320,6 +323,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setConcreteValue(PyObject* self, PyObject* value) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setConcreteValue(): The memory access belongs to an instruction and is read-only.");
+
         try {
           triton::arch::MemoryAccess *mem;
 
@@ -338,6 +344,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setDisplacement(PyObject* self, PyObject* imm) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setDisplacement(): The memory access belongs to an instruction and is read-only.");
+
         try {
           triton::arch::MemoryAccess *mem;
 
@@ -356,6 +365,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setIndexRegister(PyObject* self, PyObject* reg) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setIndexRegister(): The memory access belongs to an instruction and is read-only.");
+
         try {
           triton::arch::MemoryAccess *mem;
 
@@ -374,6 +386,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setScale(PyObject* self, PyObject* imm) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setScale(): The memory access belongs to an instruction and is read-only.");
+
         try {
           triton::arch::MemoryAccess *mem;
 
@@ -392,6 +407,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setSegmentRegister(PyObject* self, PyObject* reg) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setSegmentRegister(): The memory access belongs to an instruction and is read-only.");
+
         try {
           triton::arch::MemoryAccess *mem;
 
@@ -410,6 +428,9 @@ namespace triton {
 
 
       static PyObject* MemoryAccess_setTrust(PyObject* self, PyObject* flag) {
+        if (PyMemoryAccess_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "MemoryAccess::setTrust(): The memory access belongs to an instruction and is read-only.");
+
         try {
           if (!PyBool_Check(flag))
             return PyErr_Format(PyExc_TypeError, "MemoryAccess::setTrust(): Expected a boolean as argument.");
@@ -519,13 +540,15 @@ namespace triton {
       };
 
 
-      PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem) {
+      PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem, bool readOnly) {
         MemoryAccess_Object* object;
 
         PyType_Ready(&MemoryAccess_Type);
         object = PyObject_NEW(MemoryAccess_Object, &MemoryAccess_Type);
-        if (object != NULL)
-          object->mem = new triton::arch::MemoryAccess(mem);
+        if (object != NULL) {
+          object->mem      = new triton::arch::MemoryAccess(mem);
+          object->readOnly = readOnly;
+        }
 
         return (PyObject*)object;
       }
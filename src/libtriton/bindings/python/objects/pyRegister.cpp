@@ -243,6 +243,9 @@ namespace triton {
 
 
       static PyObject* Register_setConcreteValue(PyObject* self, PyObject* value) {
+        if (PyRegister_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "Register::setConcreteValue(): The register belongs to an instruction and is read-only.");
+
         try {
           triton::arch::Register *reg;
 
@@ -262,6 +265,9 @@ namespace triton {
 
 
       static PyObject* Register_setTrust(PyObject* self, PyObject* flag) {
+        if (PyRegister_IsReadOnly(self))
+          return PyErr_Format(PyExc_TypeError, "Register::setTrust(): The register belongs to an instruction and is read-only.");
+
         try {
           if (!PyBool_Check(flag))
             return PyErr_Format(PyExc_TypeError, "Register::setTrust(): Expected a boolean as argument.");
@@ -364,13 +370,15 @@ namespace triton {
       };
 
 
-      PyObject* PyRegister(const triton::arch::Register& reg) {
+      PyObject* PyRegister(const triton::arch::Register& reg, bool readOnly) {
         Register_Object* object;
 
         PyType_Ready(&Register_Type);
         object = PyObject_NEW(Register_Object, &Register_Type);
-        if (object != NULL)
-          object->reg = new triton::arch::Register(reg);
+        if (object != NULL) {
+          object->reg      = new triton::arch::Register(reg);
+          object->readOnly = readOnly;
+        }
 
         return (PyObject*)object;
       }
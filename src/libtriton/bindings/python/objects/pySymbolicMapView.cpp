@@ -0,0 +1,508 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <pythonObjects.hpp>
+#include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
+#include <symbolicExpression.hpp>
+
+
+
+/*! \page py_SymbolicMapView_page SymbolicMapView
+    \brief [**python api**] All information about the SymbolicMapView python object.
+
+\tableofcontents
+
+\section py_SymbolicMapView_description Description
+<hr>
+
+This object is a read-only view over a container of the symbolic engine. It is returned by `getSymbolicExpressions()`
+(<SymExpr id : \ref py_SymbolicExpression_page>) and `getSymbolicMemory()` (<Addr : \ref py_SymbolicExpression_page>).
+Nothing is copied when the view is created, entries are wrapped only when they are accessed and the view always reflects
+the current state of the engine. It can be used like a read-only dictionary.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import *
+
+>>> setArchitecture(ARCH.X86_64)
+
+>>> inst = Instruction("\x48\x31\xD0") # xor rax, rdx
+>>> inst.setAddress(0x400000)
+>>> processing(inst)
+
+>>> exprs = getSymbolicExpressions()
+>>> len(exprs)
+7
+>>> 0 in exprs
+True
+>>> for exprId, expr in exprs.iteritems():
+...     print exprId, expr.getComment()
+...
+0 XOR operation
+1 Clears carry flag
+2 Clears overflow flag
+3 Parity flag
+4 Sign flag
+5 Zero flag
+6 Program Counter
+
+~~~~~~~~~~~~~
+
+\section SymbolicMapView_py_api Python API - Methods of the SymbolicMapView class
+<hr>
+
+- **get(integer key, default=None)**<br>
+Returns the \ref py_SymbolicExpression_page of `key` if it is defined, otherwise `default`.
+
+- **items(void)**<br>
+Returns the list of all `(key, SymbolicExpression)` tuples.
+
+- **iteritems(void)**<br>
+Returns an iterator over the `(key, SymbolicExpression)` tuples.
+
+- **iterkeys(void)**<br>
+Returns an iterator over the keys. It is also the iterator of the view.
+
+- **itervalues(void)**<br>
+Returns an iterator over the \ref py_SymbolicExpression_page.
+
+- **keys(void)**<br>
+Returns the list of all keys.
+
+- **values(void)**<br>
+Returns the list of all \ref py_SymbolicExpression_page.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      /*
+       * Finds the first entry of the container after the key `last` (the first entry if `started` is false).
+       * Iterators only keep the last key, so the engine may be modified between two steps.
+       */
+      static bool SymbolicMapView_next(triton::uint32 kind, bool started, triton::uint64 last, triton::uint64& key, triton::engines::symbolic::SymbolicExpression*& expr) {
+        switch (kind) {
+          case SYMBOLIC_EXPRESSIONS_VIEW: {
+            const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& exprs = triton::api.getSymbolicExpressions();
+            std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
+
+            it = started ? exprs.upper_bound(static_cast<triton::usize>(last)) : exprs.begin();
+            if (it == exprs.end())
+              return false;
+
+            key  = it->first;
+            expr = it->second;
+            return true;
+          }
+
+          case SYMBOLIC_MEMORY_VIEW: {
+            const std::map<triton::uint64, triton::usize>& refs = triton::api.getSymbolicMemoryReferences();
+            std::map<triton::uint64, triton::usize>::const_iterator it;
+
+            it = started ? refs.upper_bound(last) : refs.begin();
+            if (it == refs.end())
+              return false;
+
+            key  = it->first;
+            expr = triton::api.getSymbolicExpressionFromId(it->second);
+            return true;
+          }
+
+          default:
+            throw triton::exceptions::Bindings("SymbolicMapView_next(): Invalid kind of view.");
+        }
+      }
+
+
+      /* Returns the expression of a key or nullptr if the key is not defined */
+      static triton::engines::symbolic::SymbolicExpression* SymbolicMapView_find(triton::uint32 kind, PyObject* key) {
+        if (!PyLong_Check(key) && !PyInt_Check(key))
+          return nullptr;
+
+        switch (kind) {
+          case SYMBOLIC_EXPRESSIONS_VIEW: {
+            const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& exprs = triton::api.getSymbolicExpressions();
+            std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>::const_iterator it = exprs.find(PyLong_AsUsize(key));
+            if (it == exprs.end())
+              return nullptr;
+            return it->second;
+          }
+
+          case SYMBOLIC_MEMORY_VIEW: {
+            const std::map<triton::uint64, triton::usize>& refs = triton::api.getSymbolicMemoryReferences();
+            std::map<triton::uint64, triton::usize>::const_iterator it = refs.find(PyLong_AsUint64(key));
+            if (it == refs.end())
+              return nullptr;
+            return triton::api.getSymbolicExpressionFromId(it->second);
+          }
+
+          default:
+            throw triton::exceptions::Bindings("SymbolicMapView_find(): Invalid kind of view.");
+        }
+      }
+
+
+      static PyObject* SymbolicMapView_key(triton::uint32 kind, triton::uint64 key) {
+        if (kind == SYMBOLIC_EXPRESSIONS_VIEW)
+          return PyLong_FromUsize(static_cast<triton::usize>(key));
+        return PyLong_FromUint64(key);
+      }
+
+
+      /* Returns the key, the expression or the (key, expression) tuple according to the mode */
+      static PyObject* SymbolicMapView_item(triton::uint32 kind, triton::uint32 mode, triton::uint64 key, triton::engines::symbolic::SymbolicExpression* expr) {
+        switch (mode) {
+          case SYMBOLIC_MAP_KEYS:
+            return SymbolicMapView_key(kind, key);
+
+          case SYMBOLIC_MAP_VALUES:
+            return PySymbolicExpression(expr);
+
+          default: {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, SymbolicMapView_key(kind, key));
+            PyTuple_SetItem(item, 1, PySymbolicExpression(expr));
+            return item;
+          }
+        }
+      }
+
+
+      /* Materializes the view as a list */
+      static PyObject* SymbolicMapView_list(PyObject* self, triton::uint32 mode) {
+        triton::uint32 kind = reinterpret_cast<SymbolicMapView_Object*>(self)->kind;
+        triton::engines::symbolic::SymbolicExpression* expr = nullptr;
+        triton::uint64 key = 0;
+        PyObject* ret = nullptr;
+
+        try {
+          ret = xPyList_New(0);
+          for (bool started = false; SymbolicMapView_next(kind, started, key, key, expr); started = true) {
+            PyObject* item = SymbolicMapView_item(kind, mode, key, expr);
+            PyList_Append(ret, item);
+            Py_DECREF(item);
+          }
+          return ret;
+        }
+        catch (const std::exception& e) {
+          Py_XDECREF(ret);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! SymbolicMapView destructor.
+      void SymbolicMapView_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        Py_DECREF(self);
+      }
+
+
+      static Py_ssize_t SymbolicMapView_length(PyObject* self) {
+        try {
+          if (reinterpret_cast<SymbolicMapView_Object*>(self)->kind == SYMBOLIC_EXPRESSIONS_VIEW)
+            return static_cast<Py_ssize_t>(triton::api.getSymbolicExpressions().size());
+          return static_cast<Py_ssize_t>(triton::api.getSymbolicMemoryReferences().size());
+        }
+        catch (const std::exception& e) {
+          PyErr_Format(PyExc_TypeError, "%s", e.what());
+          return -1;
+        }
+      }
+
+
+      static PyObject* SymbolicMapView_subscript(PyObject* self, PyObject* key) {
+        try {
+          triton::engines::symbolic::SymbolicExpression* expr = SymbolicMapView_find(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, key);
+          if (expr == nullptr) {
+            PyErr_SetObject(PyExc_KeyError, key);
+            return nullptr;
+          }
+          return PySymbolicExpression(expr);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static int SymbolicMapView_contains(PyObject* self, PyObject* key) {
+        try {
+          return SymbolicMapView_find(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, key) != nullptr;
+        }
+        catch (const std::exception& e) {
+          PyErr_Format(PyExc_TypeError, "%s", e.what());
+          return -1;
+        }
+      }
+
+
+      static PyObject* SymbolicMapView_iter(PyObject* self) {
+        return PySymbolicMapViewIterator(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, SYMBOLIC_MAP_KEYS);
+      }
+
+
+      static PyObject* SymbolicMapView_get(PyObject* self, PyObject* args) {
+        PyObject* key  = nullptr;
+        PyObject* dflt = Py_None;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "O|O", &key, &dflt) == false)
+          return PyErr_Format(PyExc_TypeError, "SymbolicMapView::get(): Invalid number of arguments");
+
+        try {
+          triton::engines::symbolic::SymbolicExpression* expr = SymbolicMapView_find(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, key);
+          if (expr == nullptr) {
+            Py_INCREF(dflt);
+            return dflt;
+          }
+          return PySymbolicExpression(expr);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SymbolicMapView_items(PyObject* self, PyObject* noarg) {
+        return SymbolicMapView_list(self, SYMBOLIC_MAP_ITEMS);
+      }
+
+
+      static PyObject* SymbolicMapView_iteritems(PyObject* self, PyObject* noarg) {
+        return PySymbolicMapViewIterator(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, SYMBOLIC_MAP_ITEMS);
+      }
+
+
+      static PyObject* SymbolicMapView_iterkeys(PyObject* self, PyObject* noarg) {
+        return PySymbolicMapViewIterator(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, SYMBOLIC_MAP_KEYS);
+      }
+
+
+      static PyObject* SymbolicMapView_itervalues(PyObject* self, PyObject* noarg) {
+        return PySymbolicMapViewIterator(reinterpret_cast<SymbolicMapView_Object*>(self)->kind, SYMBOLIC_MAP_VALUES);
+      }
+
+
+      static PyObject* SymbolicMapView_keys(PyObject* self, PyObject* noarg) {
+        return SymbolicMapView_list(self, SYMBOLIC_MAP_KEYS);
+      }
+
+
+      static PyObject* SymbolicMapView_values(PyObject* self, PyObject* noarg) {
+        return SymbolicMapView_list(self, SYMBOLIC_MAP_VALUES);
+      }
+
+
+      //! SymbolicMapView methods.
+      PyMethodDef SymbolicMapView_callbacks[] = {
+        {"get",           SymbolicMapView_get,          METH_VARARGS,   ""},
+        {"items",         SymbolicMapView_items,        METH_NOARGS,    ""},
+        {"iteritems",     SymbolicMapView_iteritems,    METH_NOARGS,    ""},
+        {"iterkeys",      SymbolicMapView_iterkeys,     METH_NOARGS,    ""},
+        {"itervalues",    SymbolicMapView_itervalues,   METH_NOARGS,    ""},
+        {"keys",          SymbolicMapView_keys,         METH_NOARGS,    ""},
+        {"values",        SymbolicMapView_values,       METH_NOARGS,    ""},
+        {nullptr,         nullptr,                      0,              nullptr}
+      };
+
+
+      //! SymbolicMapView mapping protocol.
+      static PyMappingMethods SymbolicMapView_AsMapping = {
+        (lenfunc)SymbolicMapView_length,            /* mp_length */
+        (binaryfunc)SymbolicMapView_subscript,      /* mp_subscript */
+        0,                                          /* mp_ass_subscript */
+      };
+
+
+      //! SymbolicMapView sequence protocol, only used by the `in` operator.
+      static PySequenceMethods SymbolicMapView_AsSequence = {
+        0,                                          /* sq_length */
+        0,                                          /* sq_concat */
+        0,                                          /* sq_repeat */
+        0,                                          /* sq_item */
+        0,                                          /* sq_slice */
+        0,                                          /* sq_ass_item */
+        0,                                          /* sq_ass_slice */
+        (objobjproc)SymbolicMapView_contains,       /* sq_contains */
+        0,                                          /* sq_inplace_concat */
+        0,                                          /* sq_inplace_repeat */
+      };
+
+
+      PyTypeObject SymbolicMapView_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "SymbolicMapView",                          /* tp_name */
+        sizeof(SymbolicMapView_Object),             /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)SymbolicMapView_dealloc,        /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        &SymbolicMapView_AsSequence,                /* tp_as_sequence */
+        &SymbolicMapView_AsMapping,                 /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "SymbolicMapView objects",                  /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        (getiterfunc)SymbolicMapView_iter,          /* tp_iter */
+        0,                                          /* tp_iternext */
+        SymbolicMapView_callbacks,                  /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      //! SymbolicMapViewIterator destructor.
+      void SymbolicMapViewIterator_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        Py_DECREF(self);
+      }
+
+
+      static PyObject* SymbolicMapViewIterator_iternext(PyObject* self) {
+        SymbolicMapViewIterator_Object* iterator = reinterpret_cast<SymbolicMapViewIterator_Object*>(self);
+        triton::engines::symbolic::SymbolicExpression* expr = nullptr;
+        triton::uint64 key = 0;
+
+        try {
+          /* Returning nullptr without exception stops the iteration */
+          if (!SymbolicMapView_next(iterator->kind, iterator->started, iterator->last, key, expr))
+            return nullptr;
+
+          iterator->started = true;
+          iterator->last    = key;
+
+          return SymbolicMapView_item(iterator->kind, iterator->mode, key, expr);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      PyTypeObject SymbolicMapViewIterator_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "SymbolicMapViewIterator",                  /* tp_name */
+        sizeof(SymbolicMapViewIterator_Object),     /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)SymbolicMapViewIterator_dealloc,/* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "SymbolicMapViewIterator objects",          /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        PyObject_SelfIter,                          /* tp_iter */
+        (iternextfunc)SymbolicMapViewIterator_iternext, /* tp_iternext */
+        0,                                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PySymbolicMapView(triton::uint32 kind) {
+        SymbolicMapView_Object* object;
+
+        PyType_Ready(&SymbolicMapView_Type);
+        object = PyObject_NEW(SymbolicMapView_Object, &SymbolicMapView_Type);
+        if (object != NULL)
+          object->kind = kind;
+
+        return (PyObject*)object;
+      }
+
+
+      PyObject* PySymbolicMapViewIterator(triton::uint32 kind, triton::uint32 mode) {
+        SymbolicMapViewIterator_Object* object;
+
+        PyType_Ready(&SymbolicMapViewIterator_Type);
+        object = PyObject_NEW(SymbolicMapViewIterator_Object, &SymbolicMapViewIterator_Type);
+        if (object != NULL) {
+          object->kind    = kind;
+          object->mode    = mode;
+          object->started = false;
+          object->last    = 0;
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -6,6 +6,7 @@
 */
 
 #include <callbacks.hpp>
+#include <cpuSize.hpp>
 #include <exceptions.hpp>
 
 #ifdef TRITON_PYTHON_BINDINGS
@@ -20,20 +21,29 @@ namespace triton {
   namespace callbacks {
 
     Callbacks::Callbacks() {
-      this->isDefined = false;
+      this->cacheEnabled        = false;
+      this->cachePerInstruction = true;
+      this->isDefined           = false;
     }
 
 
     Callbacks::Callbacks(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
-      this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
-      this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
-      this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pyGetConcreteMemoryValueCallbacks       = copy.pyGetConcreteMemoryValueCallbacks;
+      this->pyGetConcreteRegisterValueCallbacks     = copy.pyGetConcreteRegisterValueCallbacks;
+      this->pySymbolicSimplificationCallbacks       = copy.pySymbolicSimplificationCallbacks;
+      this->pySymbolicSimplificationBatchCallbacks  = copy.pySymbolicSimplificationBatchCallbacks;
+      this->pyCallbackFilters                       = copy.pyCallbackFilters;
       #endif
-      this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
-      this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
-      this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
-      this->isDefined                           = copy.isDefined;
+      this->getConcreteMemoryValueCallbacks         = copy.getConcreteMemoryValueCallbacks;
+      this->getConcreteRegisterValueCallbacks       = copy.getConcreteRegisterValueCallbacks;
+      this->symbolicSimplificationCallbacks         = copy.symbolicSimplificationCallbacks;
+      this->symbolicSimplificationBatchCallbacks    = copy.symbolicSimplificationBatchCallbacks;
+      this->isDefined                               = copy.isDefined;
+      this->cacheEnabled                            = copy.cacheEnabled;
+      this->cachePerInstruction                     = copy.cachePerInstruction;
+      this->cachedMemory                            = copy.cachedMemory;
+      this->cachedRegisters                         = copy.cachedRegisters;
     }
 
 
@@ -43,14 +53,21 @@ namespace triton {
 
     void Callbacks::operator=(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
-      this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
-      this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
-      this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pyGetConcreteMemoryValueCallbacks       = copy.pyGetConcreteMemoryValueCallbacks;
+      this->pyGetConcreteRegisterValueCallbacks     = copy.pyGetConcreteRegisterValueCallbacks;
+      this->pySymbolicSimplificationCallbacks       = copy.pySymbolicSimplificationCallbacks;
+      this->pySymbolicSimplificationBatchCallbacks  = copy.pySymbolicSimplificationBatchCallbacks;
+      this->pyCallbackFilters                       = copy.pyCallbackFilters;
       #endif
-      this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
-      this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
-      this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
-      this->isDefined                           = copy.isDefined;
+      this->getConcreteMemoryValueCallbacks         = copy.getConcreteMemoryValueCallbacks;
+      this->getConcreteRegisterValueCallbacks       = copy.getConcreteRegisterValueCallbacks;
+      this->symbolicSimplificationCallbacks         = copy.symbolicSimplificationCallbacks;
+      this->symbolicSimplificationBatchCallbacks    = copy.symbolicSimplificationBatchCallbacks;
+      this->isDefined                               = copy.isDefined;
+      this->cacheEnabled                            = copy.cacheEnabled;
+      this->cachePerInstruction                     = copy.cachePerInstruction;
+      this->cachedMemory                            = copy.cachedMemory;
+      this->cachedRegisters                         = copy.cachedRegisters;
     }
 
 
@@ -72,8 +89,14 @@ namespace triton {
     }
 
 
+    void Callbacks::addCallback(triton::callbacks::symbolicSimplificationBatchCallback cb) {
+      this->symbolicSimplificationBatchCallbacks.push_back(cb);
+      this->isDefined = true;
+    }
+
+
     #ifdef TRITON_PYTHON_BINDINGS
-    void Callbacks::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    void Callbacks::addCallback(PyObject* function, triton::callbacks::callback_e kind, const std::set<triton::ast::kind_e>& filter) {
       switch (kind) {
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.push_back(function);
@@ -84,9 +107,19 @@ namespace triton {
         case SYMBOLIC_SIMPLIFICATION:
           this->pySymbolicSimplificationCallbacks.push_back(function);
           break;
+        case SYMBOLIC_SIMPLIFICATION_BATCH:
+          this->pySymbolicSimplificationBatchCallbacks.push_back(function);
+          break;
         default:
           throw triton::exceptions::Callbacks("Callbacks::addCallback(): Invalid kind of callback.");
       };
+
+      /* The filter belongs to this registration only, not to the function */
+      if (!filter.empty())
+        this->pyCallbackFilters[std::make_pair(kind, function)] = filter;
+      else
+        this->pyCallbackFilters.erase(std::make_pair(kind, function));
+
       this->isDefined = true;
     }
     #endif
@@ -96,11 +129,16 @@ namespace triton {
       this->getConcreteMemoryValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
+      this->symbolicSimplificationBatchCallbacks.clear();
       #ifdef TRITON_PYTHON_BINDINGS
       this->pyGetConcreteMemoryValueCallbacks.clear();
       this->pyGetConcreteRegisterValueCallbacks.clear();
       this->pySymbolicSimplificationCallbacks.clear();
+      this->pySymbolicSimplificationBatchCallbacks.clear();
+      this->pyCallbackFilters.clear();
       #endif
+      this->isDefined = false;
+      this->clearConcreteCallbacksCache();
     }
 
 
@@ -125,6 +163,13 @@ namespace triton {
     }
 
 
+    void Callbacks::removeCallback(triton::callbacks::symbolicSimplificationBatchCallback cb) {
+      this->symbolicSimplificationBatchCallbacks.remove(cb);
+      if (this->countCallbacks() == 0)
+        this->isDefined = false;
+    }
+
+
     #ifdef TRITON_PYTHON_BINDINGS
     void Callbacks::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
       switch (kind) {
@@ -137,10 +182,15 @@ namespace triton {
         case SYMBOLIC_SIMPLIFICATION:
           this->pySymbolicSimplificationCallbacks.remove(function);
           break;
+        case SYMBOLIC_SIMPLIFICATION_BATCH:
+          this->pySymbolicSimplificationBatchCallbacks.remove(function);
+          break;
         default:
           throw triton::exceptions::Callbacks("Callbacks::removeCallback(): Invalid kind of callback.");
       };
 
+      this->pyCallbackFilters.erase(std::make_pair(kind, function));
+
       if (this->countCallbacks() == 0)
         this->isDefined = false;
     }
@@ -163,6 +213,10 @@ namespace triton {
           std::list<PyObject*>::const_iterator it2;
           for (it2 = this->pySymbolicSimplificationCallbacks.begin(); it2 != this->pySymbolicSimplificationCallbacks.end(); it2++) {
 
+            /* Skip the call if the callback cannot rewrite this kind of root */
+            if (!this->isAcceptedByFilter(kind, *it2, node))
+              continue;
+
             /* Create function args */
             PyObject* args = triton::bindings::python::xPyTuple_New(1);
             PyTuple_SetItem(args, 0, triton::bindings::python::PyAstNode(node));
@@ -173,16 +227,21 @@ namespace triton {
             /* Check the call */
             if (ret == nullptr) {
               PyErr_Print();
+              Py_DECREF(args);
               throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): Fail to call the python callback.");
             }
 
             /* Check if the callback has returned a AbstractNode */
-            if (!PyAstNode_Check(ret))
+            if (!PyAstNode_Check(ret)) {
+              Py_DECREF(args);
+              Py_DECREF(ret);
               throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): You must return a AstNode object.");
+            }
 
             /* Update node */
             node = PyAstNode_AsAstNode(ret);
             Py_DECREF(args);
+            Py_DECREF(ret);
           }
           #endif
           break;
@@ -195,9 +254,89 @@ namespace triton {
     }
 
 
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, std::vector<triton::ast::AbstractNode*>& nodes) const {
+      switch (kind) {
+        case triton::callbacks::SYMBOLIC_SIMPLIFICATION_BATCH: {
+          // C++ callbacks
+          std::list<triton::callbacks::symbolicSimplificationBatchCallback>::const_iterator it1;
+          for (it1 = this->symbolicSimplificationBatchCallbacks.begin(); it1 != this->symbolicSimplificationBatchCallbacks.end(); it1++) {
+            triton::usize size = nodes.size();
+            (*it1)(nodes);
+            if (nodes.size() != size)
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION_BATCH): You cannot add or remove nodes.");
+            for (triton::usize index = 0; index < nodes.size(); index++) {
+              if (nodes[index] == nullptr)
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION_BATCH): You cannot return a nullptr node.");
+            }
+          }
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pySymbolicSimplificationBatchCallbacks.begin(); it2 != this->pySymbolicSimplificationBatchCallbacks.end(); it2++) {
+            std::vector<triton::usize> indexes;
+
+            /* Only send the roots accepted by the filter */
+            for (triton::usize index = 0; index < nodes.size(); index++) {
+              if (this->isAcceptedByFilter(kind, *it2, nodes[index]))
+                indexes.push_back(index);
+            }
+
+            if (indexes.empty())
+              continue;
+
+            /* Create function args */
+            PyObject* batch = triton::bindings::python::xPyList_New(indexes.size());
+            for (triton::usize index = 0; index < indexes.size(); index++)
+              PyList_SetItem(batch, index, triton::bindings::python::PyAstNode(nodes[indexes[index]]));
+
+            PyObject* args = triton::bindings::python::xPyTuple_New(1);
+            PyTuple_SetItem(args, 0, batch);
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              Py_DECREF(args);
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION_BATCH): Fail to call the python callback.");
+            }
+
+            /* Check if the callback has returned a list of AbstractNode */
+            bool valid = (PyList_Check(ret) && static_cast<triton::usize>(PyList_Size(ret)) == indexes.size());
+            for (triton::usize index = 0; valid && index < indexes.size(); index++)
+              valid = PyAstNode_Check(PyList_GetItem(ret, index));
+
+            if (!valid) {
+              Py_DECREF(args);
+              Py_DECREF(ret);
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION_BATCH): You must return a list of AstNode with the same length.");
+            }
+
+            /* Update nodes only once the whole list is valid */
+            for (triton::usize index = 0; index < indexes.size(); index++)
+              nodes[indexes[index]] = PyAstNode_AsAstNode(PyList_GetItem(ret, index));
+
+            Py_DECREF(args);
+            Py_DECREF(ret);
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_MEMORY_VALUE: {
+          if (this->cacheEnabled && this->isCached(mem))
+            return;
+
           // C++ callbacks
           std::list<triton::callbacks::getConcreteMemoryValueCallback>::const_iterator it1;
           for (it1 = this->getConcreteMemoryValueCallbacks.begin(); it1 != this->getConcreteMemoryValueCallbacks.end(); it1++)
@@ -224,6 +363,12 @@ namespace triton {
             Py_DECREF(args);
           }
           #endif
+
+          /* Memoize once all callbacks have been served (they may write the memory) */
+          if (this->cacheEnabled) {
+            for (triton::uint32 index = 0; index < mem.getSize(); index++)
+              this->cachedMemory.insert(mem.getAddress() + index);
+          }
           break;
         }
 
@@ -236,6 +381,9 @@ namespace triton {
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE: {
+          if (this->cacheEnabled && this->isCached(reg))
+            return;
+
           // C++ callbacks
           std::list<triton::callbacks::getConcreteRegisterValueCallback>::const_iterator it1;
           for (it1 = this->getConcreteRegisterValueCallbacks.begin(); it1 != this->getConcreteRegisterValueCallbacks.end(); it1++)
@@ -262,6 +410,10 @@ namespace triton {
             Py_DECREF(args);
           }
           #endif
+
+          /* Memoize once all callbacks have been served (they may write the register) */
+          if (this->cacheEnabled)
+            this->cachedRegisters[reg.getId()] = reg.getParent().getId();
           break;
         }
 
@@ -271,16 +423,149 @@ namespace triton {
     }
 
 
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const {
+      if (kind != triton::callbacks::GET_CONCRETE_MEMORY_VALUE)
+        throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+
+      /* One callback per chunk instead of one per byte */
+      while (size) {
+        triton::uint32 chunk = DQQWORD_SIZE;
+        while (chunk > size)
+          chunk >>= 1;
+        this->processCallbacks(kind, triton::arch::MemoryAccess(baseAddr, chunk));
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    bool Callbacks::isCached(const triton::arch::MemoryAccess& mem) const {
+      for (triton::uint32 index = 0; index < mem.getSize(); index++) {
+        if (this->cachedMemory.find(mem.getAddress() + index) == this->cachedMemory.end())
+          return false;
+      }
+      return true;
+    }
+
+
+    bool Callbacks::isCached(const triton::arch::Register& reg) const {
+      return (this->cachedRegisters.find(reg.getId()) != this->cachedRegisters.end());
+    }
+
+
+    void Callbacks::enableConcreteCallbacksCache(bool flag) {
+      this->cacheEnabled = flag;
+      this->clearConcreteCallbacksCache();
+    }
+
+
+    bool Callbacks::isConcreteCallbacksCacheEnabled(void) const {
+      return this->cacheEnabled;
+    }
+
+
+    void Callbacks::enableConcreteCallbacksCachePerInstruction(bool flag) {
+      this->cachePerInstruction = flag;
+    }
+
+
+    bool Callbacks::isConcreteCallbacksCachePerInstructionEnabled(void) const {
+      return this->cachePerInstruction;
+    }
+
+
+    void Callbacks::clearConcreteCallbacksCache(void) {
+      this->cachedMemory.clear();
+      this->cachedRegisters.clear();
+    }
+
+
+    void Callbacks::invalidateConcreteCallbacksCache(triton::uint64 baseAddr, triton::usize size) {
+      if (this->cachedMemory.empty())
+        return;
+
+      for (triton::usize index = 0; index < size; index++)
+        this->cachedMemory.erase(baseAddr + index);
+    }
+
+
+    void Callbacks::invalidateConcreteCallbacksCache(const triton::arch::Register& reg) {
+      std::map<triton::uint32, triton::uint32>::iterator it;
+      triton::uint32 parentId = reg.getParent().getId();
+
+      for (it = this->cachedRegisters.begin(); it != this->cachedRegisters.end();) {
+        if (it->second == parentId)
+          this->cachedRegisters.erase(it++);
+        else
+          it++;
+      }
+    }
+
+
+    #ifdef TRITON_PYTHON_BINDINGS
+    bool Callbacks::isAcceptedByFilter(triton::callbacks::callback_e kind, PyObject* function, triton::ast::AbstractNode* node) const {
+      std::map<std::pair<triton::callbacks::callback_e, PyObject*>, std::set<triton::ast::kind_e>>::const_iterator it;
+
+      if (this->pyCallbackFilters.empty())
+        return true;
+
+      it = this->pyCallbackFilters.find(std::make_pair(kind, function));
+      if (it == this->pyCallbackFilters.end())
+        return true;
+
+      return (it->second.find(node->getKind()) != it->second.end());
+    }
+    #endif
+
+
+    bool Callbacks::hasCallbacks(triton::callbacks::callback_e kind) const {
+      switch (kind) {
+        case GET_CONCRETE_MEMORY_VALUE:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pyGetConcreteMemoryValueCallbacks.empty())
+            return true;
+          #endif
+          return !this->getConcreteMemoryValueCallbacks.empty();
+
+        case GET_CONCRETE_REGISTER_VALUE:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pyGetConcreteRegisterValueCallbacks.empty())
+            return true;
+          #endif
+          return !this->getConcreteRegisterValueCallbacks.empty();
+
+        case SYMBOLIC_SIMPLIFICATION:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pySymbolicSimplificationCallbacks.empty())
+            return true;
+          #endif
+          return !this->symbolicSimplificationCallbacks.empty();
+
+        case SYMBOLIC_SIMPLIFICATION_BATCH:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pySymbolicSimplificationBatchCallbacks.empty())
+            return true;
+          #endif
+          return !this->symbolicSimplificationBatchCallbacks.empty();
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::hasCallbacks(): Invalid kind of callback.");
+      };
+    }
+
+
     triton::usize Callbacks::countCallbacks(void) const {
       triton::usize count = 0;
 
       count += this->getConcreteMemoryValueCallbacks.size();
       count += this->getConcreteRegisterValueCallbacks.size();
       count += this->symbolicSimplificationCallbacks.size();
+      count += this->symbolicSimplificationBatchCallbacks.size();
       #ifdef TRITON_PYTHON_BINDINGS
       count += this->pyGetConcreteMemoryValueCallbacks.size();
       count += this->pyGetConcreteRegisterValueCallbacks.size();
       count += this->pySymbolicSimplificationCallbacks.size();
+      count += this->pySymbolicSimplificationBatchCallbacks.size();
       #endif
 
       return count;
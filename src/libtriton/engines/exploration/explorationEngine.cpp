@@ -0,0 +1,585 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <chrono>
+#include <cstring>
+#include <tuple>
+
+#if defined(TRITON_THREAD_LOCAL_API)
+  #include <thread>
+#endif
+
+#include <api.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <explorationEngine.hpp>
+#include <libcSummaries.hpp>
+#include <x86Specifications.hpp>
+
+
+
+/*! \page engine_Exploration_page Exploration Engine
+    \brief [**internal**] All information about the exploration engine.
+
+\tableofcontents
+
+\section engine_Exploration_description Description
+<hr>
+
+The exploration engine is a concolic driver written on top of the emulator. It does not
+need Pin: the binary is mapped into the memory of the API, the imported routines are hooked
+via the GOT to the \ref libc_summaries_page (or to a stub which returns zero) and each input
+is emulated from the entry point until it returns.
+
+Each run records the path constraints of the symbolic branches. Every branch which has not
+been negated by a parent is negated in turn: the solver is asked for a model of the prefix
+of the path and the untaken branch, the model is applied on the input and the new input is
+queued. Inputs already queued and paths already explored are deduplicated by hash.
+
+The search strategy selects the next input of the worklist:
+
+- `STRATEGY_DFS` runs first the last generated input.
+- `STRATEGY_GENERATIONAL` runs the inputs generation by generation (breadth first).
+- `STRATEGY_COVERAGE` runs first the inputs which lead to an uncovered address.
+
+~~~~~~~~~~~~~{.cpp}
+triton::format::elf::Elf binary("./crackme_xor");
+triton::engines::exploration::ExplorationEngine engine(binary);
+
+engine.addArgumentSeed(5);
+engine.explore();
+
+for (auto& stat : engine.getStats())
+  std::cout << stat.first << ": " << stat.second << std::endl;
+~~~~~~~~~~~~~
+
+With a libtriton built with `-DTHREAD_LOCAL_API=on`, setWorkers() spreads the runs on a pool
+of threads, each one with its own API. Otherwise, the runs are processed one by one on the API
+of the calling thread, whose state is overwritten.
+
+*/
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      /* ELF machines */
+      static const triton::uint16 EM_386    = 3;
+      static const triton::uint16 EM_X86_64 = 62;
+
+      /* Symbol type of the functions */
+      static const triton::uint8 STT_FUNC = 2;
+
+      /* Relocations of the imported symbols (same values on x86 and x86-64) */
+      static const triton::uint64 R_GLOB_DAT  = 6;
+      static const triton::uint64 R_JUMP_SLOT = 7;
+
+      /* The size of the area of each hooked routine */
+      static const triton::uint64 HOOK_SIZE = 16;
+
+      /* The maximum size of an instruction */
+      static const triton::usize OPCODES_SIZE = 16;
+
+      /* The area of argv */
+      static const triton::uint64 ARGV0_ADDRESS = ARGV_BASE;
+      static const triton::uint64 ARGV_ADDRESS  = ARGV_BASE + 0x80;
+      static const triton::uint64 ARGV1_ADDRESS = ARGV_BASE + 0x100;
+
+      /* FNV-1a */
+      static const triton::usize FNV_OFFSET = static_cast<triton::usize>(14695981039346656037ULL);
+      static const triton::usize FNV_PRIME  = static_cast<triton::usize>(1099511628211ULL);
+
+
+      /* Mixes a value into a FNV-1a hash */
+      static void hashValue(triton::usize& hash, triton::uint64 value) {
+        for (triton::uint32 index = 0; index < QWORD_SIZE; index++) {
+          hash ^= (value >> (index * BYTE_SIZE_BIT)) & 0xff;
+          hash *= FNV_PRIME;
+        }
+      }
+
+
+      /* The summary of the imported routines without built-in summary */
+      static bool returnZero_s(triton::arch::Instruction& inst) {
+        triton::engines::summary::libc::return_s(inst, triton::ast::bv(0, triton::api.cpuRegisterBitSize()), false, "return value");
+        return true;
+      }
+
+
+      /* Sets the concrete value of a register */
+      static void setRegister(const triton::arch::Register& reg, triton::uint64 value) {
+        triton::arch::Register r(reg);
+        r.setConcreteValue(value);
+        triton::api.setConcreteRegisterValue(r);
+      }
+
+
+      ExplorationEngine::ExplorationEngine(const triton::format::elf::Elf& binary) : binary(binary) {
+        switch (binary.getHeader().getMachine()) {
+          case EM_386:    this->arch = triton::arch::ARCH_X86;    break;
+          case EM_X86_64: this->arch = triton::arch::ARCH_X86_64; break;
+          default:
+            throw triton::exceptions::ExplorationEngine("ExplorationEngine::ExplorationEngine(): Unsupported architecture.");
+        }
+
+        this->entry           = binary.getHeader().getEntry();
+        this->strategy        = triton::engines::exploration::STRATEGY_GENERATIONAL;
+        this->setup           = nullptr;
+        this->workers         = 1;
+        this->maxIterations   = 1000;
+        this->maxInstructions = 100000;
+        this->iterations      = 0;
+        this->running         = 0;
+
+        this->setEntryPoint("main");
+      }
+
+
+      ExplorationEngine::~ExplorationEngine() {
+      }
+
+
+      triton::usize ExplorationEngine::hashInput(const triton::engines::exploration::input_t& input) {
+        triton::usize hash = FNV_OFFSET;
+
+        for (auto it = input.begin(); it != input.end(); it++) {
+          hashValue(hash, it->first);
+          hashValue(hash, it->second);
+        }
+
+        return hash;
+      }
+
+
+      void ExplorationEngine::push(const item_t& item) {
+        if (!this->inputHashes.insert(ExplorationEngine::hashInput(item.input)).second) {
+          this->stats["duplicated_inputs"]++;
+          return;
+        }
+        this->worklist.push_back(item);
+      }
+
+
+      ExplorationEngine::item_t ExplorationEngine::pop(void) {
+        std::deque<item_t>::iterator it = this->worklist.begin();
+
+        switch (this->strategy) {
+          case triton::engines::exploration::STRATEGY_DFS:
+            it = this->worklist.end() - 1;
+            break;
+
+          case triton::engines::exploration::STRATEGY_COVERAGE:
+            for (std::deque<item_t>::iterator candidate = this->worklist.begin(); candidate != this->worklist.end(); candidate++) {
+              if (this->coverage.find(candidate->target) == this->coverage.end()) {
+                it = candidate;
+                break;
+              }
+            }
+            break;
+
+          case triton::engines::exploration::STRATEGY_GENERATIONAL:
+            break;
+        }
+
+        item_t item = *it;
+        this->worklist.erase(it);
+
+        return item;
+      }
+
+
+      void ExplorationEngine::load(void) {
+        const std::vector<triton::format::elf::ElfSymbolTable>& symbols = this->binary.getSymbolsTable();
+        const std::vector<triton::format::elf::ElfRelocationTable>& relocations = this->binary.getRelocationTable();
+        triton::uint32 size = triton::api.cpuRegisterSize();
+
+        /* Map the segments */
+        for (auto it = this->binary.getMemoryMapping().begin(); it != this->binary.getMemoryMapping().end(); it++)
+          triton::api.setConcreteMemoryAreaValue(it->getVirtualAddress(), it->getMemoryArea(), it->getSize());
+
+        /* The routines defined in the binary (static builds) */
+        triton::api.addSummaries(this->binary);
+
+        /* Hook the imported routines */
+        for (triton::usize index = 0; index < relocations.size(); index++) {
+          const triton::format::elf::ElfRelocationTable& rel = relocations[index];
+
+          if (rel.getType() != R_JUMP_SLOT && rel.getType() != R_GLOB_DAT)
+            continue;
+
+          if (rel.getSymidx() >= symbols.size() || (symbols[rel.getSymidx()].getInfo() & 0xf) != STT_FUNC)
+            continue;
+
+          triton::uint64 hook = triton::engines::exploration::HOOK_BASE + index * HOOK_SIZE;
+
+          /* A ret makes the hook mapped and harmless to disassemble */
+          triton::api.setConcreteMemoryValue(hook, 0xc3);
+          triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(rel.getOffset(), size, hook));
+
+          if (!triton::api.addSummary(hook, symbols[rel.getSymidx()].getName()))
+            triton::api.addSummary(hook, returnZero_s, symbols[rel.getSymidx()].getName());
+        }
+      }
+
+
+      void ExplorationEngine::initContext(const triton::engines::exploration::input_t& input) {
+        triton::uint32 size = triton::api.cpuRegisterSize();
+        const char* name    = "prog";
+
+        /* argv = {"prog", argv[1], nullptr} */
+        triton::api.setConcreteMemoryAreaValue(ARGV0_ADDRESS, reinterpret_cast<const triton::uint8*>(name), std::strlen(name) + 1);
+        triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(ARGV_ADDRESS, size, ARGV0_ADDRESS));
+        triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(ARGV_ADDRESS + size, size, ARGV1_ADDRESS));
+        triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(ARGV_ADDRESS + size * 2, size, 0));
+
+        switch (this->arch) {
+          /* System V - main(argc, argv) in rdi and rsi */
+          case triton::arch::ARCH_X86_64: {
+            triton::uint64 stack = triton::engines::exploration::STACK_BASE - QWORD_SIZE;
+            triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(stack, QWORD_SIZE, EXIT_ADDRESS));
+            setRegister(TRITON_X86_REG_RDI, 2);
+            setRegister(TRITON_X86_REG_RSI, ARGV_ADDRESS);
+            setRegister(TRITON_X86_REG_RSP, stack);
+            setRegister(TRITON_X86_REG_RBP, stack);
+            break;
+          }
+
+          /* cdecl - main(argc, argv) on the stack */
+          case triton::arch::ARCH_X86: {
+            triton::uint64 stack = triton::engines::exploration::STACK_BASE - DWORD_SIZE * 3;
+            triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(stack, DWORD_SIZE, EXIT_ADDRESS));
+            triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(stack + DWORD_SIZE, DWORD_SIZE, 2));
+            triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(stack + DWORD_SIZE * 2, DWORD_SIZE, ARGV_ADDRESS));
+            setRegister(TRITON_X86_REG_ESP, stack);
+            setRegister(TRITON_X86_REG_EBP, stack);
+            break;
+          }
+
+          default:
+            throw triton::exceptions::ExplorationEngine("ExplorationEngine::initContext(): Invalid architecture.");
+        }
+
+        /* Symbolize the input */
+        for (auto it = input.begin(); it != input.end(); it++) {
+          triton::api.setConcreteMemoryValue(it->first, it->second);
+          triton::api.convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(it->first, BYTE_SIZE));
+        }
+
+        if (this->setup)
+          this->setup(input);
+      }
+
+
+      void ExplorationEngine::emulate(result_t& result) {
+        triton::arch::Register pcReg = TRITON_X86_REG_PC.getParent();
+        triton::uint64 pc            = this->entry;
+        triton::usize count          = 0;
+
+        for (; count < this->maxInstructions && pc != triton::engines::exploration::EXIT_ADDRESS; count++) {
+          if (!triton::api.isMemoryMapped(pc) && !triton::api.isSummarized(pc)) {
+            result.crashed = true;
+            break;
+          }
+
+          std::vector<triton::uint8> opcodes = triton::api.getConcreteMemoryAreaValue(pc, OPCODES_SIZE, false);
+          triton::arch::Instruction inst;
+          inst.setOpcodes(opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+          inst.setAddress(pc);
+
+          try {
+            triton::api.processing(inst);
+          }
+          catch (const triton::exceptions::Exception&) {
+            /* Unsupported instruction, the path stops here */
+            result.stats["errors"]++;
+            break;
+          }
+
+          triton::uint64 next = triton::api.getConcreteRegisterValue(pcReg, false).convert_to<triton::uint64>();
+
+          result.coverage.insert(pc);
+          if (inst.isControlFlow())
+            result.branches.insert(std::make_pair(pc, next));
+
+          pc = next;
+        }
+
+        result.stats["instructions"] += count;
+      }
+
+
+      void ExplorationEngine::expand(const item_t& item, result_t& result) {
+        const std::vector<triton::engines::symbolic::PathConstraint>& constraints = triton::api.getPathConstraints();
+
+        for (triton::usize index = item.bound; index < constraints.size(); index++) {
+          const triton::engines::symbolic::PathConstraint& pco = constraints[index];
+
+          if (pco.isMultipleBranches()) {
+            /* The prefixes share their sub-conjunctions */
+            triton::ast::AbstractNode* prefix = triton::api.getPathConstraintsPrefixAst(index);
+            const auto& branches = pco.getBranchConstraints();
+
+            for (auto it = branches.begin(); it != branches.end(); it++) {
+              if (std::get<0>(*it))
+                continue;
+
+              triton::engines::solver::status_e status;
+
+              auto start = std::chrono::steady_clock::now();
+              auto model = triton::api.getModel(triton::ast::assert_(triton::ast::land(prefix, std::get<3>(*it))), &status);
+              auto end   = std::chrono::steady_clock::now();
+
+              result.stats["solver_queries"]++;
+              result.stats["solver_time_ms"] += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+              /* A timeout does not prove that the branch is infeasible */
+              if (status != triton::engines::solver::SAT && status != triton::engines::solver::UNSAT) {
+                result.stats["solver_unknown"]++;
+                continue;
+              }
+
+              /* A SAT branch may have an empty model when it does not depend on the input */
+              if (status == triton::engines::solver::UNSAT) {
+                result.stats["solver_unsat"]++;
+                continue;
+              }
+              result.stats["solver_sat"]++;
+
+              /* The child is the parent patched with the model */
+              item_t child;
+              child.input  = item.input;
+              child.bound  = index + 1;
+              child.target = std::get<2>(*it);
+
+              for (auto m = model.begin(); m != model.end(); m++) {
+                triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromId(m->first);
+                child.input[symVar->getKindValue()] = m->second.getValue().convert_to<triton::uint8>();
+              }
+
+              result.children.push_back(child);
+            }
+          }
+        }
+      }
+
+
+      void ExplorationEngine::run(const item_t& item, result_t& result) {
+        triton::api.setArchitecture(this->arch);
+        triton::api.clearArchitecture();
+        triton::api.enableSymbolicOptimization(triton::engines::symbolic::PC_TRACKING_SYMBOLIC, true);
+
+        this->load();
+        this->initContext(item.input);
+        this->emulate(result);
+
+        /* The path is the sequence of the symbolic branches taken */
+        const std::vector<triton::engines::symbolic::PathConstraint>& constraints = triton::api.getPathConstraints();
+        triton::usize hash = FNV_OFFSET;
+
+        for (auto it = constraints.begin(); it != constraints.end(); it++) {
+          for (auto branch = it->getBranchConstraints().begin(); branch != it->getBranchConstraints().end(); branch++) {
+            if (std::get<0>(*branch)) {
+              hashValue(hash, std::get<1>(*branch));
+              hashValue(hash, std::get<2>(*branch));
+            }
+          }
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          if (!this->pathHashes.insert(hash).second) {
+            this->stats["duplicated_paths"]++;
+            return;
+          }
+          this->stats["paths"]++;
+        }
+
+        this->expand(item, result);
+      }
+
+
+      void ExplorationEngine::merge(const item_t& item, const result_t& result) {
+        this->inputs.push_back(item.input);
+
+        if (result.crashed) {
+          this->crashes.push_back(item.input);
+          this->stats["crashes"]++;
+        }
+
+        this->coverage.insert(result.coverage.begin(), result.coverage.end());
+        this->branches.insert(result.branches.begin(), result.branches.end());
+
+        for (auto it = result.stats.begin(); it != result.stats.end(); it++)
+          this->stats[it->first] += it->second;
+
+        for (auto it = result.children.begin(); it != result.children.end(); it++)
+          this->push(*it);
+      }
+
+
+      void ExplorationEngine::worker(void) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+
+        while (true) {
+          /* Wait for an input, or for the end of the runs which may still produce some */
+          this->condition.wait(lock, [this] {
+            return !this->worklist.empty() || this->running == 0 || this->iterations >= this->maxIterations;
+          });
+
+          if (this->worklist.empty() || this->iterations >= this->maxIterations)
+            break;
+
+          item_t item = this->pop();
+          this->iterations++;
+          this->running++;
+          lock.unlock();
+
+          result_t result;
+          result.crashed = false;
+
+          try {
+            this->run(item, result);
+          }
+          /* An error must not escape the thread (z3::exception, std::bad_alloc, ...), the run is dropped */
+          catch (const std::exception&) {
+            result.stats["errors"]++;
+          }
+          catch (...) {
+            result.stats["errors"]++;
+          }
+
+          lock.lock();
+          this->merge(item, result);
+          this->running--;
+          this->condition.notify_all();
+        }
+
+        this->condition.notify_all();
+      }
+
+
+      void ExplorationEngine::setEntryPoint(triton::uint64 addr) {
+        this->entry = addr;
+      }
+
+
+      bool ExplorationEngine::setEntryPoint(const std::string& symbol) {
+        const std::vector<triton::format::elf::ElfSymbolTable>& symbols = this->binary.getSymbolsTable();
+
+        for (auto it = symbols.begin(); it != symbols.end(); it++) {
+          if (it->getName() == symbol && it->getShndx() != triton::format::elf::SHN_UNDEF && it->getValue() != 0) {
+            this->entry = it->getValue();
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      void ExplorationEngine::setStrategy(triton::engines::exploration::strategy_e strategy) {
+        this->strategy = strategy;
+      }
+
+
+      void ExplorationEngine::setSetup(triton::engines::exploration::setup_t setup) {
+        this->setup = setup;
+      }
+
+
+      void ExplorationEngine::setWorkers(triton::usize workers) {
+        if (workers == 0)
+          throw triton::exceptions::ExplorationEngine("ExplorationEngine::setWorkers(): At least one worker is needed.");
+        this->workers = workers;
+      }
+
+
+      void ExplorationEngine::setMaxIterations(triton::usize limit) {
+        this->maxIterations = limit;
+      }
+
+
+      void ExplorationEngine::setMaxInstructions(triton::usize limit) {
+        this->maxInstructions = limit;
+      }
+
+
+      void ExplorationEngine::addSeed(const triton::engines::exploration::input_t& input) {
+        item_t item;
+
+        item.input  = input;
+        item.bound  = 0;
+        item.target = this->entry;
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->push(item);
+      }
+
+
+      void ExplorationEngine::addArgumentSeed(triton::usize size, triton::uint8 value) {
+        triton::engines::exploration::input_t input;
+
+        /* The null byte stays concrete */
+        for (triton::usize index = 0; index < size; index++)
+          input[ARGV1_ADDRESS + index] = value;
+
+        this->addSeed(input);
+      }
+
+
+      void ExplorationEngine::explore(void) {
+        if (this->worklist.empty() && this->iterations == 0)
+          this->addArgumentSeed(8);
+
+        #if defined(TRITON_THREAD_LOCAL_API)
+          /* The calling thread is the first worker */
+          std::vector<std::thread> threads;
+          for (triton::usize index = 1; index < this->workers; index++)
+            threads.push_back(std::thread(&ExplorationEngine::worker, this));
+
+          this->worker();
+
+          for (auto& thread : threads)
+            thread.join();
+        #else
+          /* The API is shared, the runs cannot be parallelized */
+          this->worker();
+        #endif
+      }
+
+
+      const std::vector<triton::engines::exploration::input_t>& ExplorationEngine::getInputs(void) const {
+        return this->inputs;
+      }
+
+
+      const std::vector<triton::engines::exploration::input_t>& ExplorationEngine::getCrashes(void) const {
+        return this->crashes;
+      }
+
+
+      const std::set<triton::uint64>& ExplorationEngine::getCoverage(void) const {
+        return this->coverage;
+      }
+
+
+      std::map<std::string, triton::usize> ExplorationEngine::getStats(void) const {
+        std::map<std::string, triton::usize> stats = this->stats;
+
+        stats["iterations"]           = this->iterations;
+        stats["inputs"]               = this->inputs.size();
+        stats["covered_instructions"] = this->coverage.size();
+        stats["covered_branches"]     = this->branches.size();
+
+        return stats;
+      }
+
+    };
+  };
+};
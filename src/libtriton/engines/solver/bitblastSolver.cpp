@@ -0,0 +1,708 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <chrono>
+#include <utility>
+
+#include <api.hpp>
+#include <bitblastSolver.hpp>
+#include <exceptions.hpp>
+#include <solverEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The operators of the gates */
+      enum gate_e {
+        GATE_AND = 0,
+        GATE_XOR,
+        GATE_ITE,
+      };
+
+
+      /* Returns the value of a decimal node */
+      static triton::uint32 decimal(triton::ast::AbstractNode* node) {
+        return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue().convert_to<triton::uint32>();
+      }
+
+
+      Bitblaster::Bitblaster(triton::engines::solver::SatSolver& sat)
+        : sat(sat) {
+        this->trueLit = this->newLiteral();
+        this->sat.addClause({this->trueLit});
+      }
+
+
+      triton::uint32 Bitblaster::getTrue(void) const {
+        return this->trueLit;
+      }
+
+
+      const std::map<triton::usize, std::vector<triton::uint32>>& Bitblaster::getVariables(void) const {
+        return this->variables;
+      }
+
+
+      triton::uint32 Bitblaster::newLiteral(void) {
+        return this->sat.newVariable() << 1;
+      }
+
+
+      triton::uint32 Bitblaster::mkAnd(triton::uint32 a, triton::uint32 b) {
+        triton::uint32 f = this->trueLit ^ 1;
+
+        if (a == f || b == f || a == (b ^ 1))
+          return f;
+        if (a == this->trueLit || a == b)
+          return b;
+        if (b == this->trueLit)
+          return a;
+        if (a > b)
+          std::swap(a, b);
+
+        auto key = std::make_tuple(static_cast<triton::uint32>(GATE_AND), a, b, 0u);
+        auto it  = this->gates.find(key);
+        if (it != this->gates.end())
+          return it->second;
+
+        triton::uint32 o = this->newLiteral();
+        this->sat.addClause({o ^ 1, a});
+        this->sat.addClause({o ^ 1, b});
+        this->sat.addClause({o, a ^ 1, b ^ 1});
+
+        this->gates[key] = o;
+        return o;
+      }
+
+
+      triton::uint32 Bitblaster::mkOr(triton::uint32 a, triton::uint32 b) {
+        return this->mkAnd(a ^ 1, b ^ 1) ^ 1;
+      }
+
+
+      triton::uint32 Bitblaster::mkXor(triton::uint32 a, triton::uint32 b) {
+        triton::uint32 f = this->trueLit ^ 1;
+
+        if (a == f)               return b;
+        if (b == f)               return a;
+        if (a == this->trueLit)   return b ^ 1;
+        if (b == this->trueLit)   return a ^ 1;
+        if (a == b)               return f;
+        if (a == (b ^ 1))         return this->trueLit;
+
+        /* The gate is shared between the polarities of its inputs */
+        triton::uint32 sign = (a ^ b) & 1;
+        a &= ~1u;
+        b &= ~1u;
+        if (a > b)
+          std::swap(a, b);
+
+        auto key = std::make_tuple(static_cast<triton::uint32>(GATE_XOR), a, b, 0u);
+        auto it  = this->gates.find(key);
+        if (it != this->gates.end())
+          return it->second ^ sign;
+
+        triton::uint32 o = this->newLiteral();
+        this->sat.addClause({o ^ 1, a, b});
+        this->sat.addClause({o ^ 1, a ^ 1, b ^ 1});
+        this->sat.addClause({o, a ^ 1, b});
+        this->sat.addClause({o, a, b ^ 1});
+
+        this->gates[key] = o;
+        return o ^ sign;
+      }
+
+
+      triton::uint32 Bitblaster::mkIte(triton::uint32 c, triton::uint32 t, triton::uint32 e) {
+        triton::uint32 f = this->trueLit ^ 1;
+
+        if (c == this->trueLit || t == e) return t;
+        if (c == f)                       return e;
+        if (t == (e ^ 1))                 return this->mkXor(c, e);
+        if (t == this->trueLit)           return this->mkOr(c, e);
+        if (t == f)                       return this->mkAnd(c ^ 1, e);
+        if (e == this->trueLit)           return this->mkOr(c ^ 1, t);
+        if (e == f)                       return this->mkAnd(c, t);
+
+        if (c & 1) {
+          c ^= 1;
+          std::swap(t, e);
+        }
+
+        auto key = std::make_tuple(static_cast<triton::uint32>(GATE_ITE), c, t, e);
+        auto it  = this->gates.find(key);
+        if (it != this->gates.end())
+          return it->second;
+
+        triton::uint32 o = this->newLiteral();
+        this->sat.addClause({c ^ 1, t ^ 1, o});
+        this->sat.addClause({c ^ 1, t, o ^ 1});
+        this->sat.addClause({c, e ^ 1, o});
+        this->sat.addClause({c, e, o ^ 1});
+        /* Redundant, but they help the propagation */
+        this->sat.addClause({t ^ 1, e ^ 1, o});
+        this->sat.addClause({t, e, o ^ 1});
+
+        this->gates[key] = o;
+        return o;
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::constant(const triton::uint512& value, triton::uint32 size) const {
+        std::vector<triton::uint32> bits(size);
+
+        for (triton::uint32 i = 0; i < size; i++)
+          bits[i] = (((value >> i) & 1) != 0) ? this->trueLit : (this->trueLit ^ 1);
+
+        return bits;
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::add(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b, triton::uint32 carry) {
+        std::vector<triton::uint32> bits(a.size());
+
+        for (triton::usize i = 0; i < a.size(); i++) {
+          triton::uint32 x = this->mkXor(a[i], b[i]);
+          bits[i] = this->mkXor(x, carry);
+          carry   = this->mkOr(this->mkAnd(a[i], b[i]), this->mkAnd(carry, x));
+        }
+
+        return bits;
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::bvnot(const std::vector<triton::uint32>& a) const {
+        std::vector<triton::uint32> bits(a.size());
+
+        for (triton::usize i = 0; i < a.size(); i++)
+          bits[i] = a[i] ^ 1;
+
+        return bits;
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::neg(const std::vector<triton::uint32>& a) {
+        return this->add(this->bvnot(a), std::vector<triton::uint32>(a.size(), this->trueLit ^ 1), this->trueLit);
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::mul(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b) {
+        std::vector<triton::uint32> bits(a.size(), this->trueLit ^ 1);
+
+        /* Shift and add, the partial products above the size are dropped */
+        for (triton::usize i = 0; i < b.size(); i++) {
+          if (b[i] == (this->trueLit ^ 1))
+            continue;
+
+          std::vector<triton::uint32> partial(a.size(), this->trueLit ^ 1);
+          for (triton::usize j = i; j < a.size(); j++)
+            partial[j] = this->mkAnd(a[j - i], b[i]);
+
+          bits = this->add(bits, partial, this->trueLit ^ 1);
+        }
+
+        return bits;
+      }
+
+
+      void Bitblaster::udivrem(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b, std::vector<triton::uint32>& quotient, std::vector<triton::uint32>& remainder) {
+        triton::usize size = a.size();
+        std::vector<triton::uint32> divisor(b);
+        std::vector<triton::uint32> rem(size, this->trueLit ^ 1);
+
+        /* The partial remainder is shifted on one more bit */
+        divisor.push_back(this->trueLit ^ 1);
+        quotient.assign(size, this->trueLit ^ 1);
+
+        /* Restoring division, a zero divisor gives all ones and the dividend */
+        for (triton::usize i = size; i-- > 0;) {
+          std::vector<triton::uint32> shifted(1, a[i]);
+          shifted.insert(shifted.end(), rem.begin(), rem.end());
+
+          triton::uint32 ge = this->ult(shifted, divisor) ^ 1;
+          std::vector<triton::uint32> diff = this->add(shifted, this->bvnot(divisor), this->trueLit);
+
+          quotient[i] = ge;
+          shifted = this->ite(ge, diff, shifted);
+          rem.assign(shifted.begin(), shifted.begin() + size);
+        }
+
+        remainder = rem;
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::ite(triton::uint32 c, const std::vector<triton::uint32>& t, const std::vector<triton::uint32>& e) {
+        std::vector<triton::uint32> bits(t.size());
+
+        for (triton::usize i = 0; i < t.size(); i++)
+          bits[i] = this->mkIte(c, t[i], e[i]);
+
+        return bits;
+      }
+
+
+      triton::uint32 Bitblaster::equal(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b) {
+        triton::uint32 result = this->trueLit;
+
+        for (triton::usize i = 0; i < a.size(); i++)
+          result = this->mkAnd(result, this->mkXor(a[i], b[i]) ^ 1);
+
+        return result;
+      }
+
+
+      triton::uint32 Bitblaster::ult(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b) {
+        triton::uint32 result = this->trueLit ^ 1;
+
+        /* The most significant different bit decides */
+        for (triton::usize i = 0; i < a.size(); i++)
+          result = this->mkIte(this->mkXor(a[i], b[i]), b[i], result);
+
+        return result;
+      }
+
+
+      triton::uint32 Bitblaster::slt(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b) {
+        std::vector<triton::uint32> x(a);
+        std::vector<triton::uint32> y(b);
+
+        /* Flipping the sign bits turns a signed comparison into an unsigned one */
+        x.back() ^= 1;
+        y.back() ^= 1;
+
+        return this->ult(x, y);
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::shift(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b, triton::ast::kind_e kind) {
+        triton::usize size              = a.size();
+        triton::uint32 fill             = (kind == triton::ast::BVASHR_NODE) ? a.back() : (this->trueLit ^ 1);
+        triton::uint32 overflow         = this->trueLit ^ 1;
+        std::vector<triton::uint32> bits(a);
+
+        /* Barrel shifter, the amount bits above the size only select the fill */
+        for (triton::usize k = 0; k < b.size(); k++) {
+          if (k >= 32 || (static_cast<triton::usize>(1) << k) >= size) {
+            overflow = this->mkOr(overflow, b[k]);
+            continue;
+          }
+
+          triton::usize amount = static_cast<triton::usize>(1) << k;
+          std::vector<triton::uint32> shifted(size);
+
+          for (triton::usize i = 0; i < size; i++) {
+            if (kind == triton::ast::BVSHL_NODE)
+              shifted[i] = (i >= amount) ? bits[i - amount] : fill;
+            else
+              shifted[i] = (i + amount < size) ? bits[i + amount] : fill;
+          }
+
+          bits = this->ite(b[k], shifted, bits);
+        }
+
+        return this->ite(overflow, std::vector<triton::uint32>(size, fill), bits);
+      }
+
+
+      std::vector<triton::ast::AbstractNode*> Bitblaster::getOperands(triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*> operands;
+
+        switch (node->getKind()) {
+          case triton::ast::REFERENCE_NODE: {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            triton::engines::symbolic::SymbolicExpression* expr = triton::api.getSymbolicExpressionFromId(id);
+            if (expr == nullptr)
+              throw triton::exceptions::SolverEngine("Bitblaster::getOperands(): Reference node not found.");
+            operands.push_back(expr->getAst());
+            return operands;
+          }
+
+          case triton::ast::ASSERT_NODE:
+            break;
+
+          default:
+            /* A concrete node is encoded as a constant */
+            if (!node->isSymbolized())
+              return operands;
+            break;
+        }
+
+        for (triton::ast::AbstractNode* child : node->getChilds()) {
+          if (child->getKind() != triton::ast::DECIMAL_NODE)
+            operands.push_back(child);
+        }
+
+        return operands;
+      }
+
+
+      std::vector<triton::uint32> Bitblaster::encode(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        std::vector<triton::uint32> quotient;
+        std::vector<triton::uint32> remainder;
+        triton::ast::kind_e kind = node->getKind();
+
+        /* The operands have already been encoded */
+        auto op = [&](triton::usize index) -> const std::vector<triton::uint32>& {
+          return this->nodes[childs[index]];
+        };
+
+        switch (kind) {
+          case triton::ast::ASSERT_NODE:
+            return op(0);
+
+          case triton::ast::REFERENCE_NODE: {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            return this->nodes[triton::api.getSymbolicExpressionFromId(id)->getAst()];
+          }
+
+          case triton::ast::DECIMAL_NODE:
+          case triton::ast::STRING_NODE:
+          case triton::ast::ARRAY_NODE:
+          case triton::ast::SELECT_NODE:
+          case triton::ast::STORE_NODE:
+          case triton::ast::LET_NODE:
+          case triton::ast::BVDECL_NODE:
+          case triton::ast::COMPOUND_NODE:
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::FUNCTION_NODE:
+          case triton::ast::PARAM_NODE:
+          case triton::ast::UNDEFINED_NODE:
+            throw triton::exceptions::SolverEngine("Bitblaster::encode(): Unsupported node, use the Z3 backend.");
+
+          default:
+            break;
+        }
+
+        if (!node->isSymbolized())
+          return this->constant(node->evaluate(), node->getBitvectorSize());
+
+        switch (kind) {
+          case triton::ast::VARIABLE_NODE: {
+            std::string name = reinterpret_cast<triton::ast::VariableNode*>(node)->getValue();
+            triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(name);
+            if (symVar == nullptr)
+              throw triton::exceptions::SolverEngine("Bitblaster::encode(): Can't get the symbolic variable (nullptr).");
+
+            /* The same variable may be held by several nodes */
+            std::vector<triton::uint32>& bits = this->variables[symVar->getId()];
+            if (bits.empty()) {
+              for (triton::uint32 i = 0; i < symVar->getSize(); i++)
+                bits.push_back(this->newLiteral());
+            }
+            return bits;
+          }
+
+          case triton::ast::BVADD_NODE:
+            return this->add(op(0), op(1), this->trueLit ^ 1);
+
+          case triton::ast::BVSUB_NODE:
+            return this->add(op(0), this->bvnot(op(1)), this->trueLit);
+
+          case triton::ast::BVNEG_NODE:
+            return this->neg(op(0));
+
+          case triton::ast::BVMUL_NODE:
+            return this->mul(op(0), op(1));
+
+          case triton::ast::BVNOT_NODE:
+            return this->bvnot(op(0));
+
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVXNOR_NODE: {
+            const std::vector<triton::uint32>& a = op(0);
+            const std::vector<triton::uint32>& b = op(1);
+            std::vector<triton::uint32> bits(a.size());
+            for (triton::usize i = 0; i < a.size(); i++) {
+              switch (kind) {
+                case triton::ast::BVAND_NODE:  bits[i] = this->mkAnd(a[i], b[i]);     break;
+                case triton::ast::BVOR_NODE:   bits[i] = this->mkOr(a[i], b[i]);      break;
+                case triton::ast::BVXOR_NODE:  bits[i] = this->mkXor(a[i], b[i]);     break;
+                case triton::ast::BVNAND_NODE: bits[i] = this->mkAnd(a[i], b[i]) ^ 1; break;
+                case triton::ast::BVNOR_NODE:  bits[i] = this->mkOr(a[i], b[i]) ^ 1;  break;
+                default:                       bits[i] = this->mkXor(a[i], b[i]) ^ 1; break;
+              }
+            }
+            return bits;
+          }
+
+          case triton::ast::BVUDIV_NODE:
+            this->udivrem(op(0), op(1), quotient, remainder);
+            return quotient;
+
+          case triton::ast::BVUREM_NODE:
+            this->udivrem(op(0), op(1), quotient, remainder);
+            return remainder;
+
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSMOD_NODE: {
+            const std::vector<triton::uint32>& a = op(0);
+            const std::vector<triton::uint32>& b = op(1);
+            triton::uint32 signA = a.back();
+            triton::uint32 signB = b.back();
+
+            /* The SMT-LIB definitions on the absolute values */
+            this->udivrem(this->ite(signA, this->neg(a), a), this->ite(signB, this->neg(b), b), quotient, remainder);
+
+            if (kind == triton::ast::BVSDIV_NODE)
+              return this->ite(this->mkXor(signA, signB), this->neg(quotient), quotient);
+
+            std::vector<triton::uint32> srem = this->ite(signA, this->neg(remainder), remainder);
+            if (kind == triton::ast::BVSREM_NODE)
+              return srem;
+
+            triton::uint32 zero = this->equal(remainder, this->constant(0, static_cast<triton::uint32>(a.size())));
+            return this->ite(zero, remainder, this->ite(this->mkXor(signA, signB), this->add(srem, b, this->trueLit ^ 1), srem));
+          }
+
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVASHR_NODE:
+            return this->shift(op(0), op(1), kind);
+
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE: {
+            const std::vector<triton::uint32>& a = op(1);
+            triton::usize size   = a.size();
+            triton::usize amount = decimal(childs[0]) % size;
+            std::vector<triton::uint32> bits(size);
+            for (triton::usize i = 0; i < size; i++) {
+              if (kind == triton::ast::BVROL_NODE)
+                bits[i] = a[(i + size - amount) % size];
+              else
+                bits[i] = a[(i + amount) % size];
+            }
+            return bits;
+          }
+
+          case triton::ast::BVUGE_NODE: return {this->ult(op(0), op(1)) ^ 1};
+          case triton::ast::BVUGT_NODE: return {this->ult(op(1), op(0))};
+          case triton::ast::BVULE_NODE: return {this->ult(op(1), op(0)) ^ 1};
+          case triton::ast::BVULT_NODE: return {this->ult(op(0), op(1))};
+          case triton::ast::BVSGE_NODE: return {this->slt(op(0), op(1)) ^ 1};
+          case triton::ast::BVSGT_NODE: return {this->slt(op(1), op(0))};
+          case triton::ast::BVSLE_NODE: return {this->slt(op(1), op(0)) ^ 1};
+          case triton::ast::BVSLT_NODE: return {this->slt(op(0), op(1))};
+
+          case triton::ast::EQUAL_NODE:
+            return {this->equal(op(0), op(1))};
+
+          case triton::ast::DISTINCT_NODE:
+            return {this->equal(op(0), op(1)) ^ 1};
+
+          case triton::ast::CONCAT_NODE: {
+            /* The first child holds the most significant bits */
+            std::vector<triton::uint32> bits;
+            for (triton::usize i = childs.size(); i-- > 0;)
+              bits.insert(bits.end(), op(i).begin(), op(i).end());
+            return bits;
+          }
+
+          case triton::ast::EXTRACT_NODE: {
+            const std::vector<triton::uint32>& a = op(2);
+            return std::vector<triton::uint32>(a.begin() + decimal(childs[1]), a.begin() + decimal(childs[0]) + 1);
+          }
+
+          case triton::ast::ZX_NODE:
+          case triton::ast::SX_NODE: {
+            std::vector<triton::uint32> bits(op(1));
+            triton::uint32 fill = (kind == triton::ast::SX_NODE) ? bits.back() : (this->trueLit ^ 1);
+            bits.insert(bits.end(), decimal(childs[0]), fill);
+            return bits;
+          }
+
+          case triton::ast::ITE_NODE:
+            return this->ite(op(0)[0], op(1), op(2));
+
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE: {
+            triton::uint32 result = (kind == triton::ast::LAND_NODE) ? this->trueLit : (this->trueLit ^ 1);
+            for (triton::usize i = 0; i < childs.size(); i++)
+              result = (kind == triton::ast::LAND_NODE) ? this->mkAnd(result, op(i)[0]) : this->mkOr(result, op(i)[0]);
+            return {result};
+          }
+
+          case triton::ast::LNOT_NODE:
+            return {op(0)[0] ^ 1};
+
+          default:
+            throw triton::exceptions::SolverEngine("Bitblaster::encode(): Unsupported node, use the Z3 backend.");
+        }
+      }
+
+
+      const std::vector<triton::uint32>& Bitblaster::blast(triton::ast::AbstractNode* node) {
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Bitblaster::blast(): node cannot be null.");
+
+        /* Iterative post-order, a node is encoded once all its operands are */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          std::pair<triton::ast::AbstractNode*, bool> item = worklist.back();
+          worklist.pop_back();
+
+          if (this->nodes.find(item.first) != this->nodes.end())
+            continue;
+
+          if (item.second) {
+            std::vector<triton::uint32> bits = this->encode(item.first);
+            this->nodes[item.first] = std::move(bits);
+            continue;
+          }
+
+          worklist.push_back(std::make_pair(item.first, true));
+          for (triton::ast::AbstractNode* operand : this->getOperands(item.first)) {
+            if (this->nodes.find(operand) == this->nodes.end())
+              worklist.push_back(std::make_pair(operand, false));
+          }
+        }
+
+        return this->nodes[node];
+      }
+
+
+      std::set<std::atomic<bool>*> BitblastSolver::running;
+      std::mutex BitblastSolver::mutex;
+
+
+      BitblastSolver::BitblastSolver(const triton::engines::solver::SolverEngine& engine)
+        : engine(engine) {
+      }
+
+
+      BitblastSolver::~BitblastSolver() {
+      }
+
+
+      std::string BitblastSolver::getName(void) const {
+        return "bitblast";
+      }
+
+
+      triton::uint32 BitblastSolver::getCapabilities(void) const {
+        return (triton::engines::solver::CAPABILITY_INCREMENTAL |
+                triton::engines::solver::CAPABILITY_MODELS |
+                triton::engines::solver::CAPABILITY_TIMEOUT |
+                triton::engines::solver::CAPABILITY_INTERRUPT);
+      }
+
+
+      triton::usize BitblastSolver::enumerateModels(triton::ast::AbstractNode* node, const std::vector<triton::usize>& variables, triton::uint32 limit, triton::engines::solver::modelCallback callback, void* data, triton::engines::solver::status_e& status, triton::uint32 timeout) const {
+        std::vector<std::pair<triton::engines::symbolic::SymbolicVariable*, const std::vector<triton::uint32>*>> projection;
+        triton::engines::solver::SatSolver sat;
+        triton::engines::solver::Bitblaster blaster(sat);
+        std::atomic<bool> canceled(false);
+        triton::usize count = 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("BitblastSolver::enumerateModels(): node cannot be null.");
+
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("BitblastSolver::enumerateModels(): callback cannot be null.");
+
+        status = triton::engines::solver::UNKNOWN;
+
+        /* The timeout bounds the whole enumeration, encoding included */
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+        /* The query may now be interrupted */
+        {
+          std::lock_guard<std::mutex> lock(BitblastSolver::mutex);
+          BitblastSolver::running.insert(&canceled);
+        }
+
+        try {
+          const std::vector<triton::uint32>& root = blaster.blast(node);
+          if (root.size() != 1)
+            throw triton::exceptions::SolverEngine("BitblastSolver::enumerateModels(): The constraint must be a logical node.");
+
+          sat.addClause({root[0]});
+
+          /* The projection, the variables which do not appear in the constraint are ignored */
+          const std::map<triton::usize, std::vector<triton::uint32>>& encoded = blaster.getVariables();
+          for (triton::usize id : (variables.empty() ? node->getVariables() : variables)) {
+            auto it = encoded.find(id);
+            if (it != encoded.end())
+              projection.push_back(std::make_pair(triton::api.getSymbolicVariableFromId(id), &it->second));
+          }
+
+          while (limit == 0 || count < limit) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            status = sat.solve(timeout ? &deadline : nullptr, &canceled);
+
+            triton::usize elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            this->engine.record(status, elapsed);
+
+            if (status != triton::engines::solver::SAT)
+              break;
+
+            /* A constraint without variable has no model to enumerate */
+            if (projection.empty())
+              break;
+
+            /* Read the model and block it */
+            std::map<triton::uint32, SolverModel> model;
+            std::vector<triton::uint32> blocking;
+
+            for (auto it = projection.begin(); it != projection.end(); it++) {
+              const std::vector<triton::uint32>& bits = *it->second;
+              triton::uint512 value = 0;
+
+              for (triton::usize i = 0; i < bits.size(); i++) {
+                bool bit = (sat.getValue(bits[i] >> 1) != static_cast<bool>(bits[i] & 1));
+                if (bit)
+                  value |= (triton::uint512(1) << i);
+                blocking.push_back(bit ? (bits[i] ^ 1) : bits[i]);
+              }
+
+              triton::uint32 id = static_cast<triton::uint32>(it->first->getId());
+              model[id] = SolverModel(id, it->first->getName(), value);
+            }
+
+            count++;
+            if (!callback(model, data))
+              break;
+
+            sat.addClause(blocking);
+          }
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lock(BitblastSolver::mutex);
+          BitblastSolver::running.erase(&canceled);
+          throw;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(BitblastSolver::mutex);
+          BitblastSolver::running.erase(&canceled);
+        }
+
+        return count;
+      }
+
+
+      void BitblastSolver::interrupt(void) {
+        std::lock_guard<std::mutex> lock(BitblastSolver::mutex);
+
+        for (std::set<std::atomic<bool>*>::iterator it = BitblastSolver::running.begin(); it != BitblastSolver::running.end(); it++)
+          (*it)->store(true);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,436 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <satSolver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The number of conflicts between two restarts is 100 times the Luby sequence (1 1 2 1 1 2 4 ...) */
+      static triton::usize luby(triton::usize index) {
+        triton::usize size = 1;
+        triton::usize seq  = 0;
+
+        while (size < index + 1) {
+          seq++;
+          size = 2 * size + 1;
+        }
+
+        while (size - 1 != index) {
+          size = (size - 1) >> 1;
+          seq--;
+          index = index % size;
+        }
+
+        return static_cast<triton::usize>(1) << seq;
+      }
+
+
+      const triton::uint8 SatSolver::UNDEF;
+      const triton::uint32 SatSolver::NO_REASON;
+
+
+      SatSolver::SatSolver() {
+        this->ok        = true;
+        this->head      = 0;
+        this->increment = 1.0;
+      }
+
+
+      triton::uint32 SatSolver::newVariable(void) {
+        triton::uint32 var = static_cast<triton::uint32>(this->values.size());
+
+        this->values.push_back(UNDEF);
+        this->phases.push_back(0);
+        this->levels.push_back(0);
+        this->reasons.push_back(NO_REASON);
+        this->activities.push_back(0.0);
+        this->seen.push_back(0);
+        this->positions.push_back(-1);
+        this->watches.push_back(std::vector<triton::uint32>());
+        this->watches.push_back(std::vector<triton::uint32>());
+        this->heapInsert(var);
+
+        return var;
+      }
+
+
+      triton::uint32 SatSolver::getNumberOfVariables(void) const {
+        return static_cast<triton::uint32>(this->values.size());
+      }
+
+
+      triton::usize SatSolver::getNumberOfClauses(void) const {
+        return this->clauses.size();
+      }
+
+
+      triton::uint8 SatSolver::valueOf(triton::uint32 lit) const {
+        triton::uint8 value = this->values[lit >> 1];
+
+        if (value == UNDEF)
+          return UNDEF;
+
+        return value ^ (lit & 1);
+      }
+
+
+      triton::uint32 SatSolver::decisionLevel(void) const {
+        return static_cast<triton::uint32>(this->trailLimits.size());
+      }
+
+
+      void SatSolver::enqueue(triton::uint32 lit, triton::uint32 reason) {
+        triton::uint32 var = lit >> 1;
+
+        this->values[var]  = (lit & 1) ? 0 : 1;
+        this->levels[var]  = this->decisionLevel();
+        this->reasons[var] = reason;
+        this->trail.push_back(lit);
+      }
+
+
+      triton::uint32 SatSolver::attach(const std::vector<triton::uint32>& clause) {
+        triton::uint32 index = static_cast<triton::uint32>(this->clauses.size());
+
+        this->clauses.push_back(clause);
+        this->watches[clause[0]].push_back(index);
+        this->watches[clause[1]].push_back(index);
+
+        return index;
+      }
+
+
+      bool SatSolver::addClause(std::vector<triton::uint32> clause) {
+        std::vector<triton::uint32> lits;
+        triton::uint32 previous = NO_REASON;
+
+        if (!this->ok)
+          return false;
+
+        /* Clauses are only added at the level 0, between two calls of solve() */
+        std::sort(clause.begin(), clause.end());
+
+        for (triton::uint32 lit : clause) {
+          /* Satisfied or tautology, x and !x are adjacent once sorted */
+          if (this->valueOf(lit) == 1 || lit == (previous ^ 1))
+            return true;
+
+          if (this->valueOf(lit) == UNDEF && lit != previous)
+            lits.push_back(lit);
+
+          previous = lit;
+        }
+
+        if (lits.empty()) {
+          this->ok = false;
+          return false;
+        }
+
+        if (lits.size() == 1)
+          this->enqueue(lits[0], NO_REASON);
+        else
+          this->attach(lits);
+
+        return true;
+      }
+
+
+      triton::uint32 SatSolver::propagate(void) {
+        while (this->head < this->trail.size()) {
+          triton::uint32 falseLit = this->trail[this->head++] ^ 1;
+          std::vector<triton::uint32>& watchers = this->watches[falseLit];
+          triton::usize i = 0;
+          triton::usize j = 0;
+
+          while (i < watchers.size()) {
+            triton::uint32 index = watchers[i++];
+            std::vector<triton::uint32>& clause = this->clauses[index];
+
+            /* The false literal is always the second one */
+            if (clause[0] == falseLit)
+              std::swap(clause[0], clause[1]);
+
+            if (this->valueOf(clause[0]) == 1) {
+              watchers[j++] = index;
+              continue;
+            }
+
+            /* Look for a new literal to watch */
+            bool moved = false;
+            for (triton::usize k = 2; k < clause.size(); k++) {
+              if (this->valueOf(clause[k]) != 0) {
+                std::swap(clause[1], clause[k]);
+                this->watches[clause[1]].push_back(index);
+                moved = true;
+                break;
+              }
+            }
+
+            if (moved)
+              continue;
+
+            /* The clause is unit or conflicting */
+            watchers[j++] = index;
+            if (this->valueOf(clause[0]) == 0) {
+              while (i < watchers.size())
+                watchers[j++] = watchers[i++];
+              watchers.resize(j);
+              this->head = this->trail.size();
+              return index;
+            }
+
+            this->enqueue(clause[0], index);
+          }
+
+          watchers.resize(j);
+        }
+
+        return NO_REASON;
+      }
+
+
+      triton::uint32 SatSolver::analyze(triton::uint32 conflict, std::vector<triton::uint32>& learnt) {
+        triton::usize  index   = this->trail.size();
+        triton::uint32 pending = 0;
+        triton::uint32 lit     = NO_REASON;
+
+        learnt.clear();
+        learnt.push_back(0);
+
+        /* Resolve the literals of the current level until the first UIP */
+        do {
+          const std::vector<triton::uint32>& clause = this->clauses[conflict];
+
+          /* The first literal of a reason is the implied one */
+          for (triton::usize i = (lit == NO_REASON ? 0 : 1); i < clause.size(); i++) {
+            triton::uint32 var = clause[i] >> 1;
+
+            if (this->seen[var] || this->levels[var] == 0)
+              continue;
+
+            this->bump(var);
+            this->seen[var] = 1;
+
+            if (this->levels[var] >= this->decisionLevel())
+              pending++;
+            else
+              learnt.push_back(clause[i]);
+          }
+
+          while (!this->seen[this->trail[--index] >> 1]);
+
+          lit      = this->trail[index];
+          conflict = this->reasons[lit >> 1];
+          this->seen[lit >> 1] = 0;
+          pending--;
+        } while (pending > 0);
+
+        learnt[0] = lit ^ 1;
+
+        /* The second literal has the highest level, it is the level to backtrack to */
+        triton::uint32 level = 0;
+        for (triton::usize i = 1; i < learnt.size(); i++) {
+          this->seen[learnt[i] >> 1] = 0;
+          if (this->levels[learnt[i] >> 1] > level) {
+            level = this->levels[learnt[i] >> 1];
+            std::swap(learnt[1], learnt[i]);
+          }
+        }
+
+        return level;
+      }
+
+
+      void SatSolver::backtrack(triton::uint32 level) {
+        if (this->decisionLevel() <= level)
+          return;
+
+        for (triton::usize i = this->trail.size(); i-- > this->trailLimits[level];) {
+          triton::uint32 var = this->trail[i] >> 1;
+          this->phases[var]  = this->values[var];
+          this->values[var]  = UNDEF;
+          this->reasons[var] = NO_REASON;
+          this->heapInsert(var);
+        }
+
+        this->trail.resize(this->trailLimits[level]);
+        this->trailLimits.resize(level);
+        this->head = this->trail.size();
+      }
+
+
+      void SatSolver::bump(triton::uint32 var) {
+        this->activities[var] += this->increment;
+
+        /* Rescale the activities before an overflow */
+        if (this->activities[var] > 1e100) {
+          for (double& activity : this->activities)
+            activity *= 1e-100;
+          this->increment *= 1e-100;
+        }
+
+        if (this->positions[var] >= 0)
+          this->heapUp(this->positions[var]);
+      }
+
+
+      void SatSolver::heapUp(triton::usize index) {
+        triton::uint32 var = this->heap[index];
+
+        while (index > 0) {
+          triton::usize parent = (index - 1) >> 1;
+          if (this->activities[this->heap[parent]] >= this->activities[var])
+            break;
+          this->heap[index] = this->heap[parent];
+          this->positions[this->heap[index]] = static_cast<triton::sint32>(index);
+          index = parent;
+        }
+
+        this->heap[index] = var;
+        this->positions[var] = static_cast<triton::sint32>(index);
+      }
+
+
+      void SatSolver::heapDown(triton::usize index) {
+        triton::uint32 var = this->heap[index];
+
+        while (true) {
+          triton::usize child = 2 * index + 1;
+          if (child >= this->heap.size())
+            break;
+          if (child + 1 < this->heap.size() && this->activities[this->heap[child + 1]] > this->activities[this->heap[child]])
+            child++;
+          if (this->activities[this->heap[child]] <= this->activities[var])
+            break;
+          this->heap[index] = this->heap[child];
+          this->positions[this->heap[index]] = static_cast<triton::sint32>(index);
+          index = child;
+        }
+
+        this->heap[index] = var;
+        this->positions[var] = static_cast<triton::sint32>(index);
+      }
+
+
+      void SatSolver::heapInsert(triton::uint32 var) {
+        if (this->positions[var] >= 0)
+          return;
+
+        this->positions[var] = static_cast<triton::sint32>(this->heap.size());
+        this->heap.push_back(var);
+        this->heapUp(this->heap.size() - 1);
+      }
+
+
+      triton::uint32 SatSolver::heapPop(void) {
+        triton::uint32 var  = this->heap[0];
+        triton::uint32 last = this->heap.back();
+
+        this->heap.pop_back();
+        this->positions[var] = -1;
+
+        if (!this->heap.empty()) {
+          this->heap[0] = last;
+          this->positions[last] = 0;
+          this->heapDown(0);
+        }
+
+        return var;
+      }
+
+
+      triton::engines::solver::status_e SatSolver::solve(const std::chrono::steady_clock::time_point* deadline, const std::atomic<bool>* canceled) {
+        triton::usize conflicts = 0;
+        triton::usize restarts  = 0;
+        triton::usize steps     = 0;
+        triton::usize budget    = 100 * luby(restarts);
+
+        this->model.clear();
+
+        if (!this->ok)
+          return triton::engines::solver::UNSAT;
+
+        while (true) {
+          /* The limits are checked from time to time */
+          if ((++steps & 0xff) == 0) {
+            if (canceled != nullptr && canceled->load()) {
+              this->backtrack(0);
+              return triton::engines::solver::CANCELED;
+            }
+            if (deadline != nullptr && std::chrono::steady_clock::now() >= *deadline) {
+              this->backtrack(0);
+              return triton::engines::solver::TIMEOUT;
+            }
+          }
+
+          triton::uint32 conflict = this->propagate();
+
+          if (conflict != NO_REASON) {
+            std::vector<triton::uint32> learnt;
+
+            if (this->decisionLevel() == 0) {
+              this->ok = false;
+              return triton::engines::solver::UNSAT;
+            }
+
+            this->backtrack(this->analyze(conflict, learnt));
+
+            if (learnt.size() == 1)
+              this->enqueue(learnt[0], NO_REASON);
+            else
+              this->enqueue(learnt[0], this->attach(learnt));
+
+            this->increment /= 0.95;
+
+            if (++conflicts >= budget) {
+              conflicts = 0;
+              budget = 100 * luby(++restarts);
+              this->backtrack(0);
+            }
+            continue;
+          }
+
+          /* Pick the most active unassigned variable */
+          triton::uint32 var = NO_REASON;
+          while (!this->heap.empty()) {
+            triton::uint32 candidate = this->heapPop();
+            if (this->values[candidate] == UNDEF) {
+              var = candidate;
+              break;
+            }
+          }
+
+          /* All variables are assigned, it is a model */
+          if (var == NO_REASON) {
+            this->model.resize(this->values.size());
+            for (triton::usize i = 0; i < this->values.size(); i++)
+              this->model[i] = (this->values[i] == 1);
+            this->backtrack(0);
+            return triton::engines::solver::SAT;
+          }
+
+          this->trailLimits.push_back(this->trail.size());
+          this->enqueue(this->phases[var] ? (var << 1) : ((var << 1) | 1), NO_REASON);
+        }
+      }
+
+
+      bool SatSolver::getValue(triton::uint32 var) const {
+        if (var >= this->model.size())
+          return false;
+        return this->model[var];
+      }
+
+    };
+  };
+};
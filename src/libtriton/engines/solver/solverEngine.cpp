@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
 #include <api.hpp>
 #include <ast.hpp>
 #include <exceptions.hpp>
@@ -87,6 +89,60 @@ For example, if there are two symbolic variables in your constraint, the triton:
   }
 ~~~~~~~~~~~~~
 
+\section solver_interface_limits Limits
+<hr>
+
+A query may be bounded by a timeout, given to triton::API::getModel() and triton::API::getModels() or set by default with
+triton::API::setSolverTimeout(). The timeout of getModels() bounds the whole enumeration. The memory of the solver may be bounded with
+triton::API::setSolverMemoryLimit(), and the running queries may be interrupted from another thread with triton::API::interruptSolver().
+The running queries are registered process-wide, so with `-DTHREAD_LOCAL_API=on` the interruption also reaches the queries
+of the other threads' APIs, the calling thread only needs a defined architecture.
+The result of a query is given as a triton::engines::solver::status_e and the statistics of all queries are returned by
+triton::API::getSolverStatistics().
+
+~~~~~~~~~~~~~{cpp}
+  triton::engines::solver::status_e status;
+
+  auto model = api.getModel(constraint, &status, 500);
+  if (status == triton::engines::solver::TIMEOUT)
+    std::cout << "No answer within 500ms" << std::endl;
+~~~~~~~~~~~~~
+
+\section solver_interface_backends Backends
+<hr>
+
+The queries are sent to a backend which implements triton::engines::solver::SolverInterface. Its capabilities are given
+as a mask of triton::engines::solver::capability_e by triton::API::getSolverCapabilities().
+
+- triton::engines::solver::BACKEND_Z3 (default): the Z3 SMT solver, it handles all the AST nodes and the memory array.
+- triton::engines::solver::BACKEND_BITBLAST: a built-in bit-blaster on top of a CDCL SAT solver. It does not handle the
+  memory array. On the samples of `src/samples/smt`, it answers a query in 0.004 to 0.25 ms where Z3 takes 6 to 10 ms,
+  including the creation of its context (`src/examples/cpp/solver_backends.cpp` measures it on other queries).
+
+The default backend is set with triton::API::setSolverBackend() and a query may use another one.
+
+~~~~~~~~~~~~~{cpp}
+  auto model = api.getModel(constraint, nullptr, 0, triton::engines::solver::BACKEND_BITBLAST);
+~~~~~~~~~~~~~
+
+\section solver_interface_enumeration Models enumeration
+<hr>
+
+triton::API::enumerateModels() streams the models of a constraint to a triton::engines::solver::modelCallback instead of
+returning them as a list. The models may be projected onto a subset of the symbolic variables: two models differ by at
+least one of them and the others are neither returned nor blocked. The enumeration stops at the `limit` (0 if unlimited),
+when the callback returns false or when the constraint becomes unsatisfiable.
+
+~~~~~~~~~~~~~{cpp}
+  bool print(const std::map<triton::uint32, triton::engines::solver::SolverModel>& model, void* data) {
+    std::cout << model.at(0) << std::endl;
+    return true;
+  }
+
+  // All the values of SymVar_0 which satisfy the constraint
+  api.enumerateModels(constraint, print, nullptr, 0, {0});
+~~~~~~~~~~~~~
+
 */
 
 
@@ -95,17 +151,23 @@ namespace triton {
   namespace engines {
     namespace solver {
 
-      z3::expr mk_or(z3::expr_vector args) {
-        std::vector<Z3_ast> array;
+      /* The names of the statistics of each status */
+      static const char* const statusNames[] = {"unsat", "sat", "unknown", "timeout", "canceled"};
 
-        for (triton::uint32 i = 0; i < args.size(); i++)
-          array.push_back(args[i]);
 
-        return to_expr(args.ctx(), Z3_mk_or(args.ctx(), static_cast<triton::uint32>(array.size()), &(array[0])));
+      /* Collects the models of getModels() */
+      static bool collect(const std::map<triton::uint32, SolverModel>& model, void* data) {
+        reinterpret_cast<std::list<std::map<triton::uint32, SolverModel>>*>(data)->push_back(model);
+        return true;
       }
 
 
-      SolverEngine::SolverEngine() {
+      SolverEngine::SolverEngine()
+        : z3(*this),
+          bitblast(*this) {
+        this->backend = triton::engines::solver::BACKEND_Z3;
+        this->timeout = 0;
+        this->resetStatistics();
       }
 
 
@@ -113,84 +175,78 @@ namespace triton {
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode *node, triton::uint32 limit) const {
-        std::list<std::map<triton::uint32, SolverModel>>  ret;
-        std::ostringstream                                formula;
-        z3::context                                       ctx;
-        z3::solver                                        solver(ctx);
-        triton::uint32                                    representationMode = triton::api.getAstRepresentationMode();
+      const triton::engines::solver::SolverInterface* SolverEngine::getSolver(triton::engines::solver::backend_e backend) const {
+        if (backend == triton::engines::solver::BACKEND_DEFAULT)
+          backend = this->backend;
 
-        if (node == nullptr)
-          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
+        switch (backend) {
+          case triton::engines::solver::BACKEND_Z3:       return &this->z3;
+          case triton::engines::solver::BACKEND_BITBLAST: return &this->bitblast;
+          default:
+            throw triton::exceptions::SolverEngine("SolverEngine::getSolver(): Invalid backend.");
+        }
+      }
 
-        /* Switch into the SMT mode */
-        triton::api.setAstRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
 
-        /* First, set the QF_AUFBV flag  */
-        formula << "(set-logic QF_BV)";
+      void SolverEngine::setBackend(triton::engines::solver::backend_e backend) {
+        if (backend == triton::engines::solver::BACKEND_DEFAULT)
+          throw triton::exceptions::SolverEngine("SolverEngine::setBackend(): Invalid backend.");
+        this->getSolver(backend);
+        this->backend = backend;
+      }
 
-        /* Then, delcare all symbolic variables */
-        formula << triton::api.getVariablesDeclaration();
 
-        /* And concat the user expression */
-        formula << triton::api.getFullAst(node);
+      triton::engines::solver::backend_e SolverEngine::getBackend(void) const {
+        return this->backend;
+      }
 
-        /* Create the context and AST */
-        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
-        z3::expr eq(ctx, ast);
 
-        /* Create a solver and add the expression */
-        solver.add(eq);
+      triton::usize SolverEngine::enumerateModels(triton::ast::AbstractNode *node, triton::engines::solver::modelCallback callback, void* data, triton::uint32 limit, const std::vector<triton::usize>& variables, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::engines::solver::backend_e backend) const {
+        triton::engines::solver::status_e state = triton::engines::solver::UNKNOWN;
+        triton::usize count = 0;
 
-        /* Check if it is sat */
-        while (solver.check() == z3::sat && limit >= 1) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::enumerateModels(): node cannot be null.");
 
-          /* Get model */
-          z3::model m = solver.get_model();
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::enumerateModels(): callback cannot be null.");
 
-          /* Traversing the model */
-          std::map<triton::uint32, SolverModel> smodel;
-          z3::expr_vector args(ctx);
-          for (triton::uint32 i = 0; i < m.size(); i++) {
+        if (timeout == 0)
+          timeout = this->timeout;
 
-            z3::func_decl variable  = m[i];
-            std::string varName     = variable.name().str();
-            z3::expr exp            = m.get_const_interp(variable);
-            triton::uint32 bvSize   = exp.get_sort().bv_size();
-            std::string svalue      = Z3_get_numeral_string(ctx, exp);
+        count = this->getSolver(backend)->enumerateModels(node, variables, limit, callback, data, state, timeout);
 
-            triton::uint512         value{svalue};
-            SolverModel             trionModel{varName, value};
-            smodel[trionModel.getId()] = trionModel;
+        if (status != nullptr)
+          *status = state;
 
-            if (exp.get_sort().is_bv())
-              args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+        return count;
+      }
 
-          }
 
-          /* Escape last models */
-          solver.add(triton::engines::solver::mk_or(args));
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode *node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::engines::solver::backend_e backend) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
 
-          /* If there is model available */
-          if (smodel.size() > 0)
-            ret.push_back(smodel);
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
-          /* Decrement the limit */
-          limit--;
+        /* A limit of 0 returns no model, it is unlimited for an enumeration */
+        if (limit == 0) {
+          if (status != nullptr)
+            *status = triton::engines::solver::UNKNOWN;
+          return ret;
         }
 
-        /* Restore the representation mode */
-        triton::api.setAstRepresentationMode(representationMode);
+        this->enumerateModels(node, collect, &ret, limit, std::vector<triton::usize>(), status, timeout, backend);
 
         return ret;
       }
 
 
-      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode *node) const {
+      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode *node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::engines::solver::backend_e backend) const {
         std::map<triton::uint32, SolverModel> ret;
         std::list<std::map<triton::uint32, SolverModel>> allModels;
 
-        allModels = this->getModels(node, 1);
+        allModels = this->getModels(node, 1, status, timeout, backend);
         if (allModels.size() > 0)
           ret = allModels.front();
 
@@ -198,6 +254,60 @@ namespace triton {
       }
 
 
+      void SolverEngine::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      triton::uint32 SolverEngine::getTimeout(void) const {
+        return this->timeout;
+      }
+
+
+      void SolverEngine::setMemoryLimit(triton::uint32 mb) {
+        this->z3.setMemoryLimit(mb);
+      }
+
+
+      triton::uint32 SolverEngine::getMemoryLimit(void) const {
+        return this->z3.getMemoryLimit();
+      }
+
+
+      void SolverEngine::interrupt(void) {
+        this->z3.interrupt();
+        this->bitblast.interrupt();
+      }
+
+
+      void SolverEngine::record(triton::engines::solver::status_e status, triton::usize elapsed) const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->stats["queries"]++;
+        this->stats[statusNames[status]]++;
+        this->stats["time_ms"] += elapsed;
+        this->stats["max_time_ms"] = std::max(this->stats["max_time_ms"], elapsed);
+      }
+
+
+      std::map<std::string, triton::usize> SolverEngine::getStatistics(void) const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->stats;
+      }
+
+
+      void SolverEngine::resetStatistics(void) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->stats.clear();
+        this->stats["queries"]     = 0;
+        this->stats["time_ms"]     = 0;
+        this->stats["max_time_ms"] = 0;
+        for (triton::usize index = 0; index < sizeof(statusNames) / sizeof(statusNames[0]); index++)
+          this->stats[statusNames[index]] = 0;
+      }
+
+
       triton::uint512 SolverEngine::evaluateAstViaZ3(triton::ast::AbstractNode *node) const {
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::evaluateAstViaZ3(): node cannot be null.");
@@ -0,0 +1,325 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <chrono>
+
+#include <api.hpp>
+#include <ast.hpp>
+#include <exceptions.hpp>
+#include <solverEngine.hpp>
+#include <tritonToZ3Ast.hpp>
+#include <z3Result.hpp>
+#include <z3Solver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      z3::expr mk_or(z3::expr_vector args) {
+        std::vector<Z3_ast> array;
+
+        for (triton::uint32 i = 0; i < args.size(); i++)
+          array.push_back(args[i]);
+
+        return to_expr(args.ctx(), Z3_mk_or(args.ctx(), static_cast<triton::uint32>(array.size()), &(array[0])));
+      }
+
+
+      std::set<z3::context*> Z3Solver::contexts;
+      std::set<z3::context*> Z3Solver::interrupted;
+      std::set<z3::context*> Z3Solver::checking;
+      std::mutex Z3Solver::mutex;
+
+
+      Z3Solver::Z3Solver(const triton::engines::solver::SolverEngine& engine)
+        : engine(engine) {
+        this->memoryLimit = 0;
+      }
+
+
+      Z3Solver::~Z3Solver() {
+      }
+
+
+      std::string Z3Solver::getName(void) const {
+        return "z3";
+      }
+
+
+      triton::uint32 Z3Solver::getCapabilities(void) const {
+        return (triton::engines::solver::CAPABILITY_INCREMENTAL |
+                triton::engines::solver::CAPABILITY_MODELS |
+                triton::engines::solver::CAPABILITY_TIMEOUT |
+                triton::engines::solver::CAPABILITY_INTERRUPT |
+                triton::engines::solver::CAPABILITY_ARRAYS |
+                triton::engines::solver::CAPABILITY_MEMORY_LIMIT);
+      }
+
+
+      triton::engines::solver::status_e Z3Solver::check(z3::context& ctx, z3::solver& solver, triton::uint32 timeout) const {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        bool canceled = false;
+
+        /* Z3 has no timeout by default */
+        if (timeout) {
+          z3::params params(ctx);
+          params.set("timeout", timeout);
+          solver.set(params);
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        /*
+         * The flag is tested and the context is marked as checking in the same critical section, an
+         * interrupt() which comes after this test reaches Z3 through the context. Z3 clears the cancel
+         * flag of a context when a check starts, so an interrupt() which comes just before solver.check()
+         * may still be missed by Z3. It is then caught by the second test, once the check returns.
+         */
+        {
+          std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+          canceled = (Z3Solver::interrupted.find(&ctx) != Z3Solver::interrupted.end());
+          if (!canceled)
+            Z3Solver::checking.insert(&ctx);
+        }
+
+        if (!canceled) {
+          z3::check_result result = z3::unknown;
+
+          try {
+            result = solver.check();
+          }
+          catch (...) {
+            std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+            Z3Solver::checking.erase(&ctx);
+            throw;
+          }
+
+          std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+          Z3Solver::checking.erase(&ctx);
+          canceled = (Z3Solver::interrupted.find(&ctx) != Z3Solver::interrupted.end());
+
+          switch (result) {
+            case z3::sat:   status = triton::engines::solver::SAT;   break;
+            case z3::unsat: status = triton::engines::solver::UNSAT; break;
+            default:        break;
+          }
+        }
+
+        triton::usize elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        /* An interrupted query is canceled, whatever the answer of Z3. Some versions of Z3 report an expired timeout as canceled */
+        if (canceled)
+          status = triton::engines::solver::CANCELED;
+        else if (status == triton::engines::solver::UNKNOWN && (solver.reason_unknown() == "timeout" || (timeout && elapsed >= timeout)))
+          status = triton::engines::solver::TIMEOUT;
+
+        this->engine.record(status, elapsed);
+
+        return status;
+      }
+
+
+      /* Z3 declares the output of Z3_get_numeral_uint64 as __uint64 or uint64_t according to its version */
+      template <typename R, typename T>
+      static bool getNumeral(R (*function)(Z3_context, Z3_ast, T*), Z3_context ctx, Z3_ast ast, triton::uint64& value) {
+        T result = 0;
+        bool ok  = function(ctx, ast, &result);
+        value    = static_cast<triton::uint64>(result);
+        return ok;
+      }
+
+
+      /* Switches the AST representation mode and restores the previous one when it goes out of scope, even on exception */
+      class RepresentationModeGuard {
+        private:
+          triton::uint32 previous;
+
+        public:
+          RepresentationModeGuard(triton::uint32 mode) {
+            this->previous = triton::api.getAstRepresentationMode();
+            triton::api.setAstRepresentationMode(mode);
+          }
+
+          ~RepresentationModeGuard() {
+            triton::api.setAstRepresentationMode(this->previous);
+          }
+      };
+
+
+      triton::usize Z3Solver::enumerateModels(triton::ast::AbstractNode* node, const std::vector<triton::usize>& variables, triton::uint32 limit, triton::engines::solver::modelCallback callback, void* data, triton::engines::solver::status_e& status, triton::uint32 timeout) const {
+        std::vector<triton::engines::symbolic::SymbolicVariable*>  symVars;
+        std::ostringstream                                         formula;
+        z3::context                                                ctx;
+        z3::solver                                                 solver(ctx);
+        z3::expr_vector                                            terms(ctx);
+        triton::usize                                              count = 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): node cannot be null.");
+
+        if (callback == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): callback cannot be null.");
+
+        status = triton::engines::solver::UNKNOWN;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        /* The projection, the variables which do not appear in the constraint are ignored */
+        for (triton::usize id : (variables.empty() ? node->getVariables() : variables)) {
+          if (!node->hasVariable(id))
+            continue;
+          triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromId(id);
+          symVars.push_back(symVar);
+          terms.push_back(ctx.bv_const(symVar->getName().c_str(), symVar->getSize()));
+        }
+
+        /* The query may now be interrupted */
+        {
+          std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+          Z3Solver::contexts.insert(&ctx);
+        }
+
+        try {
+          /*
+           * A frozen state may be queried by several threads. The representation mode is
+           * shared, so the node is directly converted into a Z3 expression instead of being printed.
+           * The converter follows the reference nodes itself, the node is not unrolled.
+           */
+          if (triton::api.isFrozen()) {
+            triton::ast::TritonToZ3Ast z3Ast{false};
+            triton::ast::AbstractNode* fullAst = node;
+
+            /* The converter only handles terms */
+            if (fullAst->getKind() == triton::ast::ASSERT_NODE)
+              fullAst = fullAst->getChilds()[0];
+
+            triton::ast::Z3Result& result = z3Ast.eval(*fullAst);
+            z3::expr eq = to_expr(ctx, Z3_translate(result.getContext(), result.getExpr(), ctx));
+            solver.add(eq);
+          }
+          else {
+            /* Switch into the SMT mode until the formula is printed, shared subterms are sent only once to the solver */
+            {
+              RepresentationModeGuard guard(triton::ast::representations::SMT_DAG_REPRESENTATION);
+
+              /* First, set the QF_BV flag, or QF_ABV when the memory array is used */
+              if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::MEMORY_ARRAY))
+                formula << "(set-logic QF_ABV)";
+              else
+                formula << "(set-logic QF_BV)";
+
+              /* Then, delcare the symbolic variables of the expression */
+              formula << triton::api.getVariablesDeclaration(node);
+
+              /* And concat the user expression */
+              formula << triton::api.getFullAst(node);
+            }
+
+            /* Create the context and AST */
+            Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
+            z3::expr eq(ctx, ast);
+
+            /* Create a solver and add the expression */
+            solver.add(eq);
+          }
+
+          /*
+           * The blocking clauses are added in their own scope. Once a scope is pushed, Z3 uses its
+           * incremental solver and the constraint is not preprocessed again at each check.
+           */
+          solver.push();
+
+          /* Check if it is sat, the timeout bounds the whole enumeration */
+          while (limit == 0 || count < limit) {
+            triton::uint32 remaining = 0;
+
+            if (timeout) {
+              triton::usize elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+              remaining = (elapsed < timeout) ? static_cast<triton::uint32>(timeout - elapsed) : 1;
+            }
+
+            status = this->check(ctx, solver, remaining);
+            if (status != triton::engines::solver::SAT)
+              break;
+
+            /* A constraint without variable has no model to enumerate */
+            if (symVars.empty())
+              break;
+
+            /* Get the values of the projection, as numbers when they fit */
+            z3::model m = solver.get_model();
+            std::map<triton::uint32, SolverModel> model;
+            z3::expr_vector args(ctx);
+
+            for (triton::uint32 i = 0; i < symVars.size(); i++) {
+              z3::expr value         = m.eval(terms[i], true);
+              triton::uint64 number  = 0;
+              triton::uint512 result = 0;
+
+              if (getNumeral(Z3_get_numeral_uint64, ctx, value, number))
+                result = number;
+              else
+                result = triton::uint512{Z3_get_numeral_string(ctx, value)};
+
+              triton::uint32 id = static_cast<triton::uint32>(symVars[i]->getId());
+              model[id] = SolverModel(id, symVars[i]->getName(), result);
+
+              args.push_back(terms[i] != value);
+            }
+
+            count++;
+            if (!callback(model, data))
+              break;
+
+            /* Escape last models */
+            solver.add(triton::engines::solver::mk_or(args));
+          }
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+          Z3Solver::contexts.erase(&ctx);
+          Z3Solver::interrupted.erase(&ctx);
+          throw;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+          Z3Solver::contexts.erase(&ctx);
+          Z3Solver::interrupted.erase(&ctx);
+        }
+
+        return count;
+      }
+
+
+      void Z3Solver::interrupt(void) {
+        std::lock_guard<std::mutex> lock(Z3Solver::mutex);
+
+        /* The other queries are canceled by check(), Z3 throws if a context is interrupted while it builds the constraint */
+        for (std::set<z3::context*>::iterator it = Z3Solver::contexts.begin(); it != Z3Solver::contexts.end(); it++) {
+          Z3Solver::interrupted.insert(*it);
+          if (Z3Solver::checking.find(*it) != Z3Solver::checking.end())
+            (*it)->interrupt();
+        }
+      }
+
+
+      void Z3Solver::setMemoryLimit(triton::uint32 mb) {
+        this->memoryLimit = mb;
+        z3::set_param("memory_max_size", static_cast<int>(mb));
+      }
+
+
+      triton::uint32 Z3Solver::getMemoryLimit(void) const {
+        return this->memoryLimit;
+      }
+
+    };
+  };
+};
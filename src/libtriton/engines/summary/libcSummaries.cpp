@@ -0,0 +1,304 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <vector>
+
+#include <api.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <libcSummaries.hpp>
+#include <x86Semantics.hpp>
+#include <x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace summary {
+      namespace libc {
+
+        /* Returns true if the memory cell holds an expression which contains a symbolic variable */
+        static bool isMemorySymbolized(triton::uint64 addr) {
+          triton::usize id = triton::api.getSymbolicMemoryId(addr);
+          if (id == triton::engines::symbolic::UNSET)
+            return false;
+          return triton::api.getSymbolicExpressionFromId(id)->isSymbolized();
+        }
+
+
+        /* Returns true if the operand (a pointer or a size argument) holds a symbolic variable */
+        static bool isOperandSymbolized(triton::arch::OperandWrapper& op) {
+          return triton::api.buildSymbolicOperand(op)->isSymbolized();
+        }
+
+
+        /* Returns the concrete value of a memory cell */
+        static triton::uint8 getByte(triton::uint64 addr) {
+          return triton::api.getConcreteMemoryValue(triton::arch::MemoryAccess(addr, BYTE_SIZE)).convert_to<triton::uint8>();
+        }
+
+
+        triton::arch::OperandWrapper argument_s(triton::uint32 index) {
+          triton::uint64 stack = triton::api.getConcreteRegisterValue(TRITON_X86_REG_SP.getParent()).convert_to<triton::uint64>();
+
+          switch (triton::api.getArchitecture()) {
+            /* System V - rdi, rsi, rdx, rcx, r8, r9, then the stack */
+            case triton::arch::ARCH_X86_64: {
+              const triton::arch::Register* registers[] = {
+                &TRITON_X86_REG_RDI, &TRITON_X86_REG_RSI, &TRITON_X86_REG_RDX,
+                &TRITON_X86_REG_RCX, &TRITON_X86_REG_R8,  &TRITON_X86_REG_R9,
+              };
+              if (index < 6)
+                return triton::arch::OperandWrapper(*registers[index]);
+              return triton::arch::OperandWrapper(triton::arch::MemoryAccess(stack + QWORD_SIZE * (index - 5), QWORD_SIZE));
+            }
+
+            /* cdecl - the stack, above the return address */
+            case triton::arch::ARCH_X86:
+              return triton::arch::OperandWrapper(triton::arch::MemoryAccess(stack + DWORD_SIZE * (index + 1), DWORD_SIZE));
+
+            default:
+              throw triton::exceptions::SummaryEngine("libc::argument_s(): Invalid architecture.");
+          }
+        }
+
+
+        void return_s(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, bool tainted, const std::string& comment) {
+          if (node != nullptr) {
+            auto ax = TRITON_X86_REG_AX.getParent();
+
+            /* int results are returned in eax, the upper bits are cleared */
+            if (node->getBitvectorSize() < ax.getBitSize())
+              node = triton::ast::zx(ax.getBitSize() - node->getBitvectorSize(), node);
+
+            auto expr = triton::api.createSymbolicRegisterExpression(inst, node, ax, comment);
+            expr->isTainted = triton::api.setTaintRegister(ax, tainted);
+          }
+
+          /* Pop the return address */
+          triton::arch::x86::semantics::ret_s(inst);
+        }
+
+
+        bool free_s(triton::arch::Instruction& inst) {
+          triton::engines::summary::libc::return_s(inst, nullptr, false);
+          return true;
+        }
+
+
+        bool malloc_s(triton::arch::Instruction& inst) {
+          auto size = triton::engines::summary::libc::argument_s(0);
+
+          /* Create symbolic operands */
+          auto op1 = triton::api.buildSymbolicOperand(inst, size);
+
+          /* Allocate the area */
+          triton::uint64 addr = triton::api.getSummaryEngine()->allocate(op1->evaluate().convert_to<triton::usize>());
+
+          /* Create the semantics */
+          auto node = triton::ast::bv(addr, triton::api.cpuRegisterBitSize());
+
+          triton::engines::summary::libc::return_s(inst, node, false, "malloc - return value");
+          return true;
+        }
+
+
+        bool memcpy_s(triton::arch::Instruction& inst) {
+          auto dst  = triton::engines::summary::libc::argument_s(0);
+          auto src  = triton::engines::summary::libc::argument_s(1);
+          auto size = triton::engines::summary::libc::argument_s(2);
+
+          /* Symbolic pointers or sizes would be concretized without constraint, they are left to the instructions of the routine */
+          if (isOperandSymbolized(dst) || isOperandSymbolized(src) || isOperandSymbolized(size))
+            return false;
+
+          /* Larger (or garbage) sizes are left to the instructions of the routine */
+          if (triton::api.buildSymbolicOperand(size)->evaluate() > triton::engines::summary::libc::MAX_AREA_SIZE)
+            return false;
+
+          /* Create symbolic operands */
+          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op3 = triton::api.buildSymbolicOperand(inst, size);
+
+          triton::uint64 dstAddr = op1->evaluate().convert_to<triton::uint64>();
+          triton::uint64 srcAddr = op2->evaluate().convert_to<triton::uint64>();
+          triton::usize count    = op3->evaluate().convert_to<triton::usize>();
+
+          /* Read the whole source before writing, the areas may overlap (memmove) */
+          std::vector<triton::uint8> values = triton::api.getConcreteMemoryAreaValue(srcAddr, count);
+          std::vector<triton::ast::AbstractNode*> nodes(count, nullptr);
+          std::vector<bool> taints(count, false);
+
+          for (triton::usize index = 0; index < count; index++) {
+            taints[index] = triton::api.isMemoryTainted(srcAddr + index);
+            if (triton::engines::summary::libc::isMemorySymbolized(srcAddr + index)) {
+              triton::arch::MemoryAccess cell(srcAddr + index, BYTE_SIZE);
+              nodes[index] = triton::api.buildSymbolicMemory(inst, cell);
+            }
+          }
+
+          /* Concrete bytes are copied without expression */
+          triton::api.setConcreteMemoryAreaValue(dstAddr, values);
+
+          for (triton::usize index = 0; index < count; index++) {
+            triton::arch::MemoryAccess cell(dstAddr + index, BYTE_SIZE);
+            if (nodes[index] != nullptr)
+              triton::api.createSymbolicMemoryExpression(inst, nodes[index], cell, "memcpy - byte copy");
+            else
+              triton::api.concretizeMemory(dstAddr + index);
+            triton::api.setTaintMemory(cell, taints[index]);
+          }
+
+          triton::engines::summary::libc::return_s(inst, op1, triton::api.isTainted(dst), "memcpy - return value");
+          return true;
+        }
+
+
+        bool memset_s(triton::arch::Instruction& inst) {
+          auto dst   = triton::engines::summary::libc::argument_s(0);
+          auto value = triton::engines::summary::libc::argument_s(1);
+          auto size  = triton::engines::summary::libc::argument_s(2);
+
+          /* Symbolic pointers or sizes would be concretized without constraint, they are left to the instructions of the routine */
+          if (isOperandSymbolized(dst) || isOperandSymbolized(size))
+            return false;
+
+          /* Larger (or garbage) sizes are left to the instructions of the routine */
+          if (triton::api.buildSymbolicOperand(size)->evaluate() > triton::engines::summary::libc::MAX_AREA_SIZE)
+            return false;
+
+          /* Create symbolic operands */
+          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op2 = triton::api.buildSymbolicOperand(inst, value);
+          auto op3 = triton::api.buildSymbolicOperand(inst, size);
+
+          triton::uint64 dstAddr = op1->evaluate().convert_to<triton::uint64>();
+          triton::usize count    = op3->evaluate().convert_to<triton::usize>();
+          bool tainted           = triton::api.isTainted(value);
+
+          /* Create the semantics */
+          auto node = triton::ast::extract(BYTE_SIZE_BIT - 1, 0, op2);
+
+          /* A concrete value fills the whole area at once */
+          if (!node->isSymbolized())
+            triton::api.setConcreteMemoryAreaValue(dstAddr, std::vector<triton::uint8>(count, node->evaluate().convert_to<triton::uint8>()));
+
+          for (triton::usize index = 0; index < count; index++) {
+            triton::arch::MemoryAccess cell(dstAddr + index, BYTE_SIZE);
+            if (node->isSymbolized())
+              triton::api.createSymbolicMemoryExpression(inst, node, cell, "memset - byte fill");
+            else
+              triton::api.concretizeMemory(dstAddr + index);
+            triton::api.setTaintMemory(cell, tainted);
+          }
+
+          triton::engines::summary::libc::return_s(inst, op1, triton::api.isTainted(dst), "memset - return value");
+          return true;
+        }
+
+
+        bool strcmp_s(triton::arch::Instruction& inst) {
+          auto str1 = triton::engines::summary::libc::argument_s(0);
+          auto str2 = triton::engines::summary::libc::argument_s(1);
+
+          /* Symbolic pointers would be concretized without constraint, they are left to the instructions of the routine */
+          if (isOperandSymbolized(str1) || isOperandSymbolized(str2))
+            return false;
+
+          /* Create symbolic operands */
+          auto op1 = triton::api.buildSymbolicOperand(inst, str1);
+          auto op2 = triton::api.buildSymbolicOperand(inst, str2);
+
+          triton::uint64 addr1 = op1->evaluate().convert_to<triton::uint64>();
+          triton::uint64 addr2 = op2->evaluate().convert_to<triton::uint64>();
+
+          /* Find the first mismatching or null byte */
+          triton::usize length = 0;
+          while (getByte(addr1 + length) == getByte(addr2 + length) && getByte(addr1 + length) != 0)
+            length++;
+
+          /* Create the semantics - the concrete result */
+          triton::sint32 diff = static_cast<triton::sint32>(getByte(addr1 + length)) - static_cast<triton::sint32>(getByte(addr2 + length));
+          bool last           = isMemorySymbolized(addr1 + length) || isMemorySymbolized(addr2 + length);
+          auto node           = triton::ast::bv(last ? 0 : static_cast<triton::uint32>(diff), DWORD_SIZE_BIT);
+          bool tainted        = false;
+
+          /* Create the semantics - each symbolic byte may stop the comparison earlier */
+          for (triton::usize index = length + 1; index-- > 0;) {
+            tainted |= triton::api.isMemoryTainted(addr1 + index) || triton::api.isMemoryTainted(addr2 + index);
+
+            if (!isMemorySymbolized(addr1 + index) && !isMemorySymbolized(addr2 + index))
+              continue;
+
+            triton::arch::MemoryAccess cell1(addr1 + index, BYTE_SIZE);
+            triton::arch::MemoryAccess cell2(addr2 + index, BYTE_SIZE);
+            auto byte1 = triton::api.buildSymbolicMemory(inst, cell1);
+            auto byte2 = triton::api.buildSymbolicMemory(inst, cell2);
+
+            node = triton::ast::ite(
+                     triton::ast::lor(
+                       triton::ast::distinct(byte1, byte2),
+                       triton::ast::equal(byte1, triton::ast::bv(0, BYTE_SIZE_BIT))
+                     ),
+                     triton::ast::bvsub(
+                       triton::ast::zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, byte1),
+                       triton::ast::zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, byte2)
+                     ),
+                     node
+                   );
+          }
+
+          triton::engines::summary::libc::return_s(inst, node, tainted, "strcmp - return value");
+          return true;
+        }
+
+
+        bool strlen_s(triton::arch::Instruction& inst) {
+          auto str = triton::engines::summary::libc::argument_s(0);
+
+          /* A symbolic pointer would be concretized without constraint, it is left to the instructions of the routine */
+          if (isOperandSymbolized(str))
+            return false;
+
+          /* Create symbolic operands */
+          auto op1 = triton::api.buildSymbolicOperand(inst, str);
+
+          triton::uint64 addr = op1->evaluate().convert_to<triton::uint64>();
+          triton::uint32 size = triton::api.cpuRegisterBitSize();
+
+          /* Find the null byte */
+          triton::usize length = 0;
+          while (getByte(addr + length) != 0)
+            length++;
+
+          /* Create the semantics - each symbolic byte may be the first null byte */
+          auto node    = triton::ast::bv(length, size);
+          bool tainted = triton::api.isMemoryTainted(addr + length);
+
+          for (triton::usize index = length; index-- > 0;) {
+            tainted |= triton::api.isMemoryTainted(addr + index);
+
+            if (!isMemorySymbolized(addr + index))
+              continue;
+
+            triton::arch::MemoryAccess cell(addr + index, BYTE_SIZE);
+            node = triton::ast::ite(
+                     triton::ast::equal(triton::api.buildSymbolicMemory(inst, cell), triton::ast::bv(0, BYTE_SIZE_BIT)),
+                     triton::ast::bv(index, size),
+                     node
+                   );
+          }
+
+          triton::engines::summary::libc::return_s(inst, node, tainted, "strlen - return value");
+          return true;
+        }
+
+      };
+    };
+  };
+};
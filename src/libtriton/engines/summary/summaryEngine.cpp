@@ -0,0 +1,237 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <utility>
+
+#include <exceptions.hpp>
+#include <libcSummaries.hpp>
+#include <summaryEngine.hpp>
+
+
+
+/*! \page engine_Summary_page Summary Engine
+    \brief [**internal**] All information about the summary engine.
+
+\tableofcontents
+
+\section engine_Summary_description Description
+<hr>
+
+Routines like `memcpy` or `strlen` are implemented with vectorized code paths which
+produce large symbolic expressions and spend most of the instructions of a trace. A
+summary applies the effect of such a routine in one step: when the first instruction
+of a summarized routine is processed (via `processing()` or `buildSemantics()`), the
+summary is applied instead of the instruction semantics and the PC is set to the return
+address. The instruction then holds all symbolic expressions of the call. The summary
+takes the place of the CPU semantics in `Architecture::buildSemantics()`, so the state of
+the engines and the symbolic optimizations apply to it as to any instruction. A summary
+may decline a call (e.g: a `memcpy` larger than `libc::MAX_AREA_SIZE` or with a symbolized
+pointer or size), the instruction is then processed as usual.
+
+Summaries are bound to addresses. The built-in \ref libc_summaries_page can be bound by
+name, or to all routines of an ELF symbols table. The multiarch variants of the glibc
+(e.g: `__memmove_avx_unaligned_erms`, `__strlen_sse2`) and the `__libc_` aliases are
+recognized. Note that `STT_GNU_IFUNC` symbols point to a resolver, not to the routine,
+so they are never bound.
+
+~~~~~~~~~~~~~{.cpp}
+triton::format::elf::Elf libc("/lib/x86_64-linux-gnu/libc.so.6");
+triton::api.addSummaries(libc, 0x7ffff7a0d000);
+~~~~~~~~~~~~~
+
+*/
+
+
+
+namespace triton {
+  namespace engines {
+    namespace summary {
+
+      /* Symbol type of the functions */
+      static const triton::uint8 STT_FUNC = 2;
+
+      /* The built-in summaries, sorted by name */
+      static const std::pair<const char*, triton::engines::summary::summary_t> builtinSummaries[] = {
+        {"free",    triton::engines::summary::libc::free_s},
+        {"malloc",  triton::engines::summary::libc::malloc_s},
+        {"memcpy",  triton::engines::summary::libc::memcpy_s},
+        {"memmove", triton::engines::summary::libc::memcpy_s},
+        {"memset",  triton::engines::summary::libc::memset_s},
+        {"strcmp",  triton::engines::summary::libc::strcmp_s},
+        {"strlen",  triton::engines::summary::libc::strlen_s},
+      };
+
+      /* Suffixes of the glibc multiarch variants (e.g: __memcpy_avx_unaligned) */
+      static const char* const variantSuffixes[] = {
+        "avx", "chk", "erms", "evex", "ia32", "sse", "ssse", "unaligned",
+      };
+
+
+      SummaryEngine::SummaryEngine() {
+        this->heap = triton::engines::summary::DEFAULT_HEAP_BASE;
+      }
+
+
+      SummaryEngine::SummaryEngine(const SummaryEngine& copy) {
+        this->summaries = copy.summaries;
+        this->names     = copy.names;
+        this->heap      = copy.heap;
+      }
+
+
+      SummaryEngine::~SummaryEngine() {
+      }
+
+
+      void SummaryEngine::operator=(const SummaryEngine& copy) {
+        this->summaries = copy.summaries;
+        this->names     = copy.names;
+        this->heap      = copy.heap;
+      }
+
+
+      triton::engines::summary::summary_t SummaryEngine::getBuiltinSummary(const std::string& name) {
+        std::string routine = name;
+
+        /* __libc_malloc -> malloc */
+        if (routine.compare(0, 7, "__libc_") == 0)
+          routine = routine.substr(7);
+
+        /* __strlen_avx2 -> strlen */
+        else if (routine.compare(0, 2, "__") == 0) {
+          std::string::size_type end = routine.find('_', 2);
+          if (end == std::string::npos)
+            return nullptr;
+
+          bool variant = false;
+          for (triton::usize index = 0; index < sizeof(variantSuffixes) / sizeof(variantSuffixes[0]); index++) {
+            if (routine.compare(end + 1, std::strlen(variantSuffixes[index]), variantSuffixes[index]) == 0) {
+              variant = true;
+              break;
+            }
+          }
+
+          if (!variant)
+            return nullptr;
+
+          routine = routine.substr(2, end - 2);
+        }
+
+        for (triton::usize index = 0; index < sizeof(builtinSummaries) / sizeof(builtinSummaries[0]); index++) {
+          if (routine == builtinSummaries[index].first)
+            return builtinSummaries[index].second;
+        }
+
+        return nullptr;
+      }
+
+
+      void SummaryEngine::addSummary(triton::uint64 addr, triton::engines::summary::summary_t summary, const std::string& name) {
+        if (summary == nullptr)
+          throw triton::exceptions::SummaryEngine("SummaryEngine::addSummary(): The summary cannot be null.");
+        this->summaries[addr] = summary;
+        this->names[addr]     = name;
+      }
+
+
+      bool SummaryEngine::addSummary(triton::uint64 addr, const std::string& name) {
+        triton::engines::summary::summary_t summary = SummaryEngine::getBuiltinSummary(name);
+
+        if (summary == nullptr)
+          return false;
+
+        this->addSummary(addr, summary, name);
+        return true;
+      }
+
+
+      triton::usize SummaryEngine::addSummaries(const triton::format::elf::Elf& binary, triton::uint64 base) {
+        const std::vector<triton::format::elf::ElfSymbolTable>& symbols = binary.getSymbolsTable();
+        triton::usize count = 0;
+
+        for (triton::usize index = 0; index < symbols.size(); index++) {
+          const triton::format::elf::ElfSymbolTable& symbol = symbols[index];
+
+          /* Only routines defined in this binary */
+          if ((symbol.getInfo() & 0xf) != STT_FUNC || symbol.getShndx() == triton::format::elf::SHN_UNDEF || symbol.getValue() == 0)
+            continue;
+
+          triton::engines::summary::summary_t summary = SummaryEngine::getBuiltinSummary(symbol.getName());
+          if (summary == nullptr)
+            continue;
+
+          /* The dynamic and the static symbols tables may define the same routine */
+          triton::uint64 addr = base + symbol.getValue();
+          if (!this->isSummarized(addr))
+            count++;
+
+          this->addSummary(addr, summary, symbol.getName());
+        }
+
+        return count;
+      }
+
+
+      void SummaryEngine::removeSummary(triton::uint64 addr) {
+        this->summaries.erase(addr);
+        this->names.erase(addr);
+      }
+
+
+      void SummaryEngine::removeAllSummaries(void) {
+        this->summaries.clear();
+        this->names.clear();
+      }
+
+
+      bool SummaryEngine::isSummarized(triton::uint64 addr) const {
+        return this->summaries.find(addr) != this->summaries.end();
+      }
+
+
+      const std::map<triton::uint64, std::string>& SummaryEngine::getSummaries(void) const {
+        return this->names;
+      }
+
+
+      bool SummaryEngine::processSummary(triton::arch::Instruction& inst) const {
+        std::map<triton::uint64, triton::engines::summary::summary_t>::const_iterator it = this->summaries.find(inst.getAddress());
+
+        if (it == this->summaries.end())
+          return false;
+
+        /* A declined summary keeps the instruction untouched, its own semantics are built */
+        if (!it->second(inst))
+          return false;
+
+        /* The operands and the memory accesses are those of the first instruction, not those of the call */
+        inst.operands.clear();
+        inst.memoryAccess.clear();
+        inst.setControlFlow(true);
+
+        return true;
+      }
+
+
+      void SummaryEngine::setHeapBase(triton::uint64 base) {
+        this->heap = base;
+      }
+
+
+      triton::uint64 SummaryEngine::allocate(triton::usize size) {
+        triton::uint64 addr = this->heap;
+
+        /* Keep the next area aligned, malloc(0) returns a unique pointer */
+        this->heap += ((size ? size : 1) + 15) & ~static_cast<triton::uint64>(15);
+
+        return addr;
+      }
+
+    };
+  };
+};
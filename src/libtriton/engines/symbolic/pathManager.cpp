@@ -31,6 +31,7 @@ namespace triton {
 
       void PathManager::copy(const PathManager& other) {
         this->pathConstraints = other.pathConstraints;
+        this->conjunctions    = other.conjunctions;
       }
 
 
@@ -42,21 +43,51 @@ namespace triton {
 
       /* Returns the logical conjunction AST of path constraint */
       triton::ast::AbstractNode* PathManager::getPathConstraintsAst(void) const {
-        std::vector<triton::engines::symbolic::PathConstraint>::const_iterator it;
-        triton::ast::AbstractNode* node = nullptr;
+        return this->getPathConstraintsPrefixAst(this->pathConstraints.size());
+      }
 
-        /* by default PC is T (top) */
-        node = triton::ast::equal(
-                 triton::ast::bvtrue(),
-                 triton::ast::bvtrue()
-               );
-
-        /* Then, we create a conjunction of pc */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
-          node = triton::ast::land(node, it->getTakenPathConstraintAst());
+
+      /* Returns the logical conjunction AST of the first path constraints */
+      triton::ast::AbstractNode* PathManager::getPathConstraintsPrefixAst(triton::usize count) const {
+        std::vector<triton::ast::AbstractNode*> exprs;
+        triton::usize offset = 0;
+
+        if (count > this->pathConstraints.size())
+          throw triton::exceptions::PathManager("PathManager::getPathConstraintsPrefixAst(): Invalid number of constraints.");
+
+        /* The prefix is made of one balanced conjunction per bit of count */
+        for (triton::usize level = this->conjunctions.size(); level-- > 0;) {
+          if (count & (static_cast<triton::usize>(1) << level)) {
+            exprs.push_back(this->conjunctions[level][offset >> level]);
+            offset += static_cast<triton::usize>(1) << level;
+          }
         }
 
-        return node;
+        /* by default PC is T (top) */
+        if (exprs.empty())
+          return triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvtrue());
+
+        if (exprs.size() == 1)
+          return exprs.front();
+
+        return triton::ast::land(exprs);
+      }
+
+
+      void PathManager::addConjunction(triton::ast::AbstractNode* node) {
+        for (triton::usize level = 0; ; level++) {
+          if (this->conjunctions.size() == level)
+            this->conjunctions.resize(level + 1);
+
+          std::vector<triton::ast::AbstractNode*>& blocks = this->conjunctions[level];
+          blocks.push_back(node);
+
+          /* Two blocks of the same level are merged into the next one */
+          if (blocks.size() % 2)
+            break;
+
+          node = triton::ast::land(blocks[blocks.size() - 2], blocks.back());
+        }
       }
 
 
@@ -109,21 +140,21 @@ namespace triton {
 
           pco.addBranchConstraint(bb1 == dstAddr, srcAddr, bb1, bb1pc);
           pco.addBranchConstraint(bb2 == dstAddr, srcAddr, bb2, bb2pc);
-
-          this->pathConstraints.push_back(pco);
         }
 
         /* Direct branch */
         else {
           pco.addBranchConstraint(true, srcAddr, dstAddr, triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
-          this->pathConstraints.push_back(pco);
         }
 
+        this->pathConstraints.push_back(pco);
+        this->addConjunction(pco.getTakenPathConstraintAst());
       }
 
 
       void PathManager::clearPathConstraints(void) {
         this->pathConstraints.clear();
+        this->conjunctions.clear();
       }
 
 
@@ -6,6 +6,7 @@
 */
 
 #include <cstring>
+#include <iterator>
 
 #include <api.hpp>
 #include <exceptions.hpp>
@@ -70,6 +71,30 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /* Returns the range [lower:upper] of the addresses a symbolic address may take (MEMORY_ARRAY optimization) */
+      static void getMemoryArrayBounds(triton::uint64 address, triton::uint32 size, triton::usize window, triton::uint64& lower, triton::uint64& upper) {
+        triton::uint64 mask = -1;
+        mask >>= (QWORD_SIZE_BIT - triton::api.cpuRegisterBitSize());
+
+        lower = (address > window) ? address - window : 0;
+        upper = (mask - address > window) ? address + window : mask;
+
+        /* The last cell of the access must stay addressable */
+        if (upper > mask - (size - 1))
+          upper = mask - (size - 1);
+      }
+
+
+      /* Returns the condition under which a symbolic address stays in the range [lower:upper] */
+      static triton::ast::AbstractNode* getMemoryArrayGuard(triton::ast::AbstractNode* index, triton::uint64 lower, triton::uint64 upper) {
+        triton::uint32 bitSize = index->getBitvectorSize();
+        return triton::ast::land(
+                 triton::ast::bvuge(index, triton::ast::bv(lower, bitSize)),
+                 triton::ast::bvule(index, triton::ast::bv(upper, bitSize))
+               );
+      }
+
+
       SymbolicEngine::SymbolicEngine() {
         triton::api.checkArchitecture();
 
@@ -80,9 +105,13 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
-        this->enableFlag      = true;
-        this->uniqueSymExprId = 0;
-        this->uniqueSymVarId  = 0;
+        this->deadExpressionsCursor = 0;
+        this->deadExpressionsWindow = 16;
+        this->enableFlag            = true;
+        this->instructionIndex      = 0;
+        this->memoryArrayWindow     = 16;
+        this->uniqueSymExprId       = 0;
+        this->uniqueSymVarId        = 0;
       }
 
 
@@ -95,13 +124,31 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = other.symbolicReg[i];
 
+        this->alignedMemoryNodes          = other.alignedMemoryNodes;
         this->alignedMemoryReference      = other.alignedMemoryReference;
+        this->batchedSimplifications      = other.batchedSimplifications;
+        this->deadExpressionsCursor       = other.deadExpressionsCursor;
+        this->deadExpressionsWindow       = other.deadExpressionsWindow;
         this->enableFlag                  = other.enableFlag;
+        this->expressionDependencies      = other.expressionDependencies;
+        this->expressionDependents        = other.expressionDependents;
+        this->instructionIndex            = other.instructionIndex;
+        this->memoryArrayWindow           = other.memoryArrayWindow;
         this->memoryReference             = other.memoryReference;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicVariables           = other.symbolicVariables;
         this->uniqueSymExprId             = other.uniqueSymExprId;
+        this->unreferencedExpressions     = other.unreferencedExpressions;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+
+        /* The expressions and the variables are shared with the other engine (e.g. the backup of the API) */
+        std::map<triton::usize, SymbolicExpression*>::iterator it1;
+        for (it1 = this->symbolicExpressions.begin(); it1 != this->symbolicExpressions.end(); it1++)
+          it1->second->acquire();
+
+        std::map<triton::usize, SymbolicVariable*>::iterator it2;
+        for (it2 = this->symbolicVariables.begin(); it2 != this->symbolicVariables.end(); it2++)
+          it2->second->acquire();
       }
 
 
@@ -119,8 +166,24 @@ namespace triton {
         triton::engines::symbolic::SymbolicOptimization::operator=(other);
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
+        std::map<triton::usize, SymbolicExpression*> previousExpressions = this->symbolicExpressions;
+        std::map<triton::usize, SymbolicVariable*> previousVariables = this->symbolicVariables;
+
         delete[] this->symbolicReg;
         this->init(other);
+
+        /* The previous expressions and variables are released once the new ones are held (self-assignment) */
+        std::map<triton::usize, SymbolicExpression*>::iterator it1;
+        for (it1 = previousExpressions.begin(); it1 != previousExpressions.end(); it1++) {
+          if (it1->second->release())
+            delete it1->second;
+        }
+
+        std::map<triton::usize, SymbolicVariable*>::iterator it2;
+        for (it2 = previousVariables.begin(); it2 != previousVariables.end(); it2++) {
+          if (it2->second->release())
+            delete it2->second;
+        }
       }
 
 
@@ -128,13 +191,17 @@ namespace triton {
         std::map<triton::usize, SymbolicExpression*>::iterator it1 = this->symbolicExpressions.begin();
         std::map<triton::usize, SymbolicVariable*>::iterator it2 = this->symbolicVariables.begin();
 
-        /* Delete all symbolic expressions */
-        for (; it1 != this->symbolicExpressions.end(); ++it1)
-          delete it1->second;
+        /* Delete all symbolic expressions, except the ones still held by an instruction */
+        for (; it1 != this->symbolicExpressions.end(); ++it1) {
+          if (it1->second->release())
+            delete it1->second;
+        }
 
-        /* Delete all symbolic variables */
-        for (; it2 != this->symbolicVariables.end(); ++it2)
-          delete it2->second;
+        /* Delete all symbolic variables, except the ones still recorded by another engine */
+        for (; it2 != this->symbolicVariables.end(); ++it2) {
+          if (it2->second->release())
+            delete it2->second;
+        }
 
         /* Delete all symbolic register */
         delete[] this->symbolicReg;
@@ -189,21 +256,24 @@ namespace triton {
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
         this->memoryReference.clear();
+        this->alignedMemoryNodes.clear();
         this->alignedMemoryReference.clear();
       }
 
 
       /* Gets an aligned entry. */
       triton::ast::AbstractNode* SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->isAlignedMemory(address, size))
-          return this->alignedMemoryReference[std::make_pair(address, size)];
+        std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::const_iterator it = this->alignedMemoryReference.find(address);
+        if (it != this->alignedMemoryReference.end() && it->second.first == size)
+          return it->second.second;
         return nullptr;
       }
 
 
       /* Checks if the aligned memory is recored. */
       bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->alignedMemoryReference.find(std::make_pair(address, size)) != this->alignedMemoryReference.end())
+        std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::const_iterator it = this->alignedMemoryReference.find(address);
+        if (it != this->alignedMemoryReference.end() && it->second.first == size)
           return true;
         return false;
       }
@@ -212,37 +282,277 @@ namespace triton {
       /* Adds an aligned memory */
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
         this->removeAlignedMemory(address, size);
-        this->alignedMemoryReference[std::make_pair(address, size)] = node;
+        this->alignedMemoryReference[address] = std::make_pair(size, node);
+        this->alignedMemoryNodes.insert(std::make_pair(node, address));
+      }
+
+
+      /* Removes an aligned memory and its node index */
+      std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator SymbolicEngine::eraseAlignedMemory(std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator it) {
+        auto range = this->alignedMemoryNodes.equal_range(it->second.second);
+
+        for (std::multimap<triton::ast::AbstractNode*, triton::uint64>::iterator node = range.first; node != range.second; node++) {
+          if (node->second == it->first) {
+            this->alignedMemoryNodes.erase(node);
+            break;
+          }
+        }
+
+        return this->alignedMemoryReference.erase(it);
+      }
+
+
+      /* Returns the first aligned memory which may overlap [address, address+size) */
+      static std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator firstAlignedMemory(std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>& ranges, triton::uint64 address) {
+        std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator it = ranges.lower_bound(address);
+
+        /* Ranges never overlap, only the previous one may cover the address */
+        if (it != ranges.begin()) {
+          std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator prev = std::prev(it);
+          if (address - prev->first < prev->second.first)
+            it = prev;
+        }
+
+        return it;
+      }
+
+
+      /* Returns true if an aligned memory overlaps [address, address+size) */
+      bool SymbolicEngine::isAlignedMemoryOverlapped(triton::uint64 address, triton::uint32 size) {
+        std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator it = firstAlignedMemory(this->alignedMemoryReference, address);
+        return (it != this->alignedMemoryReference.end() && (it->first < address || it->first - address < size));
       }
 
 
-      /* Removes an aligned memory */
+      /* Removes the aligned memories overlapping [address, address+size) */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, WORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQQWORD_SIZE));
-        }
-
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < DQQWORD_SIZE; index++) {
-          if (index < WORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, WORD_SIZE));
-          if (index < DWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DWORD_SIZE));
-          if (index < QWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QWORD_SIZE));
-          if (index < DQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQWORD_SIZE));
-          if (index < QQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QQWORD_SIZE));
-          if (index < DQQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQQWORD_SIZE));
+        std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator it = firstAlignedMemory(this->alignedMemoryReference, address);
+
+        while (it != this->alignedMemoryReference.end() && (it->first < address || it->first - address < size))
+          it = this->eraseAlignedMemory(it);
+      }
+
+
+      /* Removes the aligned memories pointing to nodes which are about to be freed, through the smaller of both sets */
+      void SymbolicEngine::removeAlignedMemory(const std::set<triton::ast::AbstractNode*>& nodes) {
+        if (this->alignedMemoryNodes.size() < nodes.size()) {
+          std::multimap<triton::ast::AbstractNode*, triton::uint64>::iterator it = this->alignedMemoryNodes.begin();
+          while (it != this->alignedMemoryNodes.end()) {
+            if (nodes.find(it->first) != nodes.end()) {
+              this->alignedMemoryReference.erase(it->second);
+              it = this->alignedMemoryNodes.erase(it);
+            }
+            else
+              it++;
+          }
+          return;
+        }
+
+        for (std::set<triton::ast::AbstractNode*>::const_iterator node = nodes.begin(); node != nodes.end(); node++) {
+          auto range = this->alignedMemoryNodes.equal_range(*node);
+          for (std::multimap<triton::ast::AbstractNode*, triton::uint64>::iterator it = range.first; it != range.second; it++)
+            this->alignedMemoryReference.erase(it->second);
+          this->alignedMemoryNodes.erase(range.first, range.second);
+        }
+      }
+
+
+      /*
+       * Slides the liveness window of the DEAD_EXPRESSIONS optimization. An unreferenced
+       * expression which leaves the window is removed if no register or memory cell holds
+       * it anymore (e.g. its target has been concretized). Otherwise it is still the value
+       * of its target, it stays recorded and is removed once the target is reassigned.
+       */
+      void SymbolicEngine::slideDeadExpressionsWindow(void) {
+        std::map<triton::usize, triton::usize>::iterator it;
+
+        this->instructionIndex++;
+
+        /* Expressions ids are increasing, the oldest ones are at the beginning of the map. Each one leaves the window once */
+        it = this->unreferencedExpressions.lower_bound(this->deadExpressionsCursor);
+        while (it != this->unreferencedExpressions.end() && (this->instructionIndex - it->second) > this->deadExpressionsWindow) {
+          triton::usize symExprId = it->first;
+          this->deadExpressionsCursor = symExprId + 1;
+          it++;
+
+          std::map<triton::usize, SymbolicExpression*>::const_iterator expr = this->symbolicExpressions.find(symExprId);
+          if (expr != this->symbolicExpressions.end() && !this->isAssigned(expr->second))
+            this->deleteSymbolicExpression(symExprId);
+        }
+      }
+
+
+      /* Returns true if a register or a memory cell holds the expression */
+      bool SymbolicEngine::isAssigned(const SymbolicExpression* se) const {
+        if (se->isRegister())
+          return (this->getSymbolicRegisterId(se->getOriginRegister()) == se->getId());
+
+        if (se->isMemory()) {
+          const triton::arch::MemoryAccess& mem = se->getOriginMemory();
+          for (triton::uint32 index = 0; index < mem.getSize(); index++) {
+            if (this->getSymbolicMemoryId(mem.getAddress() + index) == se->getId())
+              return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      void SymbolicEngine::setDeadExpressionsWindow(triton::usize size) {
+        this->deadExpressionsWindow = size;
+      }
+
+
+      triton::usize SymbolicEngine::getDeadExpressionsWindow(void) const {
+        return this->deadExpressionsWindow;
+      }
+
+
+      void SymbolicEngine::setMemoryArrayWindow(triton::usize size) {
+        this->memoryArrayWindow = size;
+      }
+
+
+      triton::usize SymbolicEngine::getMemoryArrayWindow(void) const {
+        return this->memoryArrayWindow;
+      }
+
+
+      /* Returns the address of a memory access as an index of the memory array if it is symbolized */
+      triton::ast::AbstractNode* SymbolicEngine::getMemoryArrayIndex(const triton::arch::MemoryAccess& mem) const {
+        triton::ast::AbstractNode* index = mem.getLeaAst();
+        triton::uint32 bitSize           = triton::api.cpuRegisterBitSize();
+
+        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::MEMORY_ARRAY))
+          return nullptr;
+
+        if (index == nullptr || !index->isSymbolized())
+          return nullptr;
+
+        /* The indexes of the memory array have the size of the registers */
+        if (index->getBitvectorSize() < bitSize)
+          index = triton::ast::zx(bitSize - index->getBitvectorSize(), index);
+        else if (index->getBitvectorSize() > bitSize)
+          index = triton::ast::extract(bitSize - 1, 0, index);
+
+        /* The address has been defined by the user */
+        if (index->evaluate() != mem.getAddress())
+          return nullptr;
+
+        return index;
+      }
+
+
+      /* Returns the memory array holding the symbolic or concrete values of the cells */
+      triton::ast::AbstractNode* SymbolicEngine::buildMemoryArray(triton::uint64 address, triton::usize size) {
+        triton::uint32 bitSize          = triton::api.cpuRegisterBitSize();
+        triton::ast::AbstractNode* node = triton::ast::array(bitSize);
+
+        for (triton::usize index = 0; index < size; index++) {
+          triton::usize symMem = this->getSymbolicMemoryId(address + index);
+          triton::ast::AbstractNode* cell = nullptr;
+
+          if (symMem != triton::engines::symbolic::UNSET)
+            cell = triton::ast::extract((BYTE_SIZE_BIT - 1), 0, triton::ast::reference(symMem));
+          else
+            cell = triton::ast::bv(triton::api.getConcreteMemoryValue(address + index), BYTE_SIZE_BIT);
+
+          node = triton::ast::store(node, triton::ast::bv(address + index, bitSize), cell);
+        }
+
+        return node;
+      }
+
+
+      /* Records an expression assigned to a register or a memory cell and not yet referenced */
+      void SymbolicEngine::recordUnreferencedExpression(SymbolicExpression* se) {
+        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::DEAD_EXPRESSIONS))
+          this->unreferencedExpressions[se->getId()] = this->instructionIndex;
+      }
+
+
+      /*
+       * Removes an expression which is going to be overwritten if it has never
+       * been referenced. Expressions of the current instruction are kept, so that
+       * the instruction semantics always describes its own side effects.
+       */
+      void SymbolicEngine::removeDeadExpression(triton::usize symExprId) {
+        std::map<triton::usize, triton::usize>::iterator it;
+
+        if (!this->enableFlag || symExprId == triton::engines::symbolic::UNSET)
+          return;
+
+        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::DEAD_EXPRESSIONS))
+          return;
+
+        it = this->unreferencedExpressions.find(symExprId);
+        if (it == this->unreferencedExpressions.end() || it->second == this->instructionIndex)
+          return;
+
+        /* The target is about to be reassigned, it does not have to be concretized */
+        this->deleteSymbolicExpression(symExprId);
+      }
+
+
+      /*
+       * Removes an expression from the engine and from the dependency index. The
+       * expression is deleted once the instructions which hold it are released.
+       */
+      void SymbolicEngine::deleteSymbolicExpression(triton::usize symExprId) {
+        std::map<triton::usize, SymbolicExpression*>::iterator it = this->symbolicExpressions.find(symExprId);
+
+        if (it == this->symbolicExpressions.end())
+          return;
+
+        this->unindexSymbolicExpression(symExprId);
+        this->expressionDependents.erase(symExprId);
+
+        if (it->second->release())
+          delete it->second;
+
+        this->symbolicExpressions.erase(it);
+        this->unreferencedExpressions.erase(symExprId);
+        this->batchedSimplifications.erase(symExprId);
+      }
+
+
+      /* Keeps an expression whose id has been looked up, it may be referenced from now */
+      void SymbolicEngine::keepSymbolicExpression(triton::usize symExprId) {
+        if (!this->unreferencedExpressions.empty())
+          this->unreferencedExpressions.erase(symExprId);
+      }
+
+
+      /*
+       * Sends the roots of all expressions created since the last flush to the
+       * SYMBOLIC_SIMPLIFICATION_BATCH callbacks in a single call, then assigns
+       * the nodes they have rewritten.
+       */
+      void SymbolicEngine::processBatchedSimplifications(void) {
+        std::vector<triton::ast::AbstractNode*> nodes;
+        std::vector<SymbolicExpression*> exprs;
+        std::map<triton::usize, SymbolicExpression*>::iterator it;
+
+        if (this->batchedSimplifications.empty())
+          return;
+
+        nodes.reserve(this->batchedSimplifications.size());
+        exprs.reserve(this->batchedSimplifications.size());
+
+        for (it = this->batchedSimplifications.begin(); it != this->batchedSimplifications.end(); it++) {
+          exprs.push_back(it->second);
+          nodes.push_back(it->second->getAst());
+        }
+
+        /* Callbacks may create new expressions, they will be part of the next batch */
+        this->batchedSimplifications.clear();
+
+        triton::api.processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION_BATCH, nodes);
+
+        for (triton::usize index = 0; index < exprs.size(); index++) {
+          if (nodes[index] != exprs[index]->getAst())
+            exprs[index]->setAst(nodes[index]);
         }
       }
 
@@ -346,7 +656,10 @@ namespace triton {
         SymbolicExpression* expr = new SymbolicExpression(node, id, kind, comment);
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
+        expr->acquire();
         this->symbolicExpressions[id] = expr;
+        if (triton::api.hasCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION_BATCH))
+          this->batchedSimplifications[id] = expr;
         return expr;
       }
 
@@ -357,8 +670,7 @@ namespace triton {
 
         if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
           /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
-          this->symbolicExpressions.erase(symExprId);
+          this->deleteSymbolicExpression(symExprId);
 
           /* Concretize the register if it exists */
           for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
@@ -414,6 +726,194 @@ namespace triton {
       }
 
 
+      /*
+       * Iterative walk, a full AST may be too deep for the call stack. Each node is visited once.
+       * Nodes are shared, so every replacement goes through setChild() to keep the parents right
+       * and is recorded to be undone by rollReferences().
+       */
+      void SymbolicEngine::unrollReferences(void) {
+        std::map<triton::usize, SymbolicExpression*>::const_iterator it;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::set<triton::ast::AbstractNode*> visited;
+
+        /* Every expression stays alive, the lookups by id must not modify the engine anymore */
+        this->unreferencedExpressions.clear();
+
+        /* The references are lost once unrolled, the slices must be indexed before */
+        this->indexSymbolicExpressions();
+
+        for (it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++)
+          worklist.push_back(it->second->getAst());
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (!visited.insert(node).second)
+            continue;
+
+          std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++) {
+            triton::ast::AbstractNode* child = childs[index];
+            if (child->getKind() == triton::ast::REFERENCE_NODE) {
+              triton::ast::AbstractNode* ast = child;
+              while (ast->getKind() == triton::ast::REFERENCE_NODE)
+                ast = this->getSymbolicExpressionFromId(reinterpret_cast<triton::ast::ReferenceNode*>(ast)->getValue())->getAst();
+              this->unrolledReferences.push_back(std::make_tuple(node, index, child));
+              node->setChild(index, ast);
+            }
+            worklist.push_back(childs[index]);
+          }
+        }
+      }
+
+
+      void SymbolicEngine::rollReferences(void) {
+        std::vector<std::tuple<triton::ast::AbstractNode*, triton::uint32, triton::ast::AbstractNode*>>::reverse_iterator it;
+
+        for (it = this->unrolledReferences.rbegin(); it != this->unrolledReferences.rend(); it++)
+          std::get<0>(*it)->setChild(std::get<1>(*it), std::get<2>(*it));
+
+        this->unrolledReferences.clear();
+      }
+
+
+      bool SymbolicEngine::hasReferences(triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::set<triton::ast::AbstractNode*> visited;
+
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          node = worklist.back();
+          worklist.pop_back();
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE)
+            return true;
+
+          if (!visited.insert(node).second)
+            continue;
+
+          const std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+          worklist.insert(worklist.end(), childs.begin(), childs.end());
+        }
+
+        return false;
+      }
+
+
+      /* Indexes the expressions referenced by the AST of an expression */
+      void SymbolicEngine::indexSymbolicExpression(triton::usize symExprId) const {
+        std::map<triton::usize, SymbolicExpression*>::const_iterator expr = this->symbolicExpressions.find(symExprId);
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::set<triton::ast::AbstractNode*> visited;
+
+        if (expr == this->symbolicExpressions.end() || this->expressionDependencies.find(symExprId) != this->expressionDependencies.end())
+          return;
+
+        std::set<triton::usize>& dependencies = this->expressionDependencies[symExprId];
+
+        /* Only the partial AST is walked, the walk stops at the references */
+        worklist.push_back(expr->second->getAst());
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (!visited.insert(node).second)
+            continue;
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            dependencies.insert(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+            continue;
+          }
+
+          std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+          for (triton::usize index = 0; index < childs.size(); index++)
+            worklist.push_back(childs[index]);
+        }
+
+        for (std::set<triton::usize>::const_iterator it = dependencies.begin(); it != dependencies.end(); it++)
+          this->expressionDependents[*it].insert(symExprId);
+      }
+
+
+      void SymbolicEngine::indexSymbolicExpressions(void) const {
+        std::map<triton::usize, SymbolicExpression*>::const_iterator it;
+
+        for (it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++)
+          this->indexSymbolicExpression(it->first);
+      }
+
+
+      /* Removes an expression from the index, it is indexed again by the next slice which reaches it */
+      void SymbolicEngine::unindexSymbolicExpression(triton::usize symExprId) {
+        std::map<triton::usize, std::set<triton::usize>>::iterator it = this->expressionDependencies.find(symExprId);
+
+        if (it == this->expressionDependencies.end())
+          return;
+
+        for (std::set<triton::usize>::const_iterator dep = it->second.begin(); dep != it->second.end(); dep++) {
+          std::map<triton::usize, std::set<triton::usize>>::iterator dependents = this->expressionDependents.find(*dep);
+          if (dependents == this->expressionDependents.end())
+            continue;
+          dependents->second.erase(symExprId);
+          if (dependents->second.empty())
+            this->expressionDependents.erase(dependents);
+        }
+
+        this->expressionDependencies.erase(it);
+      }
+
+
+      /* Returns the expressions reachable from an expression, without building its full AST */
+      std::map<triton::usize, SymbolicExpression*> SymbolicEngine::sliceExpressions(triton::usize symExprId) const {
+        std::map<triton::usize, SymbolicExpression*> ret;
+        std::vector<triton::usize> worklist(1, symExprId);
+
+        if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): symbolic expression id not found");
+
+        while (!worklist.empty()) {
+          triton::usize id = worklist.back();
+          worklist.pop_back();
+
+          if (ret.find(id) != ret.end())
+            continue;
+
+          /* The expression has been removed */
+          std::map<triton::usize, SymbolicExpression*>::const_iterator expr = this->symbolicExpressions.find(id);
+          if (expr == this->symbolicExpressions.end())
+            continue;
+
+          ret[id] = expr->second;
+
+          this->indexSymbolicExpression(id);
+          const std::set<triton::usize>& dependencies = this->expressionDependencies.at(id);
+          worklist.insert(worklist.end(), dependencies.begin(), dependencies.end());
+        }
+
+        return ret;
+      }
+
+
+      /* Returns the variables reachable from an expression, each node holds the variables of its tree */
+      std::map<triton::usize, SymbolicVariable*> SymbolicEngine::getSymbolicVariablesFromExpression(triton::usize symExprId) const {
+        std::map<triton::usize, SymbolicVariable*> ret;
+        std::map<triton::usize, SymbolicExpression*>::const_iterator expr = this->symbolicExpressions.find(symExprId);
+
+        if (expr == this->symbolicExpressions.end())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariablesFromExpression(): symbolic expression id not found");
+
+        const std::vector<triton::usize>& variables = expr->second->getAst()->getVariables();
+        for (std::vector<triton::usize>::const_iterator it = variables.begin(); it != variables.end(); it++) {
+          std::map<triton::usize, SymbolicVariable*>::const_iterator var = this->symbolicVariables.find(*it);
+          if (var != this->symbolicVariables.end())
+            ret[*it] = var->second;
+        }
+
+        return ret;
+      }
+
+
       /* Returns a list which contains all tainted expressions */
       std::list<SymbolicExpression*> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
         std::map<triton::usize, SymbolicExpression*>::const_iterator it;
@@ -435,6 +935,29 @@ namespace triton {
         for(it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
           stream << triton::ast::declareFunction(it->second->getName(), triton::ast::bvdecl(it->second->getSize()));
 
+        /* The memory array, indexed by addresses */
+        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::MEMORY_ARRAY))
+          stream << "(declare-fun " << triton::ast::MEMORY_ARRAY_NAME << " () (Array (_ BitVec " << triton::api.cpuRegisterBitSize() << ") (_ BitVec " << BYTE_SIZE_BIT << ")))";
+
+        return stream.str();
+      }
+
+
+      /* Returns the variables declaration of the symbolic variables of a node */
+      std::string SymbolicEngine::getVariablesDeclaration(triton::ast::AbstractNode* node) const {
+        const std::vector<triton::usize>& variables = node->getVariables();
+        std::stringstream stream;
+
+        for (std::vector<triton::usize>::const_iterator it = variables.begin(); it != variables.end(); it++) {
+          std::map<triton::usize, SymbolicVariable*>::const_iterator var = this->symbolicVariables.find(*it);
+          if (var != this->symbolicVariables.end())
+            stream << triton::ast::declareFunction(var->second->getName(), triton::ast::bvdecl(var->second->getSize()));
+        }
+
+        /* The memory array, indexed by addresses */
+        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::MEMORY_ARRAY))
+          stream << "(declare-fun " << triton::ast::MEMORY_ARRAY_NAME << " () (Array (_ BitVec " << triton::api.cpuRegisterBitSize() << ") (_ BitVec " << BYTE_SIZE_BIT << ")))";
+
         return stream.str();
       }
 
@@ -466,6 +989,11 @@ namespace triton {
       }
 
 
+      const std::map<triton::uint64, triton::usize>& SymbolicEngine::getSymbolicMemoryReferences(void) const {
+        return this->memoryReference;
+      }
+
+
       /*
        * Converts an expression id to a symbolic variable.
        * e.g:
@@ -592,6 +1120,7 @@ namespace triton {
         if (symVar == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
+        symVar->acquire();
         this->symbolicVariables[uniqueId] = symVar;
         return symVar;
       }
@@ -616,9 +1145,34 @@ namespace triton {
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
         std::list<triton::ast::AbstractNode*> opVec;
 
+        /*
+         * Symbolic optimization
+         * A symbolized address selects the cells of the memory array around its concrete
+         * value. Out of this window, the address is concretized.
+         */
+        triton::ast::AbstractNode* index = this->getMemoryArrayIndex(mem);
+        if (index != nullptr) {
+          triton::uint64 lower = 0;
+          triton::uint64 upper = 0;
+          triton::uint32 size  = mem.getSize();
+
+          getMemoryArrayBounds(mem.getAddress(), size, this->memoryArrayWindow, lower, upper);
+          triton::ast::AbstractNode* array = this->buildMemoryArray(lower, (upper - lower) + size);
+
+          for (triton::uint32 byte = size; byte > 0; byte--)
+            opVec.push_back(triton::ast::select(array, triton::ast::bvadd(index, triton::ast::bv(byte - 1, index->getBitvectorSize()))));
+
+          return triton::ast::ite(
+                   getMemoryArrayGuard(index, lower, upper),
+                   (size == BYTE_SIZE) ? opVec.front() : triton::ast::concat(opVec),
+                   this->buildSymbolicMemory(triton::arch::MemoryAccess(mem.getAddress(), size))
+                 );
+        }
+
         triton::ast::AbstractNode* tmp            = nullptr;
         triton::uint64 address                    = mem.getAddress();
         triton::uint32 size                       = mem.getSize();
+        bool symbolized                           = true;
         triton::usize symMem                      = triton::engines::symbolic::UNSET;
         triton::uint8 concreteValue[DQQWORD_SIZE] = {0};
         triton::uint512 value                     = triton::api.getConcreteMemoryValue(mem);
@@ -644,6 +1198,7 @@ namespace triton {
           else {
             tmp = triton::ast::bv(concreteValue[size - 1], BYTE_SIZE_BIT);
             opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            symbolized = false;
           }
           size--;
         }
@@ -663,6 +1218,16 @@ namespace triton {
             break;
         }
 
+        /*
+         * Symbolic optimization
+         * A load made only of symbolic cells is recorded as aligned, the next loads of the
+         * same range reuse it until a store or a concretization overlaps it. Concrete cells
+         * are not cached as the concrete memory may change without the symbolic engine.
+         * A load never evicts the entries it overlaps, they are still valid.
+         */
+        if (symbolized && triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY) && !this->isAlignedMemoryOverlapped(mem.getAddress(), mem.getSize()))
+          this->addAlignedMemory(mem.getAddress(), mem.getSize(), tmp);
+
         return tmp;
       }
 
@@ -710,25 +1275,68 @@ namespace triton {
         triton::ast::AbstractNode* tmp = nullptr;
         std::list<triton::ast::AbstractNode*> ret;
 
-        SymbolicExpression* se   = nullptr;
-        triton::uint64 address   = mem.getAddress();
-        triton::uint32 writeSize = mem.getSize();
+        SymbolicExpression* se           = nullptr;
+        triton::uint64 address           = mem.getAddress();
+        triton::uint32 writeSize         = mem.getSize();
+        triton::ast::AbstractNode* index = this->getMemoryArrayIndex(mem);
+        triton::ast::AbstractNode* array = nullptr;
+        triton::ast::AbstractNode* guard = nullptr;
+        triton::uint64 lower             = address;
+        triton::uint64 upper             = address;
+
+        /*
+         * Symbolic optimization
+         * A symbolized address stores the bytes into the memory array around its concrete
+         * value, then every cell of this window selects its new value from the array.
+         * Out of the window, the address is concretized.
+         */
+        if (index != nullptr) {
+          getMemoryArrayBounds(address, writeSize, this->memoryArrayWindow, lower, upper);
+          array = this->buildMemoryArray(lower, (upper - lower) + writeSize);
+          guard = getMemoryArrayGuard(index, lower, upper);
+          for (triton::uint32 byte = 0; byte < writeSize; byte++) {
+            tmp   = triton::ast::extract(((byte + 1) * BYTE_SIZE_BIT) - 1, byte * BYTE_SIZE_BIT, node);
+            array = triton::ast::store(array, triton::ast::bvadd(index, triton::ast::bv(byte, index->getBitvectorSize())), tmp);
+          }
+          this->removeAlignedMemory(lower, static_cast<triton::uint32>((upper - lower) + writeSize));
+        }
 
         /* Record the aligned memory for a symbolic optimization */
-        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+        else if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
+        /* The cells of the window which are not written at the concrete address */
+        for (triton::uint64 cell = lower; array != nullptr && cell < upper + writeSize; cell++) {
+          if (cell >= address && cell < address + writeSize)
+            continue;
+          triton::ast::AbstractNode* old = this->buildSymbolicMemory(triton::arch::MemoryAccess(cell, BYTE_SIZE));
+          tmp = triton::ast::ite(guard, triton::ast::select(array, triton::ast::bv(cell, index->getBitvectorSize())), old);
+          se  = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
+          se->setOriginMemory(triton::arch::MemoryAccess(cell, BYTE_SIZE, tmp->evaluate()));
+          inst.addSymbolicExpression(se);
+          this->recordUnreferencedExpression(se);
+          this->addMemoryReference(cell, se->getId());
+        }
+
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
          * memory must be assigned to an unique reference.
          */
         while (writeSize) {
-          /* Extract each byte of the memory */
-          tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
+          /* Extract each byte of the memory, a byte node is already the byte */
+          if (node->getBitvectorSize() == BYTE_SIZE_BIT)
+            tmp = node;
+          else
+            tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
+          if (array != nullptr)
+            tmp = triton::ast::ite(guard, triton::ast::select(array, triton::ast::bv((address + writeSize) - 1, index->getBitvectorSize())), tmp);
           se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
           se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
           ret.push_back(tmp);
           inst.addSymbolicExpression(se);
+          /* Remove the previous byte reference if it has never been used */
+          this->removeDeadExpression(this->getSymbolicMemoryId((address + writeSize) - 1));
+          this->recordUnreferencedExpression(se);
           /* Assign memory with little endian */
           this->addMemoryReference((address + writeSize) - 1, se->getId());
           /* continue */
@@ -813,6 +1421,8 @@ namespace triton {
         reg.setConcreteValue(node->evaluate());
         parentReg.setConcreteValue(finalExpr->evaluate());
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(finalExpr, triton::engines::symbolic::REG, comment);
+        this->removeDeadExpression(this->getSymbolicRegisterId(parentReg));
+        this->recordUnreferencedExpression(se);
         this->assignSymbolicExpressionToRegister(se, parentReg);
         inst.addSymbolicExpression(se);
         inst.setWrittenRegister(reg, node);
@@ -827,6 +1437,8 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicFlagExpression(): The register must be a flag.");
         flag.setConcreteValue(node->evaluate());
         triton::engines::symbolic::SymbolicExpression *se = this->newSymbolicExpression(node, triton::engines::symbolic::REG, comment);
+        this->removeDeadExpression(this->getSymbolicRegisterId(flag));
+        this->recordUnreferencedExpression(se);
         this->assignSymbolicExpressionToRegister(se, flag);
         inst.addSymbolicExpression(se);
         inst.setWrittenRegister(flag, node);
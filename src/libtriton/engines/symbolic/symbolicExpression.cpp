@@ -22,6 +22,7 @@ namespace triton {
         this->id            = id;
         this->isTainted     = false;
         this->kind          = kind;
+        this->owners        = 0;
       }
 
 
@@ -54,7 +55,8 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION ||
+            triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
         else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
@@ -69,7 +71,8 @@ namespace triton {
         if (this->getComment().empty())
           return "";
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION ||
+                 triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "; " + this->getComment();
 
         else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
@@ -99,6 +102,9 @@ namespace triton {
         node->setParent(this->ast->getParents());
         this->ast = node;
         this->ast->init();
+
+        /* The expressions and the variables referenced may have changed */
+        triton::api.getSymbolicEngine()->unindexSymbolicExpression(this->id);
       }
 
 
@@ -117,6 +123,18 @@ namespace triton {
       }
 
 
+      void SymbolicExpression::acquire(void) {
+        this->owners++;
+      }
+
+
+      bool SymbolicExpression::release(void) {
+        if (this->owners == 0)
+          throw triton::exceptions::SymbolicExpression("SymbolicExpression::release(): The expression has no owner.");
+        return (--this->owners == 0);
+      }
+
+
       bool SymbolicExpression::isRegister(void) const {
         return (this->kind == triton::engines::symbolic::REG);
       }
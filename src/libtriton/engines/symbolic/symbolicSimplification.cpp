@@ -112,6 +112,25 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+Calling a Python function for every new symbolic expression is expensive. Two mechanisms reduce this cost.
+First, a simplification callback may be restricted to the kinds of root node it is able to rewrite. The callback
+is then only called for these roots.
+
+~~~~~~~~~~~~~{.py}
+addCallback(xor_bitwise, SYMBOLIC_SIMPLIFICATION, [AST_NODE.BVOR])
+~~~~~~~~~~~~~
+
+Second, a `SYMBOLIC_SIMPLIFICATION_BATCH` callback receives in a single call the list of roots of all expressions
+created by an instruction (or by a basic block, see `enableSymbolicSimplificationBatchPerBlock()`), and must return
+a list of the same length. The returned nodes are assigned to their expressions.
+
+~~~~~~~~~~~~~{.py}
+def batch(nodes):
+    return [xor_bitwise(node) for node in nodes]
+
+addCallback(batch, SYMBOLIC_SIMPLIFICATION_BATCH, [AST_NODE.BVOR])
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -167,7 +186,8 @@ namespace triton {
 
 
       SymbolicSimplification::SymbolicSimplification() {
-        this->z3Enabled = false;
+        this->batchPerBlock = false;
+        this->z3Enabled     = false;
       }
 
 
@@ -181,7 +201,8 @@ namespace triton {
 
 
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
-        this->z3Enabled = other.z3Enabled;
+        this->batchPerBlock = other.batchPerBlock;
+        this->z3Enabled     = other.z3Enabled;
       }
 
 
@@ -195,6 +216,16 @@ namespace triton {
       }
 
 
+      bool SymbolicSimplification::isSimplificationBatchPerBlockEnabled(void) const {
+        return this->batchPerBlock;
+      }
+
+
+      void SymbolicSimplification::enableSimplificationBatchPerBlock(bool flag) {
+        this->batchPerBlock = flag;
+      }
+
+
       triton::ast::AbstractNode* SymbolicSimplification::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
 
         if (node == nullptr)
@@ -29,6 +29,7 @@ namespace triton {
         this->name             = TRITON_SYMVAR_NAME + std::to_string(id);
         this->size             = size;
         this->concreteValue    = concreteValue;
+        this->owners           = 0;
 
         if (this->size > MAX_BITS_SUPPORTED)
           throw triton::exceptions::SymbolicVariable("SymbolicVariable::SymbolicVariable(): Size connot be greater than MAX_BITS_SUPPORTED.");
@@ -43,6 +44,7 @@ namespace triton {
         this->name             = copy.name;
         this->size             = copy.size;
         this->concreteValue    = copy.concreteValue;
+        this->owners           = 0;
       }
 
 
@@ -99,6 +101,18 @@ namespace triton {
       }
 
 
+      void SymbolicVariable::acquire(void) {
+        this->owners++;
+      }
+
+
+      bool SymbolicVariable::release(void) {
+        if (this->owners == 0)
+          throw triton::exceptions::SymbolicVariable("SymbolicVariable::release(): The variable has no owner.");
+        return (--this->owners == 0);
+      }
+
+
       std::ostream& operator<<(std::ostream& stream, const SymbolicVariable& symVar) {
         stream << symVar.getName() << ":" << symVar.getSize();
         return stream;
@@ -12,6 +12,7 @@
 #include "ast.hpp"
 #include "astGarbageCollector.hpp"
 #include "astRepresentation.hpp"
+#include "astRules.hpp"
 #include "callbacks.hpp"
 #include "immediate.hpp"
 #include "instruction.hpp"
@@ -19,6 +20,7 @@
 #include "operandWrapper.hpp"
 #include "register.hpp"
 #include "solverEngine.hpp"
+#include "summaryEngine.hpp"
 #include "symbolicEngine.hpp"
 #include "taintEngine.hpp"
 #include "tritonTypes.hpp"
@@ -56,15 +58,24 @@ namespace triton {
         //! The solver engine.
         triton::engines::solver::SolverEngine* solver;
 
+        //! The summary engine.
+        triton::engines::summary::SummaryEngine* summary;
+
         //! The AST garbage collector interface.
         triton::ast::AstGarbageCollector* astGarbageCollector;
 
         //! The AST representation interface.
         triton::ast::representations::AstRepresentation* astRepresentation;
 
+        //! The AST rewriting rules applied at construction time.
+        triton::ast::AstRules* astRules;
+
         //! The Callbacks interface.
         triton::callbacks::Callbacks callbacks;
 
+        //! True if the state is frozen. \sa freeze().
+        bool frozen;
+
       public:
         //! Constructor of the API.
         API();
@@ -122,6 +133,9 @@ namespace triton {
          */
         std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getCpuRegInformation(triton::uint32 reg) const;
 
+        //! [**architecture api**] - Returns the shared specification of the register. The reference stays valid when the architecture changes.
+        const triton::arch::RegisterSpecification& getCpuRegSpecification(triton::uint32 reg) const;
+
         //! [**architecture api**] - Returns all registers. \sa triton::arch::x86::registers_e.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
 
@@ -210,6 +224,32 @@ namespace triton {
 
 
 
+        /* Frozen state API ============================================================================== */
+
+        /*!
+         * \brief [**frozen state api**] - Freezes the state once a trace is processed.
+         *
+         * \description All reference nodes are replaced by the ASTs they refer to, then every
+         * method which modifies the state raises an exception. Queries (full ASTs, models, taint,
+         * concrete and symbolic values) may be called concurrently by several threads and concrete
+         * callbacks are no longer processed. Reading the frozen state takes no lock, but building
+         * a new AST node (e.g. the constraint given to getModel()) takes the mutex of the AST garbage
+         * collector. Existing nodes are never modified: a new node is not recorded as a parent of its
+         * childs, setChild() raises an exception and getFullAst() raises one if the node holds reference nodes.
+         */
+        void freeze(void);
+
+        //! [**frozen state api**] - Unfreezes the state and puts back the reference nodes, the queries are no longer thread-safe. \sa freeze().
+        void unfreeze(void);
+
+        //! [**frozen state api**] - Returns true if the state is frozen. \sa freeze().
+        bool isFrozen(void) const;
+
+        //! [**frozen state api**] - Raises an exception if the state is frozen.
+        void checkFrozen(void) const;
+
+
+
         /* AST Garbage Collector API ===================================================================== */
 
         //! [**AST garbage collector api**] - Raises an exception if the AST garbage collector interface is not initialized.
@@ -230,6 +270,15 @@ namespace triton {
         //! [**AST garbage collector api**] - Records a variable AST node.
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
+        //! [**AST garbage collector api**] - Records a sorted set of symbolic variable ids and returns the instance shared by the nodes.
+        const std::vector<triton::usize>* recordVariableSet(const std::vector<triton::usize>& variables);
+
+        //! [**AST garbage collector api**] - A node holds a shared set of symbolic variable ids.
+        void acquireVariableSet(const std::vector<triton::usize>* variables);
+
+        //! [**AST garbage collector api**] - A node does not hold a shared set of symbolic variable ids anymore.
+        void releaseVariableSet(const std::vector<triton::usize>* variables);
+
         //! [**AST garbage collector api**] - Returns all allocated nodes.
         const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
 
@@ -263,6 +312,28 @@ namespace triton {
 
 
 
+        /* AST Rules API ================================================================================= */
+
+        //! [**AST rules api**] - Raises an exception if the AST rules interface is not initialized.
+        void checkAstRules(void) const;
+
+        //! [**AST rules api**] - Returns the instance of the AST rules.
+        triton::ast::AstRules* getAstRules(void);
+
+        //! [**AST rules api**] - Enables or disables a rule applied when AST nodes are built. Only triton::ast::CONSTANT_FOLDING is enabled by default.
+        void enableAstRule(enum triton::ast::rule_e rule, bool flag);
+
+        //! [**AST rules api**] - Returns true if the rule is enabled.
+        bool isAstRuleEnabled(enum triton::ast::rule_e rule) const;
+
+        //! [**AST rules api**] - Returns the number of times each rule has been applied.
+        std::map<std::string, triton::usize> getAstRulesStats(void) const;
+
+        //! [**AST rules api**] - Resets the hit counters of the rules.
+        void clearAstRulesStats(void);
+
+
+
         /* Callbacks API ================================================================================= */
 
         //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_VALUE callback.
@@ -274,11 +345,17 @@ namespace triton {
         //! [**callbacks api**] - Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Adds a SYMBOLIC_SIMPLIFICATION_BATCH callback.
+        void addCallback(triton::callbacks::symbolicSimplificationBatchCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
-        //! [**callbacks api**] - Adds a python callback.
-        void addCallback(PyObject* function, triton::callbacks::callback_e kind);
+        //! [**callbacks api**] - Adds a python callback. Simplification callbacks only receive root nodes whose kind is in `filter` (all kinds if empty).
+        void addCallback(PyObject* function, triton::callbacks::callback_e kind, const std::set<triton::ast::kind_e>& filter=std::set<triton::ast::kind_e>());
         #endif
 
+        //! [**callbacks api**] - Returns true if at least one callback of this kind is recorded.
+        bool hasCallbacks(triton::callbacks::callback_e kind) const;
+
         //! [**callbacks api**] - Removes all recorded callbacks.
         void removeAllCallbacks(void);
 
@@ -291,6 +368,9 @@ namespace triton {
         //! [**callbacks api**] - Deletes a SYMBOLIC_SIMPLIFICATION callback.
         void removeCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Deletes a SYMBOLIC_SIMPLIFICATION_BATCH callback.
+        void removeCallback(triton::callbacks::symbolicSimplificationBatchCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! [**callbacks api**] - Deletes a python callback according to its kind.
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
@@ -299,12 +379,39 @@ namespace triton {
         //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
         triton::ast::AbstractNode* processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const;
 
+        //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, std::vector<triton::ast::AbstractNode*>& nodes) const;
+
         //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const;
 
         //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
 
+        //! [**callbacks api**] - Processes GET_CONCRETE_MEMORY_VALUE callbacks for a whole memory area.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const;
+
+        //! [**callbacks api**] - Enables or disables the memoization of GET_CONCRETE_MEMORY_VALUE and GET_CONCRETE_REGISTER_VALUE callbacks.
+        void enableConcreteCallbacksCache(bool flag);
+
+        //! [**callbacks api**] - Returns true if concrete value callbacks are memoized.
+        bool isConcreteCallbacksCacheEnabled(void) const;
+
+        //! [**callbacks api**] - Drops memoized results at each new instruction (default) or only when clearConcreteCallbacksCache() is called.
+        void enableConcreteCallbacksCachePerInstruction(bool flag);
+
+        //! [**callbacks api**] - Returns true if memoized results are dropped at each new instruction.
+        bool isConcreteCallbacksCachePerInstructionEnabled(void) const;
+
+        //! [**callbacks api**] - Drops all memoized results of concrete value callbacks (starts a new epoch).
+        void clearConcreteCallbacksCache(void);
+
+        //! [**callbacks api**] - Drops the memoized results of a memory access. Writes through the API do it automatically.
+        void invalidateConcreteCallbacksCache(const triton::arch::MemoryAccess& mem);
+
+        //! [**callbacks api**] - Drops the memoized results of a register. Writes through the API do it automatically.
+        void invalidateConcreteCallbacksCache(const triton::arch::Register& reg);
+
 
 
         /* Symbolic engine API =========================================================================== */
@@ -327,6 +434,9 @@ namespace triton {
         //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined.
         std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> getSymbolicMemory(void) const;
 
+        //! [**symbolic api**] - Returns the map (<Addr : SymExpr id>) of symbolic memory defined, without copy.
+        const std::map<triton::uint64, triton::usize>& getSymbolicMemoryReferences(void) const;
+
         //! [**symbolic api**] - Returns the symbolic expression id corresponding to the memory address.
         triton::usize getSymbolicMemoryId(triton::uint64 addr) const;
 
@@ -432,6 +542,9 @@ namespace triton {
         //! [**symbolic api**] - Returns the logical conjunction AST of path constraints.
         triton::ast::AbstractNode* getPathConstraintsAst(void);
 
+        //! [**symbolic api**] - Returns the logical conjunction AST of the first `count` path constraints.
+        triton::ast::AbstractNode* getPathConstraintsPrefixAst(triton::usize count);
+
         //! [**symbolic api**] - Adds a path constraint.
         void addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr);
 
@@ -444,6 +557,12 @@ namespace triton {
         //! [**symbolic api**] - Enabled, Triton will use the simplification passes of z3 before to call its recorded simplification passes.
         void enableSymbolicZ3Simplification(bool flag);
 
+        //! [**symbolic api**] - Enabled, SYMBOLIC_SIMPLIFICATION_BATCH callbacks are called once per basic block instead of once per instruction.
+        void enableSymbolicSimplificationBatchPerBlock(bool flag);
+
+        //! [**symbolic api**] - Calls the SYMBOLIC_SIMPLIFICATION_BATCH callbacks on all expressions created since the last flush.
+        void flushSymbolicSimplifications(void);
+
         //! [**symbolic api**] - Enables or disables a symbolic optimization.
         void enableSymbolicOptimization(enum triton::engines::symbolic::optimization_e opti, bool flag);
 
@@ -453,6 +572,9 @@ namespace triton {
         //! [**symbolic api**] - Returns true if Triton can use the simplification passes of z3.
         bool isSymbolicZ3SimplificationEnabled(void) const;
 
+        //! [**symbolic api**] - Returns true if SYMBOLIC_SIMPLIFICATION_BATCH callbacks are called once per basic block.
+        bool isSymbolicSimplificationBatchPerBlockEnabled(void) const;
+
         //! [**symbolic api**] - Returns true if the symbolic expression ID exists.
         bool isSymbolicExpressionIdExists(triton::usize symExprId) const;
 
@@ -483,6 +605,12 @@ namespace triton {
         //! [**symbolic api**] - Returns the full AST from a symbolic expression id.
         triton::ast::AbstractNode* getFullAstFromId(triton::usize symExprId);
 
+        //! [**symbolic api**] - Returns the backward slice of a symbolic expression as a map of <SymExprId : SymExpr>, without building its full AST.
+        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> sliceExpressions(triton::usize symExprId) const;
+
+        //! [**symbolic api**] - Returns the symbolic variables reachable from a symbolic expression as a map of <SymVarId : SymVar>.
+        std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*> getSymbolicVariablesFromExpression(triton::usize symExprId) const;
+
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
@@ -495,6 +623,9 @@ namespace triton {
         //! [**symbolic api**] - Returns all variable declarations representation.
         std::string getVariablesDeclaration(void) const;
 
+        //! [**symbolic api**] - Returns the declarations of the symbolic variables of a node only.
+        std::string getVariablesDeclaration(triton::ast::AbstractNode* node) const;
+
 
 
         /* Solver engine API ============================================================================= */
@@ -508,8 +639,11 @@ namespace triton {
          * \description
          * **item1**: symbolic variable id<br>
          * **item2**: model
+         *
+         * If `status` is not null, it receives the result of the query. A `timeout` (ms) of 0 uses the default timeout.
+         * The query is sent to the `backend`, the default one if `BACKEND_DEFAULT`.
          */
-        std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(triton::ast::AbstractNode *node) const;
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(triton::ast::AbstractNode *node, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0, triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
 
         /*!
          * \brief [**solver api**] - Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
@@ -517,14 +651,78 @@ namespace triton {
          * \description
          * **item1**: symbolic variable id<br>
          * **item2**: model
+         *
+         * If `status` is not null, it receives the result of the last check. The `timeout` (ms) bounds the whole enumeration, 0 uses the default timeout.
+         * The query is sent to the `backend`, the default one if `BACKEND_DEFAULT`.
          */
-        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode *node, triton::uint32 limit) const;
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode *node, triton::uint32 limit, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0, triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
+
+        /*!
+         * \brief [**solver api**] - Enumerates the models of a symbolic constraint and returns their number. Each model is given to the callback.
+         *
+         * \description
+         * The models are projected onto `variables` (ids), the variables of the constraint if empty. A `limit` of 0 is unlimited and
+         * the callback stops the enumeration by returning false. If `status` is not null, it receives the result of the last check.
+         */
+        triton::usize enumerateModels(triton::ast::AbstractNode *node, triton::engines::solver::modelCallback callback, void* data=nullptr, triton::uint32 limit=0, const std::vector<triton::usize>& variables=std::vector<triton::usize>(), triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0, triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
+
+        //! [**solver api**] - Sets the default backend of the queries.
+        void setSolverBackend(triton::engines::solver::backend_e backend);
+
+        //! [**solver api**] - Returns the default backend of the queries.
+        triton::engines::solver::backend_e getSolverBackend(void) const;
+
+        //! [**solver api**] - Returns the capabilities of a backend as a mask of triton::engines::solver::capability_e.
+        triton::uint32 getSolverCapabilities(triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
+
+        //! [**solver api**] - Sets the default timeout of the queries in milliseconds, 0 if unlimited.
+        void setSolverTimeout(triton::uint32 ms);
+
+        //! [**solver api**] - Sets the memory limit of the solver in megabytes, 0 if unlimited. The limit is shared by the whole process.
+        void setSolverMemoryLimit(triton::uint32 mb);
+
+        //! [**solver api**] - Interrupts the running queries of all threads, they return `CANCELED`. May be called from another thread.
+        void interruptSolver(void);
+
+        //! [**solver api**] - Returns the statistics of the queries (queries, sat, unsat, unknown, timeout, canceled, time_ms, max_time_ms).
+        std::map<std::string, triton::usize> getSolverStatistics(void) const;
+
+        //! [**solver api**] - Clears the statistics of the queries.
+        void resetSolverStatistics(void);
 
         //! [**solver api**] - Evaluates an AST via Z3 and returns the symbolic value.
         triton::uint512 evaluateAstViaZ3(triton::ast::AbstractNode *node) const;
 
 
 
+        /* Summary engine API ============================================================================ */
+
+        //! [**summary api**] - Raises an exception if the summary engine is not initialized.
+        void checkSummary(void) const;
+
+        //! [**summary api**] - Returns the instance of the summary engine.
+        triton::engines::summary::SummaryEngine* getSummaryEngine(void);
+
+        //! [**summary api**] - Binds a summary to the address of a routine.
+        void addSummary(triton::uint64 addr, triton::engines::summary::summary_t summary, const std::string& name="");
+
+        //! [**summary api**] - Binds the built-in summary of `name` to the address of a routine. Returns false if there is no built-in summary for this name.
+        bool addSummary(triton::uint64 addr, const std::string& name);
+
+        //! [**summary api**] - Binds the built-in summaries to the routines defined in the symbols table of a binary loaded at `base`. Returns the number of bound routines.
+        triton::usize addSummaries(const triton::format::elf::Elf& binary, triton::uint64 base=0);
+
+        //! [**summary api**] - Removes the summary bound to an address.
+        void removeSummary(triton::uint64 addr);
+
+        //! [**summary api**] - Returns true if a summary is bound to the address.
+        bool isSummarized(triton::uint64 addr) const;
+
+        //! [**summary api**] - Returns the names of the summaries as a map of <address : name>.
+        const std::map<triton::uint64, std::string>& getSummaries(void) const;
+
+
+
         /* Taint engine API ============================================================================== */
 
         //! [**taint api**] - Raises an exception if the taint engine is not initialized.
@@ -678,8 +876,13 @@ namespace triton {
         bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
     };
 
-    //! The API can be accessed as everywhere.
-    extern API api;
+    /*!
+     * \brief The API can be accessed as everywhere.
+     *
+     * \description Built with `-DTHREAD_LOCAL_API=on`, each thread has its own independent instance
+     * (architecture, engines, AST nodes and callbacks), so several traces can be processed concurrently.
+     */
+    extern TRITON_API_STORAGE API api;
 
 /*! @} End of triton namespace */
 };
@@ -110,6 +110,9 @@ namespace triton {
         */
         std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getRegisterInformation(triton::uint32 reg) const;
 
+        //! Returns the shared specification of the register.
+        const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 reg) const;
+
         //! Returns all registers.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
 
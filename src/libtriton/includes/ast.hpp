@@ -59,6 +59,15 @@ namespace triton {
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! The sorted ids of the symbolic variables of the tree, nullptr if there is none. The sets are shared by the garbage collector.
+        const std::vector<triton::usize>* variables;
+
+        //! Sets the variables of the node from the variables of its childs.
+        void spreadVariables(void);
+
+        //! Holds a shared set of variables instead of the previous one.
+        void setVariables(const std::vector<triton::usize>* variables);
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
@@ -87,6 +96,12 @@ namespace triton {
         //! Returns true if the tree contains a symbolic variable.
         bool isSymbolized(void) const;
 
+        //! Returns the sorted ids of the symbolic variables of the tree.
+        const std::vector<triton::usize>& getVariables(void) const;
+
+        //! Returns true if the tree contains the symbolic variable.
+        bool hasVariable(triton::usize symVarId) const;
+
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
@@ -130,6 +145,24 @@ namespace triton {
     };
 
 
+    //! The name of the array which models the memory (`MEMORY_ARRAY` optimization).
+    const char* const MEMORY_ARRAY_NAME = "memory";
+
+
+    //! `memory` node, an `(Array (_ BitVec <indexSize>) (_ BitVec 8))`. An array is not a bitvector, its size is 0.
+    class ArrayNode : public AbstractNode {
+      public:
+        ArrayNode(triton::uint32 indexSize);
+        ArrayNode(const ArrayNode& copy);
+        ~ArrayNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
+
+        triton::uint32 getIndexSize(void);
+    };
+
+
     //! `(assert <expr1>)` node
     class AssertNode : public AbstractNode {
       public:
@@ -619,10 +652,11 @@ namespace triton {
     };
 
 
-    //! `(and <expr1> <expr2>)`
+    //! `(and <expr1> <expr2> ...)`
     class LandNode : public AbstractNode {
       public:
         LandNode(AbstractNode* expr1, AbstractNode* expr2);
+        LandNode(std::vector<AbstractNode* > exprs);
         LandNode(const LandNode& copy);
         ~LandNode();
         virtual void init(void);
@@ -701,6 +735,30 @@ namespace triton {
     };
 
 
+    //! `(select <array> <index>)` node, reads a byte of an array
+    class SelectNode : public AbstractNode {
+      public:
+        SelectNode(AbstractNode* array, AbstractNode* index);
+        SelectNode(const SelectNode& copy);
+        ~SelectNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
+    };
+
+
+    //! `(store <array> <index> <expr>)` node, writes a byte into an array. The result is an array, its size is 0.
+    class StoreNode : public AbstractNode {
+      public:
+        StoreNode(AbstractNode* array, AbstractNode* index, AbstractNode* expr);
+        StoreNode(const StoreNode& copy);
+        ~StoreNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
+    };
+
+
     //! `((_ sign_extend sizeExt) <expr>)` node
     class SxNode : public AbstractNode {
       public:
@@ -750,6 +808,9 @@ namespace triton {
     bool operator==(AbstractNode& node1, AbstractNode& node2);
 
 
+    //! AST C++ API - array node builder
+    AbstractNode* array(triton::uint32 indexSize);
+
     //! AST C++ API - bv node builder
     AbstractNode* bv(triton::uint512 value, triton::uint32 size);
 
@@ -888,6 +949,9 @@ namespace triton {
     //! AST C++ API - land node builder
     AbstractNode* land(AbstractNode* expr1, AbstractNode* expr2);
 
+    //! AST C++ API - land node builder
+    AbstractNode* land(std::vector<AbstractNode* > exprs);
+
     //! AST C++ API - let node builder
     AbstractNode* let(std::string alias, AbstractNode* expr2, AbstractNode* expr3);
 
@@ -903,6 +967,12 @@ namespace triton {
     //! AST C++ API - assert node builder
     AbstractNode* assert_(AbstractNode* expr);
 
+    //! AST C++ API - select node builder
+    AbstractNode* select(AbstractNode* array, AbstractNode* index);
+
+    //! AST C++ API - store node builder
+    AbstractNode* store(AbstractNode* array, AbstractNode* index, AbstractNode* expr);
+
     //! AST C++ API - string node builder
     AbstractNode* string(std::string value);
 
@@ -41,6 +41,9 @@ namespace triton {
         //! Total of allocated dictionaries.
         triton::usize allocatedDictionaries;
 
+        //! Array Dictionary
+        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> arrayDictionary;
+
         //! Assert Dictionary
         std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> assertDictionary;
 
@@ -176,6 +179,12 @@ namespace triton {
         //! Reference Dictionary
         std::map<triton::usize, triton::ast::AbstractNode*> referenceDictionary;
 
+        //! Select Dictionary
+        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> selectDictionary;
+
+        //! Store Dictionary
+        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> storeDictionary;
+
         //! String Dictionary
         std::map<std::string, triton::ast::AbstractNode*> stringDictionary;
 
@@ -28,6 +28,7 @@ namespace triton {
     /*! Enumerates all kinds of node. Must be prime numbers. */
     enum kind_e {
       UNDEFINED_NODE = 0,             /*!< Unknown node */
+      ARRAY_NODE = 241,               /*!< (Array (_ BitVec x) (_ BitVec 8)) */
       ASSERT_NODE = 2,                /*!< (assert x) */
       BVADD_NODE = 3,                 /*!< (bvadd x y) */
       BVAND_NODE = 5,                 /*!< (bvand x y) */
@@ -75,6 +76,8 @@ namespace triton {
       LOR_NODE = 199,                 /*!< (or x y) */
       PARAM_NODE = 211,               /*!< (x y) */
       REFERENCE_NODE = 223,           /*!< Reference node */
+      SELECT_NODE = 251,              /*!< (select x y) */
+      STORE_NODE = 257,               /*!< (store x y z) */
       STRING_NODE = 227,              /*!< String node */
       SX_NODE = 229,                  /*!< ((_ sign_extend x) y) */
       VARIABLE_NODE = 233,            /*!< Variable node */
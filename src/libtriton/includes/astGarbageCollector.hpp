@@ -8,8 +8,11 @@
 #ifndef TRITON_ASTGARBAGECOLLECTOR_H
 #define TRITON_ASTGARBAGECOLLECTOR_H
 
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "ast.hpp"
 #include "symbolicEnums.hpp"
@@ -42,6 +45,20 @@ namespace triton {
         //! This map maintains a link between symbolic variables and their nodes.
         std::map<std::string, triton::ast::AbstractNode*> variableNodes;
 
+        //! The sets of symbolic variable ids of the nodes. A set is stored once and shared by all nodes which hold it.
+        std::set<std::vector<triton::usize>> variableSets;
+
+        //! The number of nodes which hold each set of variableSets. A set is removed with its last node.
+        std::map<const std::vector<triton::usize>*, triton::usize> variableSetOwners;
+
+        //! True if nodes may be recorded by several threads (frozen state).
+        bool concurrent;
+
+        //! Serializes the records when `concurrent` is true.
+        mutable std::mutex mutex;
+
+        //! Same as releaseVariableSet() but the caller serializes the call.
+        void removeVariableSetOwner(const std::vector<triton::usize>* variables);
 
       public:
         //! Constructor.
@@ -65,6 +82,15 @@ namespace triton {
         //! Records a variable AST node.
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
+        //! Records a sorted set of symbolic variable ids and returns the shared instance. The instance lives as long as a node acquires it.
+        const std::vector<triton::usize>* recordVariableSet(const std::vector<triton::usize>& variables);
+
+        //! A node holds a shared set of symbolic variable ids.
+        void acquireVariableSet(const std::vector<triton::usize>* variables);
+
+        //! A node does not hold a shared set of symbolic variable ids anymore. The set is removed with its last node.
+        void releaseVariableSet(const std::vector<triton::usize>* variables);
+
         //! Returns all allocated nodes.
         const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
 
@@ -79,6 +105,9 @@ namespace triton {
 
         //! Sets all variable nodes recorded.
         void setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes);
+
+        //! Enables or disables the serialization of the records, nodes may then be built by several threads.
+        void enableConcurrentRecords(bool flag);
     };
 
   /*! @} End of ast namespace */
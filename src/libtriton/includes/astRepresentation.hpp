@@ -11,6 +11,7 @@
 #include <iostream>
 #include "astPythonRepresentation.hpp"
 #include "astRepresentationInterface.hpp"
+#include "astSmtDagRepresentation.hpp"
 #include "astSmtRepresentation.hpp"
 #include "ast.hpp"
 
@@ -43,6 +44,7 @@ namespace triton {
       enum mode_e {
         SMT_REPRESENTATION,     /*!< SMT representation */
         PYTHON_REPRESENTATION,  /*!< Python representation */
+        SMT_DAG_REPRESENTATION, /*!< SMT representation with shared subterms printed once */
         LAST_REPRESENTATION
       };
 
@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTRULES_H
+#define TRITON_ASTRULES_H
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! Enumerates all rewriting rules applied when a node is built. */
+    enum rule_e {
+      CONSTANT_FOLDING = 0,   /*!< (bvop (_ bvx n) (_ bvy n)) => (_ bvz n) */
+      IDENTITY,               /*!< (bvadd x 0), (bvand x x), ((_ extract n-1 0) x), ((_ zero_extend 0) x), ... => x */
+      ABSORPTION,             /*!< (bvand x 0), (bvmul x 0) => 0 and (bvor x ~0) => ~0 */
+      EXTRACT_CONCAT,         /*!< ((_ extract h l) (concat x y)) => ((_ extract h' l') x) when bits come from one operand */
+      EXTRACT_EXTRACT,        /*!< ((_ extract h l) ((_ extract h' l') x)) => ((_ extract h+l' l+l') x) */
+      EXTENSION_CHAIN,        /*!< Merges zero/sign extend chains and extracts of their original bits */
+      XOR_SELF,               /*!< (bvxor x x) => 0 */
+      LAST_RULE
+    };
+
+    //! \class AstRules
+    /*! \brief The AST rules class applies cheap rewriting rules while a node is built, before its allocation.
+     *
+     *  \description Only CONSTANT_FOLDING is enabled by default: it replaces nodes which only take constants,
+     *  so the variables and the references of an expression are unchanged. The other rules may drop a variable
+     *  (`x & 0`) or return another kind of node (`(_ extract 31 0) x` becomes `x`), which changes the result of
+     *  the slicing, of the model projections and of the callers which match node kinds, so they are opt-in
+     *  through triton::API::enableAstRule().
+     */
+    class AstRules {
+      protected:
+        //! Enabled rules.
+        bool enabled[triton::ast::LAST_RULE];
+
+        //! Number of times each rule has been applied. Nodes of a frozen state may be built by several threads.
+        std::atomic<triton::usize> hits[triton::ast::LAST_RULE];
+
+        //! Returns true if the node is a bitvector constant.
+        bool isConstant(triton::ast::AbstractNode* node) const;
+
+        //! Returns true if the node is a bitvector constant equal to `value`.
+        bool isConstant(triton::ast::AbstractNode* node, triton::uint512 value) const;
+
+        //! Returns true if both nodes are known to represent the same expression.
+        bool isSame(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) const;
+
+        //! Returns true if both nodes are bitvectors of the same size.
+        bool isSameSize(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) const;
+
+        //! Returns the bounds of an extract node.
+        void getExtractBounds(triton::ast::AbstractNode* node, triton::uint32& high, triton::uint32& low) const;
+
+        //! Returns the extension size of a sx or zx node.
+        triton::uint32 getExtensionSize(triton::ast::AbstractNode* node) const;
+
+        //! Counts a hit for the rule and returns the rewritten node.
+        triton::ast::AbstractNode* hit(enum rule_e rule, triton::ast::AbstractNode* node);
+
+        //! Counts a constant folding hit and returns the constant, truncated to `size` bits.
+        triton::ast::AbstractNode* fold(const triton::uint512& value, triton::uint32 size);
+
+      public:
+        //! Constructor.
+        AstRules();
+
+        //! Enables or disables a rule.
+        void enable(enum rule_e rule, bool flag);
+
+        //! Returns true if the rule is enabled.
+        bool isEnabled(enum rule_e rule) const;
+
+        //! Returns the number of hits of every rule.
+        std::map<std::string, triton::usize> getStats(void) const;
+
+        //! Resets the hit counters.
+        void clearStats(void);
+
+        //! Rewrites a (bvadd x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvadd(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvand x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvand(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvlshr x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvlshr(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvmul x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvmul(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvneg x) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvneg(triton::ast::AbstractNode* expr);
+
+        //! Rewrites a (bvnot x) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvnot(triton::ast::AbstractNode* expr);
+
+        //! Rewrites a (bvor x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvor(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvshl x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvshl(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvsub x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvsub(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (bvxor x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* bvxor(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (concat x y) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* concat(triton::ast::AbstractNode* expr1, triton::ast::AbstractNode* expr2);
+
+        //! Rewrites a (concat x y z ...) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* concat(const std::vector<triton::ast::AbstractNode*>& exprs);
+
+        //! Rewrites a ((_ extract high low) x) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* extract(triton::uint32 high, triton::uint32 low, triton::ast::AbstractNode* expr);
+
+        //! Rewrites a ((_ sign_extend sizeExt) x) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* sx(triton::uint32 sizeExt, triton::ast::AbstractNode* expr);
+
+        //! Rewrites a ((_ zero_extend sizeExt) x) node. Returns nullptr if no rule matches.
+        triton::ast::AbstractNode* zx(triton::uint32 sizeExt, triton::ast::AbstractNode* expr);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTRULES_H */
@@ -0,0 +1,115 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSMTDAGREPRESENTATION_HPP
+#define TRITON_ASTSMTDAGREPRESENTATION_HPP
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "ast.hpp"
+#include "astRepresentationInterface.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The Representations namespace
+    namespace representations {
+    /*!
+     *  \ingroup ast
+     *  \addtogroup representations
+     *  @{
+     */
+
+      /*! \brief SMT representation with DAG sharing.
+       *
+       * \description Subterms referenced more than once are printed only once. They are bound with
+       * `let` when the root is a term and with `define-fun` when the root is a command (assert, compound),
+       * unless the binding would make the output longer.
+       * The printer walks the whole node itself, so its output does not depend on the representation mode
+       * of the API. The state of a print call lives on its stack, several threads may print at the same time.
+       */
+      class AstSmtDagRepresentation : public AstRepresentationInterface {
+        protected:
+          //! The state of one print call.
+          struct State {
+            //! Aliases of the shared nodes already printed.
+            std::map<triton::ast::AbstractNode*, triton::usize> aliases;
+
+            //! Number of references of each node of the root being printed.
+            std::map<triton::ast::AbstractNode*, triton::usize> references;
+          };
+
+          //! Returns true if the node is a command (assert, declare-fun, compound).
+          bool isCommand(triton::ast::AbstractNode* node) const;
+
+          //! Returns true if the node is a boolean term.
+          bool isLogical(triton::ast::AbstractNode* node) const;
+
+          //! Returns true if the node is referenced more than once and is worth an alias.
+          bool isShared(const State& state, triton::ast::AbstractNode* node) const;
+
+          //! Returns true if aliasing a shared node, whose body and definition are `body` and `definition` bytes long, does not make the output longer.
+          bool isShorter(const State& state, triton::ast::AbstractNode* node, triton::usize body, triton::usize definition, triton::usize alias) const;
+
+          //! Appends to `order` the nodes not yet visited from `root`, childs first.
+          void postOrder(triton::ast::AbstractNode* root, std::set<triton::ast::AbstractNode*>& visited, std::vector<triton::ast::AbstractNode*>& order) const;
+
+          //! Prints a leaf and returns true, or returns false if the node has childs to walk.
+          bool printLeaf(std::ostream& stream, triton::ast::AbstractNode* node) const;
+
+          //! Prints the opening of a node which has childs to walk and returns the index of its first walked child.
+          triton::usize printOpening(std::ostream& stream, triton::ast::AbstractNode* node) const;
+
+          //! Prints a node, the shared nodes already printed are replaced by their alias.
+          std::ostream& printNode(std::ostream& stream, const State& state, triton::ast::AbstractNode* root) const;
+
+          //! Prints a command and defines with `define-fun` the shared nodes it introduces.
+          std::ostream& printCommand(std::ostream& stream, State& state, triton::ast::AbstractNode* node, std::set<triton::ast::AbstractNode*>& visited) const;
+
+          //! Prints a term and binds with `let` the shared nodes it contains.
+          std::ostream& printTerm(std::ostream& stream, State& state, triton::ast::AbstractNode* node) const;
+
+          //! Prints a root node.
+          std::ostream& printRoot(std::ostream& stream, State& state, triton::ast::AbstractNode* node) const;
+
+        public:
+          //! Constructor.
+          AstSmtDagRepresentation();
+
+          //! Destructor.
+          ~AstSmtDagRepresentation();
+
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::AbstractNode* node);
+      };
+
+    /*! @} End of representations namespace */
+    };
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSMTDAGREPRESENTATION_HPP */
@@ -0,0 +1,185 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_BITBLASTSOLVER_H
+#define TRITON_BITBLASTSOLVER_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "ast.hpp"
+#include "satSolver.hpp"
+#include "solverEnums.hpp"
+#include "solverInterface.hpp"
+#include "solverModel.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      class SolverEngine;
+
+      //! \class Bitblaster
+      /*! \brief Translates bit-vector ASTs into the clauses of a SAT solver.
+       *
+       * \description A bit-vector is the vector of its literals, the least significant bit first. A logical
+       * node is a vector of one literal. The gates are folded when an input is constant and shared by hash.
+       */
+      class Bitblaster {
+        protected:
+          //! The SAT solver which receives the clauses.
+          triton::engines::solver::SatSolver& sat;
+
+          //! The literal which is always true.
+          triton::uint32 trueLit;
+
+          //! The gates already encoded, by <operator, inputs>.
+          std::map<std::tuple<triton::uint32, triton::uint32, triton::uint32, triton::uint32>, triton::uint32> gates;
+
+          //! The literals of each node already encoded.
+          std::map<triton::ast::AbstractNode*, std::vector<triton::uint32>> nodes;
+
+          //! The literals of each symbolic variable, by id.
+          std::map<triton::usize, std::vector<triton::uint32>> variables;
+
+          //! Returns a new literal.
+          triton::uint32 newLiteral(void);
+
+          //! Encodes `a & b`.
+          triton::uint32 mkAnd(triton::uint32 a, triton::uint32 b);
+
+          //! Encodes `a | b`.
+          triton::uint32 mkOr(triton::uint32 a, triton::uint32 b);
+
+          //! Encodes `a ^ b`.
+          triton::uint32 mkXor(triton::uint32 a, triton::uint32 b);
+
+          //! Encodes `c ? t : e`.
+          triton::uint32 mkIte(triton::uint32 c, triton::uint32 t, triton::uint32 e);
+
+          //! Returns the constant bit-vector of `size` bits.
+          std::vector<triton::uint32> constant(const triton::uint512& value, triton::uint32 size) const;
+
+          //! Returns `a + b + carry`.
+          std::vector<triton::uint32> add(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b, triton::uint32 carry);
+
+          //! Returns `~a`.
+          std::vector<triton::uint32> bvnot(const std::vector<triton::uint32>& a) const;
+
+          //! Returns `-a`.
+          std::vector<triton::uint32> neg(const std::vector<triton::uint32>& a);
+
+          //! Returns `a * b`.
+          std::vector<triton::uint32> mul(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b);
+
+          //! Computes the unsigned quotient and remainder of `a / b`, with the SMT-LIB semantics of a division by zero.
+          void udivrem(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b, std::vector<triton::uint32>& quotient, std::vector<triton::uint32>& remainder);
+
+          //! Returns `c ? t : e` bit per bit.
+          std::vector<triton::uint32> ite(triton::uint32 c, const std::vector<triton::uint32>& t, const std::vector<triton::uint32>& e);
+
+          //! Returns the literal of `a == b`.
+          triton::uint32 equal(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b);
+
+          //! Returns the literal of `a < b`, unsigned.
+          triton::uint32 ult(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b);
+
+          //! Returns the literal of `a < b`, signed.
+          triton::uint32 slt(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b);
+
+          //! Returns `a` shifted by `b`, the kind is BVSHL_NODE, BVLSHR_NODE or BVASHR_NODE.
+          std::vector<triton::uint32> shift(const std::vector<triton::uint32>& a, const std::vector<triton::uint32>& b, triton::ast::kind_e kind);
+
+          //! Returns the nodes which must be encoded before a node.
+          std::vector<triton::ast::AbstractNode*> getOperands(triton::ast::AbstractNode* node) const;
+
+          //! Encodes a node whose operands have already been encoded.
+          std::vector<triton::uint32> encode(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          Bitblaster(triton::engines::solver::SatSolver& sat);
+
+          //! Returns the literal which is always true.
+          triton::uint32 getTrue(void) const;
+
+          //! Encodes a node and returns its literals. Throws an exception if a node is not a bit-vector or logical node.
+          const std::vector<triton::uint32>& blast(triton::ast::AbstractNode* node);
+
+          //! Returns the literals of each symbolic variable which has been encoded, by id.
+          const std::map<triton::usize, std::vector<triton::uint32>>& getVariables(void) const;
+      };
+
+      //! \class BitblastSolver
+      /*! \brief The built-in backend of the solver engine, a bit-blaster on top of triton::engines::solver::SatSolver.
+       *
+       * \description It only handles the bit-vectors and the logical nodes (QF_BV), the memory array is not supported.
+       */
+      class BitblastSolver : public SolverInterface {
+        protected:
+          //! The solver engine which receives the statistics.
+          const triton::engines::solver::SolverEngine& engine;
+
+          //! The cancellation flags of the running queries of the process, shared by all the backends like the Z3 contexts.
+          static std::set<std::atomic<bool>*> running;
+
+          //! Protects the running queries.
+          static std::mutex mutex;
+
+        public:
+          //! Constructor.
+          BitblastSolver(const triton::engines::solver::SolverEngine& engine);
+
+          //! Destructor.
+          ~BitblastSolver();
+
+          //! Returns the name of the backend.
+          std::string getName(void) const;
+
+          //! Returns the capabilities of the backend.
+          triton::uint32 getCapabilities(void) const;
+
+          //! Enumerates the models of a symbolic constraint, projected onto some symbolic variables, and returns their number.
+          triton::usize enumerateModels(triton::ast::AbstractNode* node, const std::vector<triton::usize>& variables, triton::uint32 limit, triton::engines::solver::modelCallback callback, void* data, triton::engines::solver::status_e& status, triton::uint32 timeout) const;
+
+          //! Interrupts the running queries of all threads.
+          void interrupt(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BITBLASTSOLVER_H */
@@ -9,6 +9,10 @@
 #define TRITON_CALLBACKS_H
 
 #include <list>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
 
 #include "ast.hpp"
 #include "register.hpp"
@@ -38,9 +42,10 @@ namespace triton {
 
     /*! Enumerates all kinds callbacks. */
     enum callback_e {
-      GET_CONCRETE_MEMORY_VALUE,    /*!< Get concrete memory value callback */
-      GET_CONCRETE_REGISTER_VALUE,  /*!< Get concrete register value callback */
-      SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_VALUE,      /*!< Get concrete memory value callback */
+      GET_CONCRETE_REGISTER_VALUE,    /*!< Get concrete register value callback */
+      SYMBOLIC_SIMPLIFICATION,        /*!< Symbolic simplification callback */
+      SYMBOLIC_SIMPLIFICATION_BATCH,  /*!< Batched symbolic simplification callback */
     };
 
     /*! \brief The prototype of a GET_CONCRETE_MEMORY_VALUE callback.
@@ -64,6 +69,13 @@ namespace triton {
      */
     typedef triton::ast::AbstractNode* (*symbolicSimplificationCallback)(triton::ast::AbstractNode* node);
 
+    /*! \brief The prototype of a SYMBOLIC_SIMPLIFICATION_BATCH callback.
+     *
+     * \description The callback takes as uniq argument the roots of all symbolic expressions created since the
+     * last flush (one instruction or one basic block) and replaces in place the nodes it simplifies.
+     */
+    typedef void (*symbolicSimplificationBatchCallback)(std::vector<triton::ast::AbstractNode*>& nodes);
+
     //! \class Callbacks
     /*! \brief The callbacks class */
     class Callbacks {
@@ -77,6 +89,15 @@ namespace triton {
 
         //! [python] Callbacks for all symbolic simplifications.
         std::list<PyObject*> pySymbolicSimplificationCallbacks;
+
+        //! [python] Callbacks for all batched symbolic simplifications.
+        std::list<PyObject*> pySymbolicSimplificationBatchCallbacks;
+
+        //! [python] Kinds of root node accepted by a simplification callback, keyed by registration. No entry means all kinds.
+        std::map<std::pair<triton::callbacks::callback_e, PyObject*>, std::set<triton::ast::kind_e>> pyCallbackFilters;
+
+        //! [python] Returns true if the callback registered for `kind` accepts the root node.
+        bool isAcceptedByFilter(triton::callbacks::callback_e kind, PyObject* function, triton::ast::AbstractNode* node) const;
         #endif
 
         //! [c++] Callbacks for all concrete memory needs.
@@ -88,9 +109,30 @@ namespace triton {
         //! [c++] Callbacks for all symbolic simplifications.
         std::list<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
 
+        //! [c++] Callbacks for all batched symbolic simplifications.
+        std::list<triton::callbacks::symbolicSimplificationBatchCallback> symbolicSimplificationBatchCallbacks;
+
         //! Returns the number of callbacks recorded.
         triton::usize countCallbacks(void) const;
 
+        //! True if results of concrete value callbacks are memoized.
+        bool cacheEnabled;
+
+        //! True if the memoized results are dropped at each new instruction.
+        bool cachePerInstruction;
+
+        //! Memory addresses already served by the GET_CONCRETE_MEMORY_VALUE callbacks.
+        mutable std::set<triton::uint64> cachedMemory;
+
+        //! Registers already served by the GET_CONCRETE_REGISTER_VALUE callbacks. Maps a register id to its parent id.
+        mutable std::map<triton::uint32, triton::uint32> cachedRegisters;
+
+        //! Returns true if all bytes of the memory access have already been served.
+        bool isCached(const triton::arch::MemoryAccess& mem) const;
+
+        //! Returns true if the register has already been served.
+        bool isCached(const triton::arch::Register& reg) const;
+
       public:
         //! True if there is at least one callback defined.
         bool isDefined;
@@ -116,11 +158,17 @@ namespace triton {
         //! Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Adds a SYMBOLIC_SIMPLIFICATION_BATCH callback.
+        void addCallback(triton::callbacks::symbolicSimplificationBatchCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
-        //! Adds a python callback.
-        void addCallback(PyObject* function, triton::callbacks::callback_e kind);
+        //! Adds a python callback. Simplification callbacks only receive root nodes whose kind is in `filter` (all kinds if empty).
+        void addCallback(PyObject* function, triton::callbacks::callback_e kind, const std::set<triton::ast::kind_e>& filter=std::set<triton::ast::kind_e>());
         #endif
 
+        //! Returns true if at least one callback of this kind is recorded.
+        bool hasCallbacks(triton::callbacks::callback_e kind) const;
+
         //! Removes all recorded callbacks.
         void removeAllCallbacks(void);
 
@@ -133,6 +181,9 @@ namespace triton {
         //! Deletes a SYMBOLIC_SIMPLIFICATION callback.
         void removeCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Deletes a SYMBOLIC_SIMPLIFICATION_BATCH callback.
+        void removeCallback(triton::callbacks::symbolicSimplificationBatchCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! Deletes a python callback according to its kind.
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
@@ -141,11 +192,38 @@ namespace triton {
         //! Processes callbacks according to the kind and the C++ polymorphism.
         triton::ast::AbstractNode* processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const;
 
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, std::vector<triton::ast::AbstractNode*>& nodes) const;
+
         //! Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const;
 
         //! Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
+
+        //! Processes GET_CONCRETE_MEMORY_VALUE callbacks for a memory area, using the largest accesses possible.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const;
+
+        //! Enables or disables the memoization of concrete value callbacks.
+        void enableConcreteCallbacksCache(bool flag);
+
+        //! Returns true if the memoization of concrete value callbacks is enabled.
+        bool isConcreteCallbacksCacheEnabled(void) const;
+
+        //! Drops memoized results at each new instruction (default) or only on clearConcreteCallbacksCache().
+        void enableConcreteCallbacksCachePerInstruction(bool flag);
+
+        //! Returns true if memoized results are dropped at each new instruction.
+        bool isConcreteCallbacksCachePerInstructionEnabled(void) const;
+
+        //! Drops all memoized results and starts a new epoch.
+        void clearConcreteCallbacksCache(void);
+
+        //! Drops the memoized results of a memory area.
+        void invalidateConcreteCallbacksCache(triton::uint64 baseAddr, triton::usize size);
+
+        //! Drops the memoized results of a register and of all registers sharing its parent.
+        void invalidateConcreteCallbacksCache(const triton::arch::Register& reg);
     };
 
   /*! @} End of callbacks namespace */
@@ -85,6 +85,9 @@ namespace triton {
         */
         virtual std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getRegisterInformation(triton::uint32 reg) const = 0;
 
+        //! Returns the shared specification of a register id. The reference is never freed.
+        virtual const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 reg) const = 0;
+
         //! Returns all registers.
         virtual std::set<triton::arch::Register*> getAllRegisters(void) const = 0;
 
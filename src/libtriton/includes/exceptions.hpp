@@ -191,6 +191,30 @@ namespace triton {
     };
 
 
+    /*! \class SummaryEngine
+     *  \brief The exception class used by the summary engine. */
+    class SummaryEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        SummaryEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        SummaryEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
+    /*! \class ExplorationEngine
+     *  \brief The exception class used by the exploration engine. */
+    class ExplorationEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        ExplorationEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        ExplorationEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class API
      *  \brief The exception class used by the Triton's API. */
     class API : public triton::exceptions::Exception {
@@ -347,6 +371,18 @@ namespace triton {
     };
 
 
+    /*! \class AstRules
+     *  \brief The exception class used by the AST rewriting rules. */
+    class AstRules : public triton::exceptions::Ast {
+      public:
+        //! Constructor.
+        AstRules(const char* message) : triton::exceptions::Ast(message) {};
+
+        //! Constructor.
+        AstRules(const std::string& message) : triton::exceptions::Ast(message) {};
+    };
+
+
     /*! \class AstTranslations
      *  \brief The exception class used by all AST translations (`z3 <-> triton`). */
     class AstTranslations : public triton::exceptions::Ast {
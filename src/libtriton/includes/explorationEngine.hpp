@@ -0,0 +1,259 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_EXPLORATIONENGINE_H
+#define TRITON_EXPLORATIONENGINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "elf.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! An input, the value of each symbolic byte according to its address.
+      typedef std::map<triton::uint64, triton::uint8> input_t;
+
+      //! The prototype of a setup hook. It is called on the API of the worker once the context of a run is initialized.
+      typedef void (*setup_t)(const triton::engines::exploration::input_t& input);
+
+      //! Enumerates all search strategies of the worklist.
+      enum strategy_e {
+        STRATEGY_COVERAGE,      //!< Runs first the inputs which flip a branch toward an uncovered address.
+        STRATEGY_DFS,           //!< Runs first the last generated input.
+        STRATEGY_GENERATIONAL,  //!< Runs the inputs generation by generation, each child only flips the branches after its parent's one.
+      };
+
+      //! The top of the stack of a run.
+      const triton::uint64 STACK_BASE = 0x7ff00000;
+
+      //! The area which holds `argv`.
+      const triton::uint64 ARGV_BASE = 0x7ff10000;
+
+      //! The return address of the entry point. A run stops when it is reached.
+      const triton::uint64 EXIT_ADDRESS = 0x0effff00;
+
+      //! The addresses written into the GOT of the imported routines.
+      const triton::uint64 HOOK_BASE = 0x0f000000;
+
+      /*! \class ExplorationEngine
+       *  \brief The concolic exploration engine class.
+       *
+       * \description The engine emulates an ELF binary from its entry point (`main` by default) with
+       * symbolic inputs, negates the branches of the path constraints, asks models to the solver and
+       * runs the new inputs until the worklist is empty. Inputs and paths are deduplicated by hash.
+       * The runs are processed by a pool of workers, each one on its own API, which needs a libtriton
+       * built with `-DTHREAD_LOCAL_API=on`. Otherwise, the runs are processed on the calling thread.
+       */
+      class ExplorationEngine {
+        protected:
+          //! An entry of the worklist.
+          struct item_t {
+            //! The input to run.
+            triton::engines::exploration::input_t input;
+
+            //! Only the branches from this index are negated, the previous ones were negated by the parents.
+            triton::usize bound;
+
+            //! The address reached by the negated branch.
+            triton::uint64 target;
+          };
+
+          //! The result of a run, merged into the engine by the worker.
+          struct result_t {
+            //! The children inputs.
+            std::vector<item_t> children;
+
+            //! The addresses of the executed instructions.
+            std::set<triton::uint64> coverage;
+
+            //! The taken branches as <source, destination>.
+            std::set<std::pair<triton::uint64, triton::uint64>> branches;
+
+            //! True if the run jumped to an address which is neither mapped nor summarized.
+            bool crashed;
+
+            //! The counters of the run, merged into the statistics.
+            std::map<std::string, triton::usize> stats;
+          };
+
+          //! The binary to explore.
+          const triton::format::elf::Elf& binary;
+
+          //! The architecture of the binary.
+          triton::uint32 arch;
+
+          //! The address where the runs start.
+          triton::uint64 entry;
+
+          //! The search strategy.
+          triton::engines::exploration::strategy_e strategy;
+
+          //! The setup hook, nullptr if unused.
+          triton::engines::exploration::setup_t setup;
+
+          //! The number of workers.
+          triton::usize workers;
+
+          //! The maximum number of runs.
+          triton::usize maxIterations;
+
+          //! The maximum number of instructions of a run.
+          triton::usize maxInstructions;
+
+          //! The pending inputs.
+          std::deque<item_t> worklist;
+
+          //! The hashes of the inputs already queued.
+          std::set<triton::usize> inputHashes;
+
+          //! The hashes of the paths already explored.
+          std::set<triton::usize> pathHashes;
+
+          //! All inputs which have been run.
+          std::vector<triton::engines::exploration::input_t> inputs;
+
+          //! The inputs which jumped to an invalid address.
+          std::vector<triton::engines::exploration::input_t> crashes;
+
+          //! The addresses of the executed instructions.
+          std::set<triton::uint64> coverage;
+
+          //! The taken branches as <source, destination>.
+          std::set<std::pair<triton::uint64, triton::uint64>> branches;
+
+          //! The statistics of the exploration.
+          std::map<std::string, triton::usize> stats;
+
+          //! The number of runs started.
+          triton::usize iterations;
+
+          //! The number of runs in progress.
+          triton::usize running;
+
+          //! Protects the shared state between the workers.
+          std::mutex mutex;
+
+          //! Signals the workers when the worklist or the number of running workers changes.
+          std::condition_variable condition;
+
+          //! Returns the hash of an input.
+          static triton::usize hashInput(const triton::engines::exploration::input_t& input);
+
+          //! Queues an input if it has not been queued yet. The caller must hold the mutex.
+          void push(const item_t& item);
+
+          //! Dequeues the next input according to the search strategy. The caller must hold the mutex.
+          item_t pop(void);
+
+          //! Loads the binary and hooks its imported routines into the API of the worker.
+          void load(void);
+
+          //! Initializes the stack, the arguments and the symbolic inputs into the API of the worker.
+          void initContext(const triton::engines::exploration::input_t& input);
+
+          //! Emulates the binary until the exit address.
+          void emulate(result_t& result);
+
+          //! Negates the branches of the path constraints and computes the children inputs.
+          void expand(const item_t& item, result_t& result);
+
+          //! Processes a run on the API of the worker.
+          void run(const item_t& item, result_t& result);
+
+          //! Merges the result of a run. The caller must hold the mutex.
+          void merge(const item_t& item, const result_t& result);
+
+          //! The loop of a worker.
+          void worker(void);
+
+        public:
+          //! Constructor. The binary must live as long as the engine.
+          ExplorationEngine(const triton::format::elf::Elf& binary);
+
+          //! Destructor.
+          ~ExplorationEngine();
+
+          //! Sets the entry point of the runs.
+          void setEntryPoint(triton::uint64 addr);
+
+          //! Sets the entry point of the runs from a symbol. Returns false if the symbol is not defined.
+          bool setEntryPoint(const std::string& symbol);
+
+          //! Sets the search strategy.
+          void setStrategy(triton::engines::exploration::strategy_e strategy);
+
+          //! Sets the setup hook.
+          void setSetup(triton::engines::exploration::setup_t setup);
+
+          //! Sets the number of workers.
+          void setWorkers(triton::usize workers);
+
+          //! Sets the maximum number of runs.
+          void setMaxIterations(triton::usize limit);
+
+          //! Sets the maximum number of instructions of a run.
+          void setMaxInstructions(triton::usize limit);
+
+          //! Queues an input. All bytes of the input are symbolized.
+          void addSeed(const triton::engines::exploration::input_t& input);
+
+          //! Queues an `argv[1]` of `size` bytes filled with `value`. The entry point receives `argc` and `argv`.
+          void addArgumentSeed(triton::usize size, triton::uint8 value='A');
+
+          //! Explores the binary until the worklist is empty or the maximum number of runs is reached.
+          void explore(void);
+
+          //! Returns all inputs which have been run.
+          const std::vector<triton::engines::exploration::input_t>& getInputs(void) const;
+
+          //! Returns the inputs which jumped to an invalid address.
+          const std::vector<triton::engines::exploration::input_t>& getCrashes(void) const;
+
+          //! Returns the addresses of the executed instructions.
+          const std::set<triton::uint64>& getCoverage(void) const;
+
+          //! Returns the statistics of the exploration (runs, paths, coverage, solver).
+          std::map<std::string, triton::usize> getStats(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORATIONENGINE_H */
@@ -9,9 +9,9 @@
 #define TRITON_INSTRUCTION_H
 
 #include <list>
-#include <map>
 #include <ostream>
 #include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -19,6 +19,7 @@
 #include "memoryAccess.hpp"
 #include "operandWrapper.hpp"
 #include "register.hpp"
+#include "smallVector.hpp"
 #include "symbolicExpression.hpp"
 #include "tritonTypes.hpp"
 
@@ -51,8 +52,8 @@ namespace triton {
         //! The address of the instruction.
         triton::uint64 address;
 
-        //! The disassembly of the instruction.
-        std::stringstream disassembly;
+        //! The disassembly of the instruction. Empty until the instruction is disassembled.
+        std::string disassembly;
 
         //! The opcodes of the instruction.
         triton::uint8 opcodes[32];
@@ -99,12 +100,20 @@ namespace triton {
 
         //! A registers state
         /*!
-          \brief a map of <regId, regClass>
+          \brief a flat array of registers, one per register id. Few registers are recorded
+          per instruction, so they are looked up by a scan and kept inline.
+
+          \note API change: this member was a `std::vector`. It still provides `size()`, `empty()`,
+          `operator[]`, `begin()`, `end()`, `push_back()`, `reserve()` and `clear()`, and it converts
+          into a `std::vector` copy. A `std::vector&` bound to it must become a `triton::utils::SmallVector&`.
         */
-        std::map<triton::uint32, triton::arch::Register> registerState;
+        triton::utils::SmallVector<triton::arch::Register, 4> registerState;
 
-        //! A list of operands
-        std::vector<triton::arch::OperandWrapper> operands;
+        //! A list of operands, the three first ones are kept inline.
+        /*!
+          \note API change: this member was a `std::vector`, see `registerState`.
+        */
+        triton::utils::SmallVector<triton::arch::OperandWrapper, 3> operands;
 
         //! The semantics set of the instruction.
         std::vector<triton::engines::symbolic::SymbolicExpression*> symbolicExpressions;
@@ -211,6 +220,9 @@ namespace triton {
         //! Adds a symbolic expression
         void addSymbolicExpression(triton::engines::symbolic::SymbolicExpression* expr);
 
+        //! Releases the symbolic expressions of the instruction and clears its semantics set.
+        void clearSymbolicExpressions(void);
+
         //! Returns true if this instruction is a branch
         bool isBranch(void) const;
 
@@ -0,0 +1,110 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_LIBCSUMMARIES_H
+#define TRITON_LIBCSUMMARIES_H
+
+#include <string>
+
+#include "ast.hpp"
+#include "instruction.hpp"
+#include "operandWrapper.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Summary namespace
+    namespace summary {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup summary
+     *  @{
+     */
+
+      //! The libc namespace
+      namespace libc {
+      /*!
+       *  \ingroup summary
+       *  \addtogroup libc
+       *  @{
+       */
+
+        /*! \page libc_summaries_page libc summaries
+         *  \brief [**internal**] All information about the built-in libc summaries.
+         *
+         * \description
+         * Each summary reads its arguments according to the calling convention of the
+         * architecture (System V for x86-64, cdecl for x86), applies the effect of the routine
+         * on the symbolic memory, the registers and the taint, then returns to the caller.
+         * Pointers and sizes are taken from their concrete values. The data reached through
+         * them keep their symbolic expressions. A summary returns false, and the call is then
+         * processed instruction by instruction, when its size is above `MAX_AREA_SIZE` or when
+         * one of its pointers or sizes is symbolized, as the concretization would not be
+         * recorded in the path constraints. Only the malloc summary takes the concrete value
+         * of a symbolized size: the returned area does not depend on it.
+         *
+         * Routine | Summary
+         * --------|--------
+         * free    | Does nothing.
+         * malloc  | Returns a fresh area from the heap of the summary engine.
+         * memcpy  | Copies the bytes, overlapping areas are handled like memmove.
+         * memmove | Same as memcpy.
+         * memset  | Fills the bytes with the value.
+         * strcmp  | Returns the difference of the first mismatching bytes.
+         * strlen  | Returns the length, as an `ite` chain over the symbolic bytes.
+         */
+
+        //! The maximum size of the areas written by the memcpy and memset summaries.
+        const triton::usize MAX_AREA_SIZE = 0x100000;
+
+        //! Returns the operand which holds the nth argument of the routine.
+        triton::arch::OperandWrapper argument_s(triton::uint32 index);
+
+        //! Sets the return value and returns to the caller.
+        void return_s(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, bool tainted, const std::string& comment="");
+
+        //! The free summary.
+        bool free_s(triton::arch::Instruction& inst);
+
+        //! The malloc summary.
+        bool malloc_s(triton::arch::Instruction& inst);
+
+        //! The memcpy and memmove summary.
+        bool memcpy_s(triton::arch::Instruction& inst);
+
+        //! The memset summary.
+        bool memset_s(triton::arch::Instruction& inst);
+
+        //! The strcmp summary.
+        bool strcmp_s(triton::arch::Instruction& inst);
+
+        //! The strlen summary.
+        bool strlen_s(triton::arch::Instruction& inst);
+
+      /*! @} End of libc namespace */
+      };
+    /*! @} End of summary namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LIBCSUMMARIES_H */
@@ -57,6 +57,9 @@ namespace triton {
         //! Register constructor.
         OperandWrapper(const triton::arch::Register& reg);
 
+        //! Constructor by copy.
+        OperandWrapper(const OperandWrapper& other);
+
         //! Destructor.
         ~OperandWrapper();
 
@@ -47,6 +47,16 @@ namespace triton {
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
 
+          /*!
+           * \brief The balanced conjunctions of the taken path constraints.
+           * \description `conjunctions[level][index]` is the conjunction of the constraints `[index << level, (index + 1) << level)`.
+           * They are maintained incrementally like a binary counter and shared by all prefixes.
+           */
+          std::vector<std::vector<triton::ast::AbstractNode*>> conjunctions;
+
+          //! Adds a taken constraint to the balanced conjunctions.
+          void addConjunction(triton::ast::AbstractNode* node);
+
 
         public:
           //! Constructor.
@@ -67,6 +77,9 @@ namespace triton {
           //! Returns the logical conjunction AST of path constraints.
           triton::ast::AbstractNode* getPathConstraintsAst(void) const;
 
+          //! Returns the logical conjunction AST of the first `count` path constraints.
+          triton::ast::AbstractNode* getPathConstraintsPrefixAst(triton::usize count) const;
+
           //! Returns the number of constraints.
           triton::usize getNumberOfPathConstraints(void) const;
 
@@ -84,6 +84,9 @@ namespace triton {
       //! Initializes the AST_REPRESENTATION python namespace.
       void initAstRepresentationNamespace(PyObject* astRepresentationDict);
 
+      //! Initializes the AST_RULE python namespace.
+      void initAstRuleNamespace(PyObject* astRuleDict);
+
       //! Initializes the CALLBACK python namespace.
       void initCallbackNamespace(PyObject* callbackDict);
 
@@ -93,6 +96,9 @@ namespace triton {
       //! Initializes the ELF python namespace.
       void initElfNamespace(PyObject* elfDict);
 
+      //! Initializes the EXPLORATION python namespace.
+      void initExplorationNamespace(PyObject* explorationDict);
+
       //! Initializes the OPCODE python namespace.
       void initX86OpcodesNamespace(void);
 
@@ -108,6 +114,9 @@ namespace triton {
       //! Initializes the OPTIMIZATION python namespace.
       void initSymOptiNamespace(PyObject* symOptiDict);
 
+      //! Initializes the SOLVER python namespace.
+      void initSolverNamespace(PyObject* solverDict);
+
       //! Initializes the SYMEXPR python namespace.
       void initSymExprNamespace(PyObject* symExprDict);
 
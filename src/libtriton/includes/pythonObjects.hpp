@@ -20,6 +20,7 @@
 #include "elfRelocationTable.hpp"
 #include "elfSectionHeader.hpp"
 #include "elfSymbolTable.hpp"
+#include "explorationEngine.hpp"
 #include "immediate.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
@@ -91,8 +92,11 @@ namespace triton {
       //! Creates the ElfSymbolTable python class.
       PyObject* PyElfSymbolTable(const triton::format::elf::ElfSymbolTable& sym);
 
+      //! Creates the ExplorationEngine python class. The engine keeps a reference on `binary`.
+      PyObject* PyExplorationEngine(PyObject* binary);
+
       //! Creates the Immediate python class.
-      PyObject* PyImmediate(const triton::arch::Immediate& imm);
+      PyObject* PyImmediate(const triton::arch::Immediate& imm, bool readOnly=false);
 
       //! Creates the Instruction python class.
       PyObject* PyInstruction(void);
@@ -100,14 +104,17 @@ namespace triton {
       //! Creates the Instruction python class.
       PyObject* PyInstruction(const triton::arch::Instruction& inst);
 
+      //! Releases the cached accessor results of an Instruction python object. Must be called before the instruction is modified.
+      void PyInstruction_Invalidate(PyObject* self);
+
       //! Creates the Memory python class.
-      PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem);
+      PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem, bool readOnly=false);
 
       //! Creates the PathConstraint python class.
       PyObject* PyPathConstraint(const triton::engines::symbolic::PathConstraint& pc);
 
       //! Creates the Register python class.
-      PyObject* PyRegister(const triton::arch::Register& reg);
+      PyObject* PyRegister(const triton::arch::Register& reg, bool readOnly=false);
 
       //! Creates the SolverModel python class.
       PyObject* PySolverModel(const triton::engines::solver::SolverModel& model);
@@ -115,6 +122,12 @@ namespace triton {
       //! Creates the SymbolicExpression python class.
       PyObject* PySymbolicExpression(triton::engines::symbolic::SymbolicExpression* expr);
 
+      //! Creates the SymbolicMapView python class. \sa symbolic_map_view_e.
+      PyObject* PySymbolicMapView(triton::uint32 kind);
+
+      //! Creates the SymbolicMapViewIterator python class. \sa symbolic_map_iterator_e.
+      PyObject* PySymbolicMapViewIterator(triton::uint32 kind, triton::uint32 mode);
+
       //! Creates the SymbolicVariable python class.
       PyObject* PySymbolicVariable(triton::engines::symbolic::SymbolicVariable* symVar);
 
@@ -218,12 +231,25 @@ namespace triton {
       //! pyElfSymbolTable type.
       extern PyTypeObject ElfSymbolTable_Type;
 
+      /* ExplorationEngine ============================================== */
+
+      //! pyExplorationEngine object.
+      typedef struct {
+        PyObject_HEAD
+        triton::engines::exploration::ExplorationEngine* engine;
+        PyObject* binary; //!< The explored Elf, it must live as long as the engine.
+      } ExplorationEngine_Object;
+
+      //! pyExplorationEngine type.
+      extern PyTypeObject ExplorationEngine_Type;
+
       /* Immediate ====================================================== */
 
       //! pyImmediate object.
       typedef struct {
         PyObject_HEAD
         triton::arch::Immediate* imm;
+        bool readOnly; //!< True if the object belongs to an instruction and cannot be modified.
       } Immediate_Object;
 
       //! pyImmediate type.
@@ -235,6 +261,12 @@ namespace triton {
       typedef struct {
         PyObject_HEAD
         triton::arch::Instruction* inst;
+        PyObject* operands;            //!< Cached result of getOperands(), nullptr until requested.
+        PyObject* loadAccess;          //!< Cached result of getLoadAccess(), nullptr until requested.
+        PyObject* storeAccess;         //!< Cached result of getStoreAccess(), nullptr until requested.
+        PyObject* readRegisters;       //!< Cached result of getReadRegisters(), nullptr until requested.
+        PyObject* writtenRegisters;    //!< Cached result of getWrittenRegisters(), nullptr until requested.
+        PyObject* symbolicExpressions; //!< Cached result of getSymbolicExpressions(), nullptr until requested.
       } Instruction_Object;
 
       //! pyInstruction type.
@@ -246,6 +278,7 @@ namespace triton {
       typedef struct {
         PyObject_HEAD
         triton::arch::MemoryAccess* mem;
+        bool readOnly; //!< True if the object belongs to an instruction and cannot be modified.
       } MemoryAccess_Object;
 
       //! pyMemory type.
@@ -268,6 +301,7 @@ namespace triton {
       typedef struct {
         PyObject_HEAD
         triton::arch::Register* reg;
+        bool readOnly; //!< True if the object belongs to an instruction and cannot be modified.
       } Register_Object;
 
       //! pyRegister type.
@@ -295,6 +329,42 @@ namespace triton {
       //! pySymbolicExpression type.
       extern PyTypeObject SymbolicExpression_Type;
 
+      /* SymbolicMapView ================================================ */
+
+      /*! Containers of the symbolic engine viewed by a SymbolicMapView. */
+      enum symbolic_map_view_e {
+        SYMBOLIC_EXPRESSIONS_VIEW = 0, /*!< <SymExpr id : SymExpr> */
+        SYMBOLIC_MEMORY_VIEW,          /*!< <Addr : SymExpr> */
+      };
+
+      /*! Items returned by a SymbolicMapViewIterator. */
+      enum symbolic_map_iterator_e {
+        SYMBOLIC_MAP_KEYS = 0,   /*!< keys */
+        SYMBOLIC_MAP_VALUES,     /*!< values */
+        SYMBOLIC_MAP_ITEMS,      /*!< (key, value) tuples */
+      };
+
+      //! pySymbolicMapView object. The view reads the engine containers on each access, nothing is copied.
+      typedef struct {
+        PyObject_HEAD
+        triton::uint32 kind;
+      } SymbolicMapView_Object;
+
+      //! pySymbolicMapView type.
+      extern PyTypeObject SymbolicMapView_Type;
+
+      //! pySymbolicMapViewIterator object.
+      typedef struct {
+        PyObject_HEAD
+        triton::uint32 kind;
+        triton::uint32 mode;
+        bool started;
+        triton::uint64 last;
+      } SymbolicMapViewIterator_Object;
+
+      //! pySymbolicMapViewIterator type.
+      extern PyTypeObject SymbolicMapViewIterator_Type;
+
       /* SymbolicVariable =============================================== */
 
       //! pySymbolicVariable object.
@@ -368,12 +438,21 @@ namespace triton {
 /*! Returns the triton::format::elf::ElfSymbolTable. */
 #define PyElfSymbolTable_AsElfSymbolTable(v) (((triton::bindings::python::ElfSymbolTable_Object*)(v))->sym)
 
+/*! Checks if the pyObject is a triton::engines::exploration::ExplorationEngine. */
+#define PyExplorationEngine_Check(v) ((v)->ob_type == &triton::bindings::python::ExplorationEngine_Type)
+
+/*! Returns the triton::engines::exploration::ExplorationEngine. */
+#define PyExplorationEngine_AsExplorationEngine(v) (((triton::bindings::python::ExplorationEngine_Object*)(v))->engine)
+
 /*! Checks if the pyObject is a triton::arch::Immediate. */
 #define PyImmediate_Check(v) ((v)->ob_type == &triton::bindings::python::Immediate_Type)
 
 /*! Returns the triton::arch::Immediate. */
 #define PyImmediate_AsImmediate(v) (((triton::bindings::python::Immediate_Object*)(v))->imm)
 
+/*! Returns true if the immediate cannot be modified. */
+#define PyImmediate_IsReadOnly(v) (((triton::bindings::python::Immediate_Object*)(v))->readOnly)
+
 /*! Checks if the pyObject is a triton::arch::Instruction. */
 #define PyInstruction_Check(v) ((v)->ob_type == &triton::bindings::python::Instruction_Type)
 
@@ -386,6 +465,9 @@ namespace triton {
 /*! Returns the triton::arch::MemoryAccess. */
 #define PyMemoryAccess_AsMemoryAccess(v) (((triton::bindings::python::MemoryAccess_Object*)(v))->mem)
 
+/*! Returns true if the memory access cannot be modified. */
+#define PyMemoryAccess_IsReadOnly(v) (((triton::bindings::python::MemoryAccess_Object*)(v))->readOnly)
+
 /*! Checks if the pyObject is a triton::engines::symbolic::PathConstraint. */
 #define PyPathConstraint_Check(v) ((v)->ob_type == &triton::bindings::python::PathConstraint_Type)
 
@@ -398,6 +480,9 @@ namespace triton {
 /*! Returns the triton::arch::Register. */
 #define PyRegister_AsRegister(v) (((triton::bindings::python::Register_Object*)(v))->reg)
 
+/*! Returns true if the register cannot be modified. */
+#define PyRegister_IsReadOnly(v) (((triton::bindings::python::Register_Object*)(v))->readOnly)
+
 /*! Checks if the pyObject is a triton::engines::solver::SolverModel. */
 #define PySolverModel_Check(v) ((v)->ob_type == &triton::bindings::python::SolverModel_Type)
 
@@ -413,6 +498,9 @@ namespace triton {
 /*! Returns the triton::engines::symbolic::SymbolicExpression. */
 #define PySymbolicExpression_AsSymbolicExpression(v) (((triton::bindings::python::SymbolicExpression_Object*)(v))->symExpr)
 
+/*! Checks if the pyObject is a SymbolicMapView. */
+#define PySymbolicMapView_Check(v) ((v)->ob_type == &triton::bindings::python::SymbolicMapView_Type)
+
 /*! Checks if the pyObject is a triton::engines::symbolic::SymbolicVariable. */
 #define PySymbolicVariable_Check(v) ((v)->ob_type == &triton::bindings::python::SymbolicVariable_Type)
 
@@ -33,21 +33,50 @@ namespace triton {
    *  @{
    */
 
+    /*! \class RegisterSpecification
+     *  \brief This class is used to describe a register of an architecture.
+     *
+     *  \description The specifications are built once per architecture and are never freed, all
+     *  the registers with the same id point to the same specification.
+     */
+    class RegisterSpecification {
+      public:
+        //! The name of the register.
+        std::string name;
+
+        //! The highest bit of the register.
+        triton::uint32 high;
+
+        //! The lower bit of the register.
+        triton::uint32 low;
+
+        //! The parent id of the register.
+        triton::uint32 parent;
+
+        //! Constructor.
+        RegisterSpecification(const std::string& name="unknown", triton::uint32 high=0, triton::uint32 low=0, triton::uint32 parent=0);
+    };
+
+
     /*! \class Register
      *  \brief This class is used when an instruction has a register operand.
+     *
+     *  \description A register holds its id, its bits vector, its parent id, its concrete value and a
+     *  pointer on the specification of its architecture. The name lives in the specification, so
+     *  copying registers and getting their name never allocates.
      */
     class Register : public BitsVector, public OperandInterface {
 
       protected:
-        //! The name of the register.
-        std::string name;
-
         //! The id of the register.
         triton::uint32 id;
 
         //! The parent id of the register.
         triton::uint32 parent;
 
+        //! The specification of the register, shared by all the registers with the same id.
+        const RegisterSpecification* spec;
+
         //! The concrete value (content of the register)
         triton::uint512 concreteValue;
 
@@ -95,7 +124,7 @@ namespace triton {
         void setTrust(bool flag);
 
         //! Returns the name of the register.
-        std::string getName(void) const;
+        const std::string& getName(void) const;
 
         //! Returns the highest bit of the register vector. \sa BitsVector::getHigh()
         triton::uint32 getAbstractHigh(void) const;
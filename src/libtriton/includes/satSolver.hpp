@@ -0,0 +1,170 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SATSOLVER_H
+#define TRITON_SATSOLVER_H
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "solverEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SatSolver
+      /*! \brief A CDCL SAT solver.
+       *
+       * \description The solver uses two watched literals, the first UIP learning, the VSIDS heuristic with
+       * phase saving and the Luby restarts. A literal is `(variable << 1) | negated`. Clauses may be added
+       * between two calls of solve(), which keeps the learnt clauses.
+       */
+      class SatSolver {
+        protected:
+          //! The undefined value of a variable.
+          static const triton::uint8 UNDEF = 2;
+
+          //! The reason of a decision or of a fact.
+          static const triton::uint32 NO_REASON = 0xffffffff;
+
+          //! False if the clauses are unsatisfiable at the level 0.
+          bool ok;
+
+          //! The clauses, the two first literals are watched.
+          std::vector<std::vector<triton::uint32>> clauses;
+
+          //! The clauses which watch a literal, by literal.
+          std::vector<std::vector<triton::uint32>> watches;
+
+          //! The value of each variable (0, 1 or UNDEF).
+          std::vector<triton::uint8> values;
+
+          //! The last value of each variable.
+          std::vector<triton::uint8> phases;
+
+          //! The decision level of each variable.
+          std::vector<triton::uint32> levels;
+
+          //! The clause which implied each variable, NO_REASON for decisions.
+          std::vector<triton::uint32> reasons;
+
+          //! The VSIDS activity of each variable.
+          std::vector<double> activities;
+
+          //! Marks the variables during the conflict analysis.
+          std::vector<triton::uint8> seen;
+
+          //! The assigned literals in order.
+          std::vector<triton::uint32> trail;
+
+          //! The index in the trail of each decision level.
+          std::vector<triton::usize> trailLimits;
+
+          //! The next literal of the trail to propagate.
+          triton::usize head;
+
+          //! The binary heap of the unassigned variables, ordered by activity.
+          std::vector<triton::uint32> heap;
+
+          //! The position of each variable in the heap, -1 if absent.
+          std::vector<triton::sint32> positions;
+
+          //! The increment of the activities.
+          double increment;
+
+          //! The value of each variable in the last model.
+          std::vector<bool> model;
+
+          //! Returns the value of a literal (0, 1 or UNDEF).
+          triton::uint8 valueOf(triton::uint32 lit) const;
+
+          //! Returns the current decision level.
+          triton::uint32 decisionLevel(void) const;
+
+          //! Assigns a literal to true.
+          void enqueue(triton::uint32 lit, triton::uint32 reason);
+
+          //! Propagates the assigned literals. Returns the conflicting clause or NO_REASON.
+          triton::uint32 propagate(void);
+
+          //! Computes the first UIP clause of a conflict. Returns the level to backtrack to.
+          triton::uint32 analyze(triton::uint32 conflict, std::vector<triton::uint32>& learnt);
+
+          //! Unassigns the variables above a decision level.
+          void backtrack(triton::uint32 level);
+
+          //! Increases the activity of a variable.
+          void bump(triton::uint32 var);
+
+          //! Moves a variable up in the heap.
+          void heapUp(triton::usize index);
+
+          //! Moves a variable down in the heap.
+          void heapDown(triton::usize index);
+
+          //! Inserts a variable into the heap.
+          void heapInsert(triton::uint32 var);
+
+          //! Removes and returns the most active variable of the heap.
+          triton::uint32 heapPop(void);
+
+          //! Watches the two first literals of a clause and returns its index.
+          triton::uint32 attach(const std::vector<triton::uint32>& clause);
+
+        public:
+          //! Constructor.
+          SatSolver();
+
+          //! Creates a new variable and returns it.
+          triton::uint32 newVariable(void);
+
+          //! Returns the number of variables.
+          triton::uint32 getNumberOfVariables(void) const;
+
+          //! Returns the number of clauses, learnt clauses included.
+          triton::usize getNumberOfClauses(void) const;
+
+          //! Adds a clause. Returns false if the clauses became unsatisfiable.
+          bool addClause(std::vector<triton::uint32> clause);
+
+          //! Solves the clauses until the deadline. Returns `SAT`, `UNSAT`, `TIMEOUT` or `CANCELED` if `canceled` becomes true.
+          triton::engines::solver::status_e solve(const std::chrono::steady_clock::time_point* deadline, const std::atomic<bool>* canceled);
+
+          //! Returns the value of a variable in the last model.
+          bool getValue(triton::uint32 var) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SATSOLVER_H */
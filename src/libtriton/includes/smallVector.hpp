@@ -0,0 +1,203 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SMALLVECTOR_H
+#define TRITON_SMALLVECTOR_H
+
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class SmallVector
+     *  \brief A vector which keeps its first `N` items inline.
+     *
+     * \description Up to `N` items, no memory is allocated and building an empty vector costs nothing.
+     * Beyond, the items are moved into a buffer on the heap. The items are always contiguous, so the
+     * iterators are plain pointers.
+     */
+    template <typename T, triton::usize N>
+    class SmallVector {
+      protected:
+        //! The inline storage of the first `N` items.
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[N];
+
+        //! Points to the inline storage or to the heap buffer.
+        T* items;
+
+        //! The number of items.
+        triton::usize count;
+
+        //! The number of items which fit into `items`.
+        triton::usize capacity;
+
+        //! Returns true if the items are in the inline storage.
+        bool isInline(void) const {
+          return (this->items == reinterpret_cast<const T*>(this->storage));
+        }
+
+      public:
+        //! An iterator on the items.
+        typedef T* iterator;
+
+        //! A const iterator on the items.
+        typedef const T* const_iterator;
+
+        //! Constructor.
+        SmallVector() {
+          this->items    = reinterpret_cast<T*>(this->storage);
+          this->count    = 0;
+          this->capacity = N;
+        }
+
+        //! Constructor by copy.
+        SmallVector(const SmallVector& other) {
+          this->items    = reinterpret_cast<T*>(this->storage);
+          this->count    = 0;
+          this->capacity = N;
+          this->reserve(other.count);
+          for (triton::usize index = 0; index < other.count; index++)
+            this->push_back(other.items[index]);
+        }
+
+        //! Destructor.
+        ~SmallVector() {
+          this->clear();
+          if (!this->isInline())
+            ::operator delete(this->items);
+        }
+
+        //! Copies a SmallVector.
+        SmallVector& operator=(const SmallVector& other) {
+          if (this == &other)
+            return *this;
+          this->clear();
+          this->reserve(other.count);
+          for (triton::usize index = 0; index < other.count; index++)
+            this->push_back(other.items[index]);
+          return *this;
+        }
+
+        //! Makes room for `size` items.
+        void reserve(triton::usize size) {
+          if (size <= this->capacity)
+            return;
+
+          T* buffer = static_cast<T*>(::operator new(size * sizeof(T)));
+          for (triton::usize index = 0; index < this->count; index++) {
+            new (buffer + index) T(this->items[index]);
+            this->items[index].~T();
+          }
+
+          if (!this->isInline())
+            ::operator delete(this->items);
+
+          this->items    = buffer;
+          this->capacity = size;
+        }
+
+        //! Appends an item.
+        void push_back(const T& item) {
+          if (this->count == this->capacity) {
+            /* The item may live in the buffer being moved */
+            T copy(item);
+            this->reserve(this->capacity * 2);
+            new (this->items + this->count) T(copy);
+          }
+          else {
+            new (this->items + this->count) T(item);
+          }
+          this->count++;
+        }
+
+        //! Removes all items. The heap buffer, if any, is kept for the next items.
+        void clear(void) {
+          for (triton::usize index = 0; index < this->count; index++)
+            this->items[index].~T();
+          this->count = 0;
+        }
+
+        //! Returns the number of items.
+        triton::usize size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if there is no item.
+        bool empty(void) const {
+          return (this->count == 0);
+        }
+
+        //! Returns the item at `index`.
+        T& operator[](triton::usize index) {
+          return this->items[index];
+        }
+
+        //! Returns the item at `index`.
+        const T& operator[](triton::usize index) const {
+          return this->items[index];
+        }
+
+        //! Returns the first item.
+        T& front(void) {
+          return this->items[0];
+        }
+
+        //! Returns the last item.
+        T& back(void) {
+          return this->items[this->count - 1];
+        }
+
+        //! Returns an iterator on the first item.
+        iterator begin(void) {
+          return this->items;
+        }
+
+        //! Returns an iterator past the last item.
+        iterator end(void) {
+          return this->items + this->count;
+        }
+
+        //! Returns a const iterator on the first item.
+        const_iterator begin(void) const {
+          return this->items;
+        }
+
+        //! Returns a const iterator past the last item.
+        const_iterator end(void) const {
+          return this->items + this->count;
+        }
+
+        //! Returns a copy of the items as a `std::vector`, for the code written against the former `std::vector` members.
+        operator std::vector<T>(void) const {
+          return std::vector<T>(this->begin(), this->end());
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SMALLVECTOR_H */
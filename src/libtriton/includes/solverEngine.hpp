@@ -11,13 +11,17 @@
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
-
-#include <z3++.h>
+#include <vector>
 
 #include "ast.hpp"
+#include "bitblastSolver.hpp"
+#include "solverEnums.hpp"
+#include "solverInterface.hpp"
 #include "solverModel.hpp"
 #include "tritonTypes.hpp"
+#include "z3Solver.hpp"
 
 
 
@@ -43,9 +47,28 @@ namespace triton {
      */
 
       //! \class SolverEngine
-      /*! \brief The solver engine class. */
+      /*! \brief The solver engine class. The queries are sent to a backend (See: triton::engines::solver::SolverInterface). */
       class SolverEngine
       {
+        protected:
+          //! The Z3 backend.
+          triton::engines::solver::Z3Solver z3;
+
+          //! The bit-blasting backend.
+          triton::engines::solver::BitblastSolver bitblast;
+
+          //! The default backend of the queries.
+          triton::engines::solver::backend_e backend;
+
+          //! The default timeout of a query in milliseconds, 0 if unlimited.
+          triton::uint32 timeout;
+
+          //! The statistics of the queries.
+          mutable std::map<std::string, triton::usize> stats;
+
+          //! Protects the statistics. Queries on a frozen state may run concurrently.
+          mutable std::mutex mutex;
+
         public:
           //! Computes and returns a model from a symbolic constraint.
           /*! \brief map of symbolic variable id -> model
@@ -53,8 +76,10 @@ namespace triton {
            * \description
            * **item1**: symbolic variable id<br>
            * **item2**: model
+           *
+           * If `status` is not null, it receives the result of the query. A `timeout` of 0 uses the default timeout.
            */
-          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode *node) const;
+          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode *node, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0, triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
 
           //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
           /*! \brief list of map of symbolic variable id -> model
@@ -62,8 +87,54 @@ namespace triton {
            * \description
            * **item1**: symbolic variable id<br>
            * **item2**: model
+           *
+           * If `status` is not null, it receives the result of the last check, `SAT` if the limit is reached.
+           * The `timeout` bounds the whole enumeration, 0 uses the default timeout.
+           */
+          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode *node, triton::uint32 limit, triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0, triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
+
+          //! Enumerates the models of a symbolic constraint and returns their number. Each model is given to the callback.
+          /*!
+           * \description
+           * The models are projected onto `variables` (the sorted ids of the symbolic variables), the variables of the constraint if
+           * empty. Two models differ by at least one of these variables. A `limit` of 0 is unlimited and the callback may stop the
+           * enumeration by returning false. If `status` is not null, it receives the result of the last check. The `timeout` bounds
+           * the whole enumeration, 0 uses the default timeout.
            */
-          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode *node, triton::uint32 limit) const;
+          triton::usize enumerateModels(triton::ast::AbstractNode *node, triton::engines::solver::modelCallback callback, void* data=nullptr, triton::uint32 limit=0, const std::vector<triton::usize>& variables=std::vector<triton::usize>(), triton::engines::solver::status_e* status=nullptr, triton::uint32 timeout=0, triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
+
+          //! Returns a backend. `BACKEND_DEFAULT` returns the default backend.
+          const triton::engines::solver::SolverInterface* getSolver(triton::engines::solver::backend_e backend=triton::engines::solver::BACKEND_DEFAULT) const;
+
+          //! Sets the default backend of the queries.
+          void setBackend(triton::engines::solver::backend_e backend);
+
+          //! Returns the default backend of the queries.
+          triton::engines::solver::backend_e getBackend(void) const;
+
+          //! Sets the default timeout of the queries in milliseconds, 0 if unlimited.
+          void setTimeout(triton::uint32 ms);
+
+          //! Returns the default timeout of the queries in milliseconds.
+          triton::uint32 getTimeout(void) const;
+
+          //! Sets the memory limit of Z3 in megabytes, 0 if unlimited. This limit is shared by all the Z3 contexts of the process.
+          void setMemoryLimit(triton::uint32 mb);
+
+          //! Returns the memory limit of Z3 in megabytes.
+          triton::uint32 getMemoryLimit(void) const;
+
+          //! Interrupts the running queries of all backends and all threads. May be called from another thread, the queries return `CANCELED`.
+          void interrupt(void);
+
+          //! Records a check of a backend into the statistics.
+          void record(triton::engines::solver::status_e status, triton::usize elapsed) const;
+
+          //! Returns the statistics of the queries (queries, sat, unsat, unknown, timeout, canceled, time_ms, max_time_ms).
+          std::map<std::string, triton::usize> getStatistics(void) const;
+
+          //! Clears the statistics of the queries.
+          void resetStatistics(void);
 
           //! Evaluates an AST via Z3 and returns the symbolic value.
           triton::uint512 evaluateAstViaZ3(triton::ast::AbstractNode *node) const;
@@ -0,0 +1,70 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERENUMS_H
+#define TRITON_SOLVERENUMS_H
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Enumerates all results of a solver query.
+      enum status_e {
+        UNSAT = 0, //!< The constraint is unsatisfiable.
+        SAT,       //!< The constraint is satisfiable.
+        UNKNOWN,   //!< The solver gave up (e.g: memory limit).
+        TIMEOUT,   //!< The timeout of the query expired.
+        CANCELED,  //!< The query has been interrupted.
+      };
+
+      //! Enumerates all solver backends.
+      enum backend_e {
+        BACKEND_DEFAULT = 0,  //!< The default backend of the solver engine.
+        BACKEND_Z3,           //!< The Z3 SMT solver.
+        BACKEND_BITBLAST,     //!< The built-in bit-blaster on top of a CDCL SAT solver, only for bit-vectors.
+      };
+
+      //! Enumerates all capabilities of a solver backend. They are bit flags.
+      enum capability_e {
+        CAPABILITY_INCREMENTAL  = (1 << 0), //!< The models are enumerated without restarting the query.
+        CAPABILITY_MODELS       = (1 << 1), //!< The backend returns models.
+        CAPABILITY_UNSAT_CORES  = (1 << 2), //!< The backend returns unsat cores.
+        CAPABILITY_TIMEOUT      = (1 << 3), //!< The queries may be bounded by a timeout.
+        CAPABILITY_INTERRUPT    = (1 << 4), //!< The running queries may be interrupted.
+        CAPABILITY_ARRAYS       = (1 << 5), //!< The backend handles the memory array (select and store).
+        CAPABILITY_MEMORY_LIMIT = (1 << 6), //!< The memory of the backend may be bounded.
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERENUMS_H */
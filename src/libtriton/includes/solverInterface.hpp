@@ -0,0 +1,87 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERINTERFACE_HPP
+#define TRITON_SOLVERINTERFACE_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ast.hpp"
+#include "solverEnums.hpp"
+#include "solverModel.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \brief The prototype of a model callback.
+       *
+       * \description The callback receives each model of an enumeration, as a map of symbolic variable id -> model, and the
+       * `data` given to the enumeration. It returns false to stop the enumeration.
+       */
+      typedef bool (*modelCallback)(const std::map<triton::uint32, SolverModel>& model, void* data);
+
+      /*! \interface SolverInterface
+          \brief This interface is used as abstract solver backend. All backends of the solver engine must use this interface. */
+      class SolverInterface {
+        public:
+          //! Destructor.
+          virtual ~SolverInterface(){};
+
+          //! Returns the name of the backend.
+          virtual std::string getName(void) const = 0;
+
+          //! Returns the capabilities of the backend as a mask of triton::engines::solver::capability_e.
+          virtual triton::uint32 getCapabilities(void) const = 0;
+
+          //! Enumerates the models of a symbolic constraint, projected onto some symbolic variables, and returns their number.
+          /*!
+              \param node the constraint.
+              \param variables the sorted ids of the projection. Two models differ by at least one of these variables and only
+              these variables are returned. The variables of the constraint if empty.
+              \param limit the maximum number of models, 0 if unlimited.
+              \param callback receives each model.
+              \param data is given to the callback.
+              \param status receives the result of the last check, `SAT` if the limit is reached or the callback stopped.
+              \param timeout bounds the whole enumeration in milliseconds, 0 if unlimited.
+          */
+          virtual triton::usize enumerateModels(triton::ast::AbstractNode* node, const std::vector<triton::usize>& variables, triton::uint32 limit, triton::engines::solver::modelCallback callback, void* data, triton::engines::solver::status_e& status, triton::uint32 timeout) const = 0;
+
+          //! Interrupts the running queries of all threads. May be called from another thread, the queries return `CANCELED`.
+          virtual void interrupt(void) = 0;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERINTERFACE_HPP */
@@ -67,6 +67,9 @@ namespace triton {
           //! Constructor.
           SolverModel(const std::string& name, triton::uint512 value);
 
+          //! Constructor. The id is given, so the name is not parsed.
+          SolverModel(triton::uint32 id, const std::string& name, triton::uint512 value);
+
           //! Constructor by copy.
           SolverModel(const SolverModel& other);
 
@@ -0,0 +1,120 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SUMMARYENGINE_H
+#define TRITON_SUMMARYENGINE_H
+
+#include <map>
+#include <string>
+
+#include "elf.hpp"
+#include "instruction.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Summary namespace
+    namespace summary {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup summary
+     *  @{
+     */
+
+      //! The prototype of a function summary. It applies the effect of the whole routine and returns to the caller, or returns false to let the instruction be processed as usual.
+      typedef bool (*summary_t)(triton::arch::Instruction& inst);
+
+      //! The default base address of the heap used by the `malloc` summary.
+      const triton::uint64 DEFAULT_HEAP_BASE = 0x10000000;
+
+      /*! \class SummaryEngine
+       *  \brief The summary engine class.
+       *
+       * \description A summary replaces the instruction-level semantics of a routine. When the
+       * first instruction of a summarized routine is processed, the summary is applied instead and
+       * the instruction holds the symbolic expressions of the whole call. Summaries are bound to
+       * addresses, either one by one or from the symbols table of an ELF binary.
+       */
+      class SummaryEngine {
+        protected:
+          //! The summaries bound to an address.
+          std::map<triton::uint64, triton::engines::summary::summary_t> summaries;
+
+          //! The names of the summaries bound to an address.
+          std::map<triton::uint64, std::string> names;
+
+          //! The next address returned by allocate().
+          triton::uint64 heap;
+
+        public:
+          //! Constructor.
+          SummaryEngine();
+
+          //! Constructor by copy.
+          SummaryEngine(const SummaryEngine& copy);
+
+          //! Destructor.
+          ~SummaryEngine();
+
+          //! Copies a SummaryEngine.
+          void operator=(const SummaryEngine& copy);
+
+          //! Returns the built-in summary of a routine (e.g: `memcpy`, `__strlen_avx2`) or nullptr.
+          static triton::engines::summary::summary_t getBuiltinSummary(const std::string& name);
+
+          //! Binds a summary to the address of a routine.
+          void addSummary(triton::uint64 addr, triton::engines::summary::summary_t summary, const std::string& name="");
+
+          //! Binds the built-in summary of `name` to the address of a routine. Returns false if there is no built-in summary for this name.
+          bool addSummary(triton::uint64 addr, const std::string& name);
+
+          //! Binds the built-in summaries to the routines defined in the symbols table of a binary loaded at `base`. Returns the number of bound routines.
+          triton::usize addSummaries(const triton::format::elf::Elf& binary, triton::uint64 base=0);
+
+          //! Removes the summary bound to an address.
+          void removeSummary(triton::uint64 addr);
+
+          //! Removes all summaries.
+          void removeAllSummaries(void);
+
+          //! Returns true if a summary is bound to the address.
+          bool isSummarized(triton::uint64 addr) const;
+
+          //! Returns the names of the summaries bound to an address.
+          const std::map<triton::uint64, std::string>& getSummaries(void) const;
+
+          //! Applies the summary bound to the address of the instruction. Returns false if there is no summary or if the summary declined.
+          bool processSummary(triton::arch::Instruction& inst) const;
+
+          //! Sets the base address of the heap used by the `malloc` summary.
+          void setHeapBase(triton::uint64 base);
+
+          //! Returns a fresh memory area of `size` bytes, aligned on 16 bytes.
+          triton::uint64 allocate(triton::usize size);
+      };
+
+    /*! @} End of summary namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SUMMARYENGINE_H */
@@ -10,7 +10,11 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "ast.hpp"
 #include "astDictionaries.hpp"
@@ -95,13 +99,71 @@ namespace triton {
            */
           std::map<triton::uint64, triton::usize> memoryReference;
 
-          /*! \brief map of <address:size> -> symbolic expression.
+          /*! \brief map of address -> <size:node> (ALIGNED_MEMORY optimization).
            *
            * \description
-           * **item1**: <addr:size><br>
-           * **item2**: symbolic reference id
+           * **item1**: first address of the range<br>
+           * **item2**: <size of the range:AST of the range>
+           *
+           * The ranges never overlap, so the ranges touched by a memory access are found with a single lookup.
+           */
+          std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>> alignedMemoryReference;
+
+          //! multimap of AST -> first address of the ranges of alignedMemoryReference which hold it, to remove the freed nodes without a scan.
+          std::multimap<triton::ast::AbstractNode*, triton::uint64> alignedMemoryNodes;
+
+          //! Removes an aligned entry and its node index. Returns the next entry.
+          std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator eraseAlignedMemory(std::map<triton::uint64, std::pair<triton::uint32, triton::ast::AbstractNode*>>::iterator it);
+
+          //! The number of instructions after which an unreferenced expression which is not assigned anymore is removed (DEAD_EXPRESSIONS optimization).
+          triton::usize deadExpressionsWindow;
+
+          //! The id of the first unreferenced expression which has not left the window yet (DEAD_EXPRESSIONS optimization).
+          triton::usize deadExpressionsCursor;
+
+          //! The number of bytes around the concrete address covered by a symbolic address (MEMORY_ARRAY optimization).
+          triton::usize memoryArrayWindow;
+
+          //! The index of the instruction currently processed (DEAD_EXPRESSIONS optimization).
+          triton::usize instructionIndex;
+
+          /*! \brief map of symbolic expressions not yet referenced (DEAD_EXPRESSIONS optimization).
+           *
+           * \description
+           * **item1**: symbolic reference id<br>
+           * **item2**: index of the instruction which created the expression
            */
-          std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
+          std::map<triton::usize, triton::usize> unreferencedExpressions;
+
+          /*! \brief map of symbolic expression id -> ids of the expressions referenced by its AST (backward dependencies).
+           *
+           * \description
+           * Expressions are indexed lazily, by the first slice which reaches them.
+           */
+          mutable std::map<triton::usize, std::set<triton::usize>> expressionDependencies;
+
+          //! map of symbolic expression id -> ids of the indexed expressions which reference it (forward dependencies).
+          mutable std::map<triton::usize, std::set<triton::usize>> expressionDependents;
+
+          //! Indexes the dependencies of an expression from its AST, if it is not yet indexed.
+          void indexSymbolicExpression(triton::usize symExprId) const;
+
+          /*! \brief map of symbolic expressions waiting for the SYMBOLIC_SIMPLIFICATION_BATCH callbacks.
+           *
+           * \description
+           * **item1**: symbolic reference id<br>
+           * **item2**: symbolic expression
+           */
+          std::map<triton::usize, SymbolicExpression*> batchedSimplifications;
+
+          /*! \brief list of the reference nodes unrolled by a freeze, restored by rollReferences().
+           *
+           * \description
+           * **item1**: parent node<br>
+           * **item2**: child index<br>
+           * **item3**: reference node
+           */
+          std::vector<std::tuple<triton::ast::AbstractNode*, triton::uint32, triton::ast::AbstractNode*>> unrolledReferences;
 
         public:
 
@@ -123,9 +185,54 @@ namespace triton {
           //! Checks if the aligned memory is recored.
           bool isAlignedMemory(triton::uint64 address, triton::uint32 size);
 
-          //! Removes an aligned entry.
+          //! Returns true if an aligned entry overlaps the range.
+          bool isAlignedMemoryOverlapped(triton::uint64 address, triton::uint32 size);
+
+          //! Removes the aligned entries overlapping the range.
           void removeAlignedMemory(triton::uint64 address, triton::uint32 size);
 
+          //! Removes the aligned entries whose AST is one of the given nodes (the nodes are about to be freed).
+          void removeAlignedMemory(const std::set<triton::ast::AbstractNode*>& nodes);
+
+          //! Slides the liveness window of the DEAD_EXPRESSIONS optimization to the next instruction.
+          void slideDeadExpressionsWindow(void);
+
+          //! Returns true if a register or a memory cell holds the expression.
+          bool isAssigned(const SymbolicExpression* se) const;
+
+          //! Sets the number of instructions covered by the DEAD_EXPRESSIONS optimization.
+          void setDeadExpressionsWindow(triton::usize size);
+
+          //! Returns the number of instructions covered by the DEAD_EXPRESSIONS optimization.
+          triton::usize getDeadExpressionsWindow(void) const;
+
+          //! Sets the number of bytes around the concrete address covered by a symbolic address (MEMORY_ARRAY optimization).
+          void setMemoryArrayWindow(triton::usize size);
+
+          //! Returns the number of bytes around the concrete address covered by a symbolic address (MEMORY_ARRAY optimization).
+          triton::usize getMemoryArrayWindow(void) const;
+
+          //! Returns the symbolized address of a memory access as an index of the memory array, nullptr if the address is concrete.
+          triton::ast::AbstractNode* getMemoryArrayIndex(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the memory array holding the cells of the range `[address:size]`.
+          triton::ast::AbstractNode* buildMemoryArray(triton::uint64 address, triton::usize size);
+
+          //! Records a symbolic expression which is not yet referenced.
+          void recordUnreferencedExpression(SymbolicExpression* se);
+
+          //! Removes an overwritten symbolic expression if it has never been referenced.
+          void removeDeadExpression(triton::usize symExprId);
+
+          //! Removes a symbolic expression from the engine without concretizing its target. It is deleted once no instruction holds it.
+          void deleteSymbolicExpression(triton::usize symExprId);
+
+          //! Keeps a symbolic expression whose id has been looked up, the DEAD_EXPRESSIONS optimization does not remove it anymore.
+          void keepSymbolicExpression(triton::usize symExprId);
+
+          //! Calls the SYMBOLIC_SIMPLIFICATION_BATCH callbacks on all expressions created since the last call.
+          void processBatchedSimplifications(void);
+
           //! Adds a symbolic variable.
           SymbolicVariable* newSymbolicVariable(symkind_e kind, triton::uint64 kindValue, triton::uint32 size, const std::string& comment="");
 
@@ -156,6 +263,9 @@ namespace triton {
           //! Returns the map (addr:expr) of all symbolic memory defined.
           std::map<triton::uint64, SymbolicExpression*> getSymbolicMemory(void) const;
 
+          //! Returns the map (addr:id) of all symbolic memory defined, without copy.
+          const std::map<triton::uint64, triton::usize>& getSymbolicMemoryReferences(void) const;
+
           //! Returns the symbolic expression id corresponding to the register.
           triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
 
@@ -216,6 +326,27 @@ namespace triton {
           //! Returns the full AST of a root node.
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
 
+          //! Replaces the reference nodes of every symbolic expression by the ASTs they refer to. Used to freeze the state.
+          void unrollReferences(void);
+
+          //! Puts back the reference nodes replaced by unrollReferences(). Used to unfreeze the state.
+          void rollReferences(void);
+
+          //! Returns true if a reference node is reachable from the node. The node is not modified.
+          bool hasReferences(triton::ast::AbstractNode* node) const;
+
+          //! Indexes the dependencies of every symbolic expression.
+          void indexSymbolicExpressions(void) const;
+
+          //! Removes an expression from the dependency index. Called when its AST is replaced or when it is removed.
+          void unindexSymbolicExpression(triton::usize symExprId);
+
+          //! Returns the backward slice of an expression, the expressions it depends on, itself included.
+          std::map<triton::usize, SymbolicExpression*> sliceExpressions(triton::usize symExprId) const;
+
+          //! Returns the symbolic variables an expression depends on.
+          std::map<triton::usize, SymbolicVariable*> getSymbolicVariablesFromExpression(triton::usize symExprId) const;
+
           //! Returns the list of the tainted symbolic expressions.
           std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
@@ -228,6 +359,9 @@ namespace triton {
           //! Returns all variable declarations representation.
           std::string getVariablesDeclaration(void) const;
 
+          //! Returns the declarations of the symbolic variables of a node only.
+          std::string getVariablesDeclaration(triton::ast::AbstractNode* node) const;
+
           //! Adds a symbolic memory reference.
           void addMemoryReference(triton::uint64 mem, triton::usize id);
 
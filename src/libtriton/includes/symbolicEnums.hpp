@@ -53,11 +53,14 @@ namespace triton {
 
       //! Enumerates all Kinds of symbolic optimization.
       enum optimization_e {
-        ALIGNED_MEMORY,        //!< Keep a map of aligned memory.
-        AST_DICTIONARIES,      //!< Abstract Syntax Tree dictionaries.
-        ONLY_ON_SYMBOLIZED,    //!< Perform symbolic execution only on symbolized expressions.
-        ONLY_ON_TAINTED,       //!< Perform symbolic execution only on tainted instructions.
-        PC_TRACKING_SYMBOLIC,  //!< Track path constraints only if they are symbolized.
+        ALIGNED_MEMORY,         //!< Keep a map of aligned memory.
+        AST_DICTIONARIES,       //!< Abstract Syntax Tree dictionaries.
+        ONLY_ON_SYMBOLIZED,     //!< Perform symbolic execution only on symbolized expressions.
+        ONLY_ON_TAINTED,        //!< Perform symbolic execution only on tainted instructions.
+        PC_TRACKING_SYMBOLIC,   //!< Track path constraints only if they are symbolized.
+        DEAD_EXPRESSIONS,       //!< Remove symbolic expressions overwritten before being referenced.
+        BULK_STRING_OPERATIONS, //!< Process REP MOVS/STOS/LODS with a concrete counter in a single step.
+        MEMORY_ARRAY,           //!< Model the memory accesses with a symbolized address as select/store over an SMT array.
       };
 
     /*! @} End of symbolic namespace */
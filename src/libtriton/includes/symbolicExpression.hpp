@@ -64,6 +64,9 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::Register originRegister;
 
+          //! The number of owners of the symbolic expression: the symbolic engine while it records it and the instructions which hold it.
+          triton::usize owners;
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -116,6 +119,12 @@ namespace triton {
           //! Sets the origin register.
           void setOriginRegister(const triton::arch::Register& reg);
 
+          //! Records a new owner of the symbolic expression (the symbolic engine or an instruction).
+          void acquire(void);
+
+          //! Releases an owner of the symbolic expression. Returns true if it was the last one, the caller must then delete the expression.
+          bool release(void);
+
           //! Constructor.
           SymbolicExpression(triton::ast::AbstractNode* expr, triton::usize id, symkind_e kind, const std::string& comment="");
 
@@ -46,6 +46,9 @@ namespace triton {
           //! Flag to define if we can use z3 to simplify expressions. Default: false.
           bool z3Enabled;
 
+          //! Flag to define if batched simplifications are flushed at the end of basic blocks instead of every instruction. Default: false.
+          bool batchPerBlock;
+
         public:
           //! Constructor.
           SymbolicSimplification();
@@ -65,6 +68,12 @@ namespace triton {
           //! Enabled, Triton will use the simplification passes of z3 before to call its recorded simplification passes.
           void enableZ3Simplification(bool flag);
 
+          //! Returns true if batched simplifications are flushed at the end of basic blocks.
+          bool isSimplificationBatchPerBlockEnabled(void) const;
+
+          //! Enabled, SYMBOLIC_SIMPLIFICATION_BATCH callbacks are called once per basic block instead of once per instruction.
+          void enableSimplificationBatchPerBlock(bool flag);
+
           //! Processes all recorded simplifications. Returns the simplified node.
           triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false) const;
 
@@ -70,6 +70,9 @@ namespace triton {
           //! The concrete value of the symbolic variable.
           triton::uint512 concreteValue;
 
+          //! The number of symbolic engines which record the symbolic variable: the engine of the API and its backup.
+          triton::usize owners;
+
         public:
 
           //! Constructor.
@@ -107,6 +110,12 @@ namespace triton {
 
           //! Sets the concrete value of the symbolic variable.
           void setConcreteValue(triton::uint512 value);
+
+          //! Records a new owner of the symbolic variable.
+          void acquire(void);
+
+          //! Releases an owner of the symbolic variable. Returns true if it was the last one, the caller must then delete the variable.
+          bool release(void);
       };
 
       //! Displays a symbolic variable.
@@ -8,6 +8,8 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <map>
+#include <string>
 #include <z3++.h>
 
 #include "ast.hpp"
@@ -43,6 +45,9 @@ namespace triton {
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::map<std::string, triton::ast::AbstractNode*> symbols;
 
+        //! The nodes already converted. ASTs are DAGs, a shared node is converted only once.
+        std::map<triton::ast::AbstractNode*, z3::expr> converted;
+
       protected:
         //! The result.
         Z3Result result;
@@ -60,6 +65,8 @@ namespace triton {
         //! Evaluate operator.
         virtual void operator()(triton::ast::AbstractNode& e);
         //! Evaluate operator.
+        virtual void operator()(triton::ast::ArrayNode& e);
+        //! Evaluate operator.
         virtual void operator()(triton::ast::AssertNode& e);
         //! Evaluate operator.
         virtual void operator()(triton::ast::BvaddNode& e);
@@ -150,6 +157,10 @@ namespace triton {
         //! Evaluate operator.
         virtual void operator()(triton::ast::ReferenceNode& e);
         //! Evaluate operator.
+        virtual void operator()(triton::ast::SelectNode& e);
+        //! Evaluate operator.
+        virtual void operator()(triton::ast::StoreNode& e);
+        //! Evaluate operator.
         virtual void operator()(triton::ast::StringNode& e);
         //! Evaluate operator.
         virtual void operator()(triton::ast::SxNode& e);
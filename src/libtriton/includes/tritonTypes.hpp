@@ -13,6 +13,15 @@
 #include <boost/numeric/conversion/cast.hpp>
 
 
+/*! Storage of the states shared by the whole library (the API and the x86 register shortcuts).
+ *  With TRITON_THREAD_LOCAL_API (cmake -DTHREAD_LOCAL_API=on), each thread owns its own instances. */
+#ifdef TRITON_THREAD_LOCAL_API
+  #define TRITON_API_STORAGE thread_local
+#else
+  #define TRITON_API_STORAGE
+#endif
+
+
 
 //! The Triton namespace
 namespace triton {
@@ -208,6 +208,7 @@ namespace triton {
           bool isSegment(triton::uint32 regId) const;
 
           std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getRegisterInformation(triton::uint32 reg) const;
+          const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 reg) const;
           std::set<triton::arch::Register*> getAllRegisters(void) const;
           std::set<triton::arch::Register*> getParentRegisters(void) const;
           triton::uint512 getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks=true) const;
@@ -45,9 +45,30 @@ namespace triton {
 
       /* Utils ================================================================================= */
 
+      //! The maximum number of bytes accessed by a REP string instruction processed in a single step (BULK_STRING_OPERATIONS optimization).
+      const triton::uint64 REP_BULK_MAX_SIZE = 0x1000000;
+
+      //! Type of a semantics handler.
+      typedef void (*handler_t)(triton::arch::Instruction& inst);
+
       //! Builds the semantics of the instruction.
       void build(triton::arch::Instruction& inst);
 
+      //! Returns the semantics handler of an instruction id, nullptr if the instruction is not supported.
+      handler_t getHandler(triton::uint32 id);
+
+      /*! \brief Sets (or overrides) the semantics handler of an instruction id. A nullptr handler disables the instruction.
+       *
+       * \description The handlers table has the same storage as triton::api. In the default build, it is shared
+       * by all threads and, like the rest of the API, it is not locked: set the handlers before processing starts.
+       * Built with `-DTHREAD_LOCAL_API=on`, each thread has its own table, so the handlers must be set by each
+       * thread (e.g. in the setup hook of the exploration engine).
+       */
+      void setHandler(triton::uint32 id, handler_t handler);
+
+      //! Restores the builtin semantics handler of an instruction id.
+      void resetHandler(triton::uint32 id);
+
 
       /* Semantics ============================================================================= */
 
@@ -66,6 +87,24 @@ namespace triton {
       //! Control flow semantics. Used to represent IP.
       void controlFlow_s(triton::arch::Instruction& inst);
 
+      //! Returns the number of iterations of a REP string instruction which can be processed in a single step, 0 if the per-iteration semantics must be used.
+      triton::uint64 repCount_s(triton::arch::Instruction& inst, triton::uint32 size);
+
+      //! Moves an index register forward or backward by `delta` bytes at once (REP string instructions).
+      void repIndex_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& index, triton::uint64 delta, bool backward, const std::string& comment);
+
+      //! Control flow semantics of a REP string instruction processed in a single step.
+      void repControlFlow_s(triton::arch::Instruction& inst);
+
+      //! Processes all the iterations of REP MOVS in a single step. Returns false if the per-iteration semantics must be used.
+      bool repMovs_s(triton::arch::Instruction& inst, triton::uint32 size, const std::string& comment);
+
+      //! Processes all the iterations of REP STOS in a single step. Returns false if the per-iteration semantics must be used.
+      bool repStos_s(triton::arch::Instruction& inst, triton::uint32 size, const std::string& comment);
+
+      //! Processes all the iterations of REP LODS in a single step. Returns false if the per-iteration semantics must be used.
+      bool repLods_s(triton::arch::Instruction& inst, triton::uint32 size, const std::string& comment);
+
       //! The AF semantics.
       void af_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol=false);
 
@@ -35,233 +35,236 @@ namespace triton {
      *  @{
      */
 
-      extern triton::arch::Register x86_reg_invalid;
-
-      extern triton::arch::Register x86_reg_rax;
-      extern triton::arch::Register x86_reg_eax;
-      extern triton::arch::Register x86_reg_ax;
-      extern triton::arch::Register x86_reg_ah;
-      extern triton::arch::Register x86_reg_al;
-
-      extern triton::arch::Register x86_reg_rbx;
-      extern triton::arch::Register x86_reg_ebx;
-      extern triton::arch::Register x86_reg_bx;
-      extern triton::arch::Register x86_reg_bh;
-      extern triton::arch::Register x86_reg_bl;
-
-      extern triton::arch::Register x86_reg_rcx;
-      extern triton::arch::Register x86_reg_ecx;
-      extern triton::arch::Register x86_reg_cx;
-      extern triton::arch::Register x86_reg_ch;
-      extern triton::arch::Register x86_reg_cl;
-
-      extern triton::arch::Register x86_reg_rdx;
-      extern triton::arch::Register x86_reg_edx;
-      extern triton::arch::Register x86_reg_dx;
-      extern triton::arch::Register x86_reg_dh;
-      extern triton::arch::Register x86_reg_dl;
-
-      extern triton::arch::Register x86_reg_rdi;
-      extern triton::arch::Register x86_reg_edi;
-      extern triton::arch::Register x86_reg_di;
-      extern triton::arch::Register x86_reg_dil;
-
-      extern triton::arch::Register x86_reg_rsi;
-      extern triton::arch::Register x86_reg_esi;
-      extern triton::arch::Register x86_reg_si;
-      extern triton::arch::Register x86_reg_sil;
-
-      extern triton::arch::Register x86_reg_rsp;
-      extern triton::arch::Register x86_reg_esp;
-      extern triton::arch::Register x86_reg_sp;
-      extern triton::arch::Register x86_reg_spl;
-      extern triton::arch::Register x86_reg_stack;
-
-      extern triton::arch::Register x86_reg_rbp;
-      extern triton::arch::Register x86_reg_ebp;
-      extern triton::arch::Register x86_reg_bp;
-      extern triton::arch::Register x86_reg_bpl;
-
-      extern triton::arch::Register x86_reg_rip;
-      extern triton::arch::Register x86_reg_eip;
-      extern triton::arch::Register x86_reg_ip;
-      extern triton::arch::Register x86_reg_pc;
-
-      extern triton::arch::Register x86_reg_eflags;
-
-      extern triton::arch::Register x86_reg_r8;
-      extern triton::arch::Register x86_reg_r8d;
-      extern triton::arch::Register x86_reg_r8w;
-      extern triton::arch::Register x86_reg_r8b;
-
-      extern triton::arch::Register x86_reg_r9;
-      extern triton::arch::Register x86_reg_r9d;
-      extern triton::arch::Register x86_reg_r9w;
-      extern triton::arch::Register x86_reg_r9b;
-
-      extern triton::arch::Register x86_reg_r10;
-      extern triton::arch::Register x86_reg_r10d;
-      extern triton::arch::Register x86_reg_r10w;
-      extern triton::arch::Register x86_reg_r10b;
-
-      extern triton::arch::Register x86_reg_r11;
-      extern triton::arch::Register x86_reg_r11d;
-      extern triton::arch::Register x86_reg_r11w;
-      extern triton::arch::Register x86_reg_r11b;
-
-      extern triton::arch::Register x86_reg_r12;
-      extern triton::arch::Register x86_reg_r12d;
-      extern triton::arch::Register x86_reg_r12w;
-      extern triton::arch::Register x86_reg_r12b;
-
-      extern triton::arch::Register x86_reg_r13;
-      extern triton::arch::Register x86_reg_r13d;
-      extern triton::arch::Register x86_reg_r13w;
-      extern triton::arch::Register x86_reg_r13b;
-
-      extern triton::arch::Register x86_reg_r14;
-      extern triton::arch::Register x86_reg_r14d;
-      extern triton::arch::Register x86_reg_r14w;
-      extern triton::arch::Register x86_reg_r14b;
-
-      extern triton::arch::Register x86_reg_r15;
-      extern triton::arch::Register x86_reg_r15d;
-      extern triton::arch::Register x86_reg_r15w;
-      extern triton::arch::Register x86_reg_r15b;
-
-      extern triton::arch::Register x86_reg_mm0;
-      extern triton::arch::Register x86_reg_mm1;
-      extern triton::arch::Register x86_reg_mm2;
-      extern triton::arch::Register x86_reg_mm3;
-      extern triton::arch::Register x86_reg_mm4;
-      extern triton::arch::Register x86_reg_mm5;
-      extern triton::arch::Register x86_reg_mm6;
-      extern triton::arch::Register x86_reg_mm7;
-
-      extern triton::arch::Register x86_reg_xmm0;
-      extern triton::arch::Register x86_reg_xmm1;
-      extern triton::arch::Register x86_reg_xmm2;
-      extern triton::arch::Register x86_reg_xmm3;
-      extern triton::arch::Register x86_reg_xmm4;
-      extern triton::arch::Register x86_reg_xmm5;
-      extern triton::arch::Register x86_reg_xmm6;
-      extern triton::arch::Register x86_reg_xmm7;
-      extern triton::arch::Register x86_reg_xmm8;
-      extern triton::arch::Register x86_reg_xmm9;
-      extern triton::arch::Register x86_reg_xmm10;
-      extern triton::arch::Register x86_reg_xmm11;
-      extern triton::arch::Register x86_reg_xmm12;
-      extern triton::arch::Register x86_reg_xmm13;
-      extern triton::arch::Register x86_reg_xmm14;
-      extern triton::arch::Register x86_reg_xmm15;
-
-      extern triton::arch::Register x86_reg_ymm0;
-      extern triton::arch::Register x86_reg_ymm1;
-      extern triton::arch::Register x86_reg_ymm2;
-      extern triton::arch::Register x86_reg_ymm3;
-      extern triton::arch::Register x86_reg_ymm4;
-      extern triton::arch::Register x86_reg_ymm5;
-      extern triton::arch::Register x86_reg_ymm6;
-      extern triton::arch::Register x86_reg_ymm7;
-      extern triton::arch::Register x86_reg_ymm8;
-      extern triton::arch::Register x86_reg_ymm9;
-      extern triton::arch::Register x86_reg_ymm10;
-      extern triton::arch::Register x86_reg_ymm11;
-      extern triton::arch::Register x86_reg_ymm12;
-      extern triton::arch::Register x86_reg_ymm13;
-      extern triton::arch::Register x86_reg_ymm14;
-      extern triton::arch::Register x86_reg_ymm15;
-
-      extern triton::arch::Register x86_reg_zmm0;
-      extern triton::arch::Register x86_reg_zmm1;
-      extern triton::arch::Register x86_reg_zmm2;
-      extern triton::arch::Register x86_reg_zmm3;
-      extern triton::arch::Register x86_reg_zmm4;
-      extern triton::arch::Register x86_reg_zmm5;
-      extern triton::arch::Register x86_reg_zmm6;
-      extern triton::arch::Register x86_reg_zmm7;
-      extern triton::arch::Register x86_reg_zmm8;
-      extern triton::arch::Register x86_reg_zmm9;
-      extern triton::arch::Register x86_reg_zmm10;
-      extern triton::arch::Register x86_reg_zmm11;
-      extern triton::arch::Register x86_reg_zmm12;
-      extern triton::arch::Register x86_reg_zmm13;
-      extern triton::arch::Register x86_reg_zmm14;
-      extern triton::arch::Register x86_reg_zmm15;
-      extern triton::arch::Register x86_reg_zmm16;
-      extern triton::arch::Register x86_reg_zmm17;
-      extern triton::arch::Register x86_reg_zmm18;
-      extern triton::arch::Register x86_reg_zmm19;
-      extern triton::arch::Register x86_reg_zmm20;
-      extern triton::arch::Register x86_reg_zmm21;
-      extern triton::arch::Register x86_reg_zmm22;
-      extern triton::arch::Register x86_reg_zmm23;
-      extern triton::arch::Register x86_reg_zmm24;
-      extern triton::arch::Register x86_reg_zmm25;
-      extern triton::arch::Register x86_reg_zmm26;
-      extern triton::arch::Register x86_reg_zmm27;
-      extern triton::arch::Register x86_reg_zmm28;
-      extern triton::arch::Register x86_reg_zmm29;
-      extern triton::arch::Register x86_reg_zmm30;
-      extern triton::arch::Register x86_reg_zmm31;
-
-      extern triton::arch::Register x86_reg_mxcsr;
-
-      extern triton::arch::Register x86_reg_cr0;
-      extern triton::arch::Register x86_reg_cr1;
-      extern triton::arch::Register x86_reg_cr2;
-      extern triton::arch::Register x86_reg_cr3;
-      extern triton::arch::Register x86_reg_cr4;
-      extern triton::arch::Register x86_reg_cr5;
-      extern triton::arch::Register x86_reg_cr6;
-      extern triton::arch::Register x86_reg_cr7;
-      extern triton::arch::Register x86_reg_cr8;
-      extern triton::arch::Register x86_reg_cr9;
-      extern triton::arch::Register x86_reg_cr10;
-      extern triton::arch::Register x86_reg_cr11;
-      extern triton::arch::Register x86_reg_cr12;
-      extern triton::arch::Register x86_reg_cr13;
-      extern triton::arch::Register x86_reg_cr14;
-      extern triton::arch::Register x86_reg_cr15;
-
-      extern triton::arch::Register x86_reg_af;
-      extern triton::arch::Register x86_reg_cf;
-      extern triton::arch::Register x86_reg_df;
-      extern triton::arch::Register x86_reg_if;
-      extern triton::arch::Register x86_reg_of;
-      extern triton::arch::Register x86_reg_pf;
-      extern triton::arch::Register x86_reg_sf;
-      extern triton::arch::Register x86_reg_tf;
-      extern triton::arch::Register x86_reg_zf;
-
-      extern triton::arch::Register x86_reg_ie;
-      extern triton::arch::Register x86_reg_de;
-      extern triton::arch::Register x86_reg_ze;
-      extern triton::arch::Register x86_reg_oe;
-      extern triton::arch::Register x86_reg_ue;
-      extern triton::arch::Register x86_reg_pe;
-      extern triton::arch::Register x86_reg_daz;
-      extern triton::arch::Register x86_reg_im;
-      extern triton::arch::Register x86_reg_dm;
-      extern triton::arch::Register x86_reg_zm;
-      extern triton::arch::Register x86_reg_om;
-      extern triton::arch::Register x86_reg_um;
-      extern triton::arch::Register x86_reg_pm;
-      extern triton::arch::Register x86_reg_rl;
-      extern triton::arch::Register x86_reg_rh;
-      extern triton::arch::Register x86_reg_fz;
-
-      extern triton::arch::Register x86_reg_cs;
-      extern triton::arch::Register x86_reg_ds;
-      extern triton::arch::Register x86_reg_es;
-      extern triton::arch::Register x86_reg_fs;
-      extern triton::arch::Register x86_reg_gs;
-      extern triton::arch::Register x86_reg_ss;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_invalid;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rax;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_eax;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ax;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ah;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_al;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rbx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ebx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_bx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_bh;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_bl;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rcx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ecx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ch;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cl;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rdx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_edx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_dx;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_dh;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_dl;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rdi;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_edi;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_di;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_dil;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rsi;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_esi;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_si;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_sil;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rsp;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_esp;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_sp;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_spl;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_stack;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rbp;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ebp;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_bp;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_bpl;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rip;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_eip;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ip;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_pc;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_eflags;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r8;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r8d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r8w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r8b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r9;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r9d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r9w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r9b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r10;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r10d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r10w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r10b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r11;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r11d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r11w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r11b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r12;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r12d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r12w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r12b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r13;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r13d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r13w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r13b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r14;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r14d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r14w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r14b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r15;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r15d;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r15w;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_r15b;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm0;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm1;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm2;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm3;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm4;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm5;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm6;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mm7;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm0;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm1;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm2;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm3;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm4;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm5;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm6;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm7;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm8;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm9;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm10;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm11;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm12;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm13;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm14;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_xmm15;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm0;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm1;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm2;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm3;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm4;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm5;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm6;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm7;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm8;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm9;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm10;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm11;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm12;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm13;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm14;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ymm15;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm0;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm1;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm2;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm3;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm4;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm5;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm6;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm7;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm8;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm9;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm10;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm11;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm12;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm13;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm14;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm15;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm16;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm17;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm18;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm19;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm20;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm21;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm22;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm23;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm24;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm25;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm26;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm27;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm28;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm29;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm30;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zmm31;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_mxcsr;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr0;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr1;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr2;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr3;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr4;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr5;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr6;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr7;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr8;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr9;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr10;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr11;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr12;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr13;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr14;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cr15;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_af;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cf;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_df;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_if;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_of;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_pf;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_sf;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_tf;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zf;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ie;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_de;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ze;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_oe;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ue;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_pe;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_daz;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_im;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_dm;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_zm;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_om;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_um;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_pm;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rl;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_rh;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_fz;
+
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_cs;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ds;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_es;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_fs;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_gs;
+      extern TRITON_API_STORAGE triton::arch::Register x86_reg_ss;
 
 
       //! Returns all information about the register from its ID.
       std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> registerIdToRegisterInformation(triton::uint32 reg);
 
+      //! Returns the shared specification of the register from its ID, for x86 or x86-64. Unknown ids return the specification of ID_REG_INVALID.
+      const triton::arch::RegisterSpecification& registerIdToRegisterSpecification(triton::uint32 reg, bool x8664);
+
       //! Converts a capstone's register id to a triton's register id.
       triton::uint32 capstoneRegisterToTritonRegister(triton::uint32 id);
 
@@ -510,7 +513,7 @@ namespace triton {
       };
 
       //! Global set of registers.
-      extern triton::arch::Register* x86_regs[ID_REG_LAST_ITEM];
+      extern TRITON_API_STORAGE triton::arch::Register* x86_regs[ID_REG_LAST_ITEM];
 
       /*! \brief The list of prefixes.
        *
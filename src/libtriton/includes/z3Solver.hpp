@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_Z3SOLVER_H
+#define TRITON_Z3SOLVER_H
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <z3++.h>
+
+#include "ast.hpp"
+#include "solverEnums.hpp"
+#include "solverInterface.hpp"
+#include "solverModel.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      class SolverEngine;
+
+      //! \class Z3Solver
+      /*! \brief The Z3 backend of the solver engine. */
+      class Z3Solver : public SolverInterface {
+        protected:
+          //! The solver engine which receives the statistics.
+          const triton::engines::solver::SolverEngine& engine;
+
+          //! The memory limit of Z3 in megabytes, 0 if unlimited.
+          triton::uint32 memoryLimit;
+
+          /*!
+           * \brief The contexts of the running queries of the process.
+           *
+           * \description They are shared by all the backends, so that interrupt() reaches the queries of every
+           * thread, even with `-DTHREAD_LOCAL_API=on` where each thread owns its own solver engine.
+           */
+          static std::set<z3::context*> contexts;
+
+          //! The contexts of the running queries which have been interrupted.
+          static std::set<z3::context*> interrupted;
+
+          //! The contexts which are inside solver.check(), only they are interrupted through Z3.
+          static std::set<z3::context*> checking;
+
+          //! Protects the contexts. Queries on a frozen state or on several APIs may run concurrently.
+          static std::mutex mutex;
+
+          //! Checks the constraints of a solver within `timeout` milliseconds (0 if unlimited) and records the query.
+          triton::engines::solver::status_e check(z3::context& ctx, z3::solver& solver, triton::uint32 timeout) const;
+
+        public:
+          //! Constructor.
+          Z3Solver(const triton::engines::solver::SolverEngine& engine);
+
+          //! Destructor.
+          ~Z3Solver();
+
+          //! Returns the name of the backend.
+          std::string getName(void) const;
+
+          //! Returns the capabilities of the backend.
+          triton::uint32 getCapabilities(void) const;
+
+          //! Enumerates the models of a symbolic constraint, projected onto some symbolic variables, and returns their number.
+          triton::usize enumerateModels(triton::ast::AbstractNode* node, const std::vector<triton::usize>& variables, triton::uint32 limit, triton::engines::solver::modelCallback callback, void* data, triton::engines::solver::status_e& status, triton::uint32 timeout) const;
+
+          //! Interrupts the running queries of all threads.
+          void interrupt(void);
+
+          //! Sets the memory limit of Z3 in megabytes, 0 if unlimited. This limit is shared by all the Z3 contexts of the process.
+          void setMemoryLimit(triton::uint32 mb);
+
+          //! Returns the memory limit of Z3 in megabytes.
+          triton::uint32 getMemoryLimit(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_Z3SOLVER_H */
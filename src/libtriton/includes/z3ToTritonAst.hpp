@@ -8,6 +8,7 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <vector>
 #include <z3++.h>
 #include "ast.hpp"
 #include "tritonTypes.hpp"
@@ -41,8 +42,8 @@ namespace triton {
 
 
       private:
-        //! Vists and converts
-        triton::ast::AbstractNode* visit(z3::expr const& expr);
+        //! Converts a Z3's node whose arguments have already been converted.
+        triton::ast::AbstractNode* visit(z3::expr const& expr, const std::vector<triton::ast::AbstractNode*>& args);
 
 
       public:
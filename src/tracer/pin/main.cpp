@@ -16,6 +16,7 @@
 /* libTriton */
 #include <api.hpp>
 #include <pythonBindings.hpp>
+#include <x86Specifications.hpp>
 
 /* Pintool */
 #include "bindings.hpp"
@@ -532,6 +533,21 @@ namespace tracer {
     //! Snapshot engine
     Snapshot snapshot = Snapshot();
 
+    //! A summarized routine running natively on a thread.
+    struct summaryFrame_t {
+      //! The return address, 0 if no summarized routine is running.
+      triton::__uint ret;
+
+      //! The stack pointer once returned, it tells the return from a reentrant call of the same call site.
+      triton::__uint sp;
+
+      //! True between the processing of the first instruction of the routine and its callbackAfter.
+      bool processed;
+    };
+
+    //! The summarized routines running natively, indexed by thread.
+    static summaryFrame_t summaryFrames[PIN_MAX_THREADS];
+
 
 
     /* Switch lock */
@@ -551,6 +567,14 @@ namespace tracer {
       /* Analysis locked */
         return;
 
+      /* The instructions of a summarized routine are not processed, its summary was applied at the call */
+      summaryFrame_t& frame = tracer::pintool::summaryFrames[threadId];
+      if (frame.ret != 0) {
+        if (reinterpret_cast<triton::__uint>(addr) != frame.ret || PIN_GetContextReg(ctx, REG_STACK_PTR) != frame.sp)
+          return;
+        frame.ret = 0;
+      }
+
       /* Mutex */
       PIN_LockClient();
 
@@ -582,9 +606,24 @@ namespace tracer {
         tracer::pintool::context::executeContext();
       }
 
+      /* The return address and the stack pointer of the call, if the instruction starts a summarized routine */
+      triton::__uint sp  = PIN_GetContextReg(ctx, REG_STACK_PTR);
+      triton::__uint ret = 0;
+      if (triton::api.isSummarized(tritonInst->getAddress()))
+        PIN_SafeCopy(&ret, reinterpret_cast<void*>(sp), sizeof(ret));
+
       /* Process the IR and taint */
       triton::api.buildSemantics(*tritonInst);
 
+      /* Unless the summary declined the call, it returned to the caller and the routine runs natively until it returns */
+      if (ret != 0 &&
+          triton::api.getConcreteRegisterValue(TRITON_X86_REG_PC, false) == ret &&
+          triton::api.getConcreteRegisterValue(TRITON_X86_REG_SP.getParent(), false) == sp + sizeof(ret)) {
+        frame.ret       = ret;
+        frame.sp        = sp + sizeof(ret);
+        frame.processed = true;
+      }
+
       /* Execute the Python callback */
       if (tracer::pintool::context::mustBeExecuted == false)
         tracer::pintool::callbacks::before(tritonInst);
@@ -613,6 +652,14 @@ namespace tracer {
       /* Analysis locked */
         return;
 
+      /* Inside a summarized routine, only its first instruction was processed */
+      summaryFrame_t& frame = tracer::pintool::summaryFrames[threadId];
+      if (frame.ret != 0) {
+        if (!frame.processed)
+          return;
+        frame.processed = false;
+      }
+
       /* Mutex */
       PIN_LockClient();
 